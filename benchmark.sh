@@ -0,0 +1,55 @@
+#!/bin/sh
+#
+# Time tex3ds for each format with one tile per work unit (--grain 1) and
+# with the default band size, and report the throughput of each.
+#
+# usage: ./benchmark.sh [-n runs] [-b tex3ds] <image> [extra tex3ds options]
+
+runs=5
+tex3ds=./tex3ds
+
+while getopts "n:b:" opt; do
+  case $opt in
+    n) runs=$OPTARG ;;
+    b) tex3ds=$OPTARG ;;
+    *) echo "usage: $0 [-n runs] [-b tex3ds] <image> [options]" >&2; exit 1 ;;
+  esac
+done
+shift $((OPTIND - 1))
+
+if [ $# -lt 1 ]; then
+  echo "usage: $0 [-n runs] [-b tex3ds] <image> [options]" >&2
+  exit 1
+fi
+
+image=$1
+shift
+
+out=$(mktemp)
+trap 'rm -f "$out"' EXIT
+
+# best wall time in milliseconds over $runs runs
+best_time() {
+  best=
+  i=0
+  while [ $i -lt $runs ]; do
+    start=$(date +%s%N)
+    "$tex3ds" "$@" -z none -o "$out" "$image" >/dev/null || exit 1
+    end=$(date +%s%N)
+    ms=$(( (end - start) / 1000000 ))
+    if [ -z "$best" ] || [ $ms -lt $best ]; then
+      best=$ms
+    fi
+    i=$((i + 1))
+  done
+  echo $best
+}
+
+printf "%-10s %12s %12s %8s\n" format "grain 1 ms" "default ms" speedup
+for format in rgba8888 rgb888 rgba5551 rgb565 rgba4444 la88 hilo88 l8 a8 la44 l4 a4 etc1 etc1a4; do
+  fine=$(best_time -f $format --grain 1 "$@") || exit 1
+  band=$(best_time -f $format "$@") || exit 1
+  [ $band -gt 0 ] || band=1
+  ratio=$(( fine * 10 / band ))
+  printf "%-10s %12d %12d %6d.%dx\n" $format $fine $band $((ratio / 10)) $((ratio % 10))
+done
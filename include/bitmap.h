@@ -0,0 +1,177 @@
+/*------------------------------------------------------------------------------
+ * Copyright (c) 2017
+ *     Michael Theall (mtheall)
+ *
+ * This file is part of tex3ds.
+ *
+ * tex3ds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * tex3ds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with tex3ds.  If not, see <http://www.gnu.org/licenses/>.
+ *----------------------------------------------------------------------------*/
+/** @file bitmap.h
+ *  @brief Flat RGBA staging buffer
+ */
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "magick_compat.h"
+
+/* The staging channel follows the ImageMagick quantum depth. The checks
+ * define CHANNEL_DEPTH to build the staging code at both widths.
+ */
+#ifndef CHANNEL_DEPTH
+#define CHANNEL_DEPTH MAGICKCORE_QUANTUM_DEPTH
+#endif
+
+#if CHANNEL_DEPTH == 8
+/** @brief Staging channel; wide enough to hold a Magick::Quantum exactly */
+typedef uint8_t Channel;
+
+/** @brief Staging channel storage type */
+#define CHANNEL_STORAGE Magick::CharPixel
+#else
+/** @brief Staging channel; wide enough to hold a Magick::Quantum exactly */
+typedef uint16_t Channel;
+
+/** @brief Staging channel storage type */
+#define CHANNEL_STORAGE Magick::ShortPixel
+#endif
+
+/** @brief Number of bits in a staging channel */
+constexpr int CHANNEL_BITS = 8 * sizeof(Channel);
+
+/** @brief Maximum staging channel value */
+constexpr unsigned CHANNEL_MAX = (1u << CHANNEL_BITS) - 1;
+
+/** @brief RGBA staging pixel */
+struct Pixel
+{
+  Channel r; ///< Red
+  Channel g; ///< Green
+  Channel b; ///< Blue
+  Channel a; ///< Alpha
+};
+
+/** @brief Get the offset of a pixel in an 8x8 tile from its Morton index
+ *
+ *  @details
+ *  The hardware stores each 8x8 tile in Morton order: the bits of the index
+ *  interleave x and y, starting with x. Encoders read pixels through this
+ *  instead of swizzling the tile in place.
+ *
+ *  @param[in] index  Morton index (0-63)
+ *  @param[in] stride Pixel data stride
+ *  @returns offset from the top-left pixel of the tile
+ */
+inline size_t morton_offset(size_t index, size_t stride)
+{
+  size_t x = ((index >> 0) & 1) | ((index >> 1) & 2) | ((index >> 2) & 4);
+  size_t y = ((index >> 1) & 1) | ((index >> 2) & 2) | ((index >> 3) & 4);
+
+  return y*stride + x;
+}
+
+/** @brief Flat RGBA staging buffer
+ *
+ *  @details
+ *  Pixels are stored row-major and contiguous, starting on a cache line
+ *  boundary. Images are exported into a bitmap once, so the encoders can work
+ *  on plain arrays instead of going through the ImageMagick pixel cache.
+ */
+class Bitmap
+{
+public:
+  /** @brief Constructor
+   *  @param[in] width  Width
+   *  @param[in] height Height
+   */
+  Bitmap(size_t width, size_t height);
+
+  /** @brief Export an image
+   *
+   *  @details
+   *  The alpha statistics are gathered while each strip of the export is
+   *  still in cache, so inspecting the transparency of the image costs no
+   *  extra pass.
+   *
+   *  @param[in] img Image to export
+   */
+  explicit Bitmap(Magick::Image img);
+
+  Bitmap() = delete;
+  Bitmap(const Bitmap &other) = delete;
+  Bitmap(Bitmap &&other) = default;
+  Bitmap& operator=(const Bitmap &other) = delete;
+  Bitmap& operator=(Bitmap &&other) = default;
+
+  /** @brief Import into an image
+   *  @returns image
+   */
+  Magick::Image image() const;
+
+  /** @brief Get width
+   *  @returns width
+   */
+  size_t width() const
+  {
+    return w;
+  }
+
+  /** @brief Get height
+   *  @returns height
+   */
+  size_t height() const
+  {
+    return h;
+  }
+
+  /** @brief Get the lowest alpha value of the exported image
+   *  @returns lowest alpha value
+   */
+  Channel alpha_min() const
+  {
+    return a_min;
+  }
+
+  /** @brief Get the highest alpha value of the exported image
+   *  @returns highest alpha value
+   */
+  Channel alpha_max() const
+  {
+    return a_max;
+  }
+
+  /** @brief Get pixel data
+   *  @returns pixel data
+   */
+  Pixel* data()
+  {
+    return pixels;
+  }
+
+  /** @brief Get pixel data
+   *  @returns pixel data
+   */
+  const Pixel* data() const
+  {
+    return pixels;
+  }
+
+private:
+  size_t             w;       ///< Width
+  size_t             h;       ///< Height
+  std::vector<Pixel> storage; ///< Pixel storage
+  Pixel              *pixels; ///< Aligned pixel data
+  Channel            a_min;   ///< Lowest alpha value
+  Channel            a_max;   ///< Highest alpha value
+};
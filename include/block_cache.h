@@ -0,0 +1,160 @@
+/*------------------------------------------------------------------------------
+ * Copyright (c) 2017
+ *     Michael Theall (mtheall)
+ *
+ * This file is part of tex3ds.
+ *
+ * tex3ds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * tex3ds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with tex3ds.  If not, see <http://www.gnu.org/licenses/>.
+ *----------------------------------------------------------------------------*/
+/** @file block_cache.h
+ *  @brief ETC1 block cache
+ */
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include "etc1_packer.h"
+#include "rg_etc1.h"
+
+/** @brief ETC1 block cache
+ *
+ *  @details
+ *  Textures often repeat the same 4x4 block many times (canvas padding, flat
+ *  fills, gradients), and packing a block is by far the most expensive part
+ *  of ETC1 encoding. The cache maps an RGBA block, packer and quality to its
+ *  packed result so each distinct block is only packed once.
+ *
+ *  The map is split into shards, each with its own mutex, so workers rarely
+ *  contend. If two workers miss on the same block at once, both pack it;
+ *  packing is deterministic, so the output does not depend on who wins.
+ *
+ *  A shard is cleared when it grows past MAX_SHARD_SIZE entries, which
+ *  bounds the memory of the cache. Once enough blocks have been looked up,
+ *  the cache turns itself off if fewer than 1 in HIT_RATE_DIVISOR of them
+ *  hit; photographic textures rarely repeat a block.
+ */
+class BlockCache
+{
+public:
+  BlockCache() = default;
+
+  BlockCache(const BlockCache &other) = delete;
+  BlockCache(BlockCache &&other) = delete;
+  BlockCache& operator=(const BlockCache &other) = delete;
+  BlockCache& operator=(BlockCache &&other) = delete;
+
+  /** @brief Pack ETC1 blocks, reusing previous results where possible
+   *
+   *  @details
+   *  The blocks that miss are packed together in one call to the packer; a
+   *  block repeated within the batch is only packed once.
+   *
+   *  @param[out] out    Packed ETC1 blocks (8 bytes each, big-endian)
+   *  @param[in]  in     4x4 RGBA blocks (64 bytes each)
+   *  @param[out] errors Squared error of each packed block
+   *  @param[in]  count  Number of blocks
+   *  @param[in]  params Pack parameters
+   *  @param[in]  packer ETC1 block packer
+   */
+  void pack(uint8_t *out, const uint8_t *in, unsigned int *errors,
+            size_t count, rg_etc1::etc1_pack_params &params,
+            etc1::Packer packer);
+
+  /** @brief Get number of cache hits
+   *  @returns number of cache hits
+   */
+  size_t hits() const
+  {
+    return hit_count;
+  }
+
+  /** @brief Get number of cache misses
+   *  @returns number of cache misses
+   */
+  size_t misses() const
+  {
+    return miss_count;
+  }
+
+  /** @brief Get whether the cache is in use
+   *  @returns whether the cache is in use
+   */
+  bool enabled() const
+  {
+    return active;
+  }
+
+private:
+  /** @brief Cache key */
+  struct Key
+  {
+    std::array<uint8_t, 64> rgba;    ///< RGBA block
+    etc1::Packer            packer;  ///< ETC1 block packer
+    rg_etc1::etc1_quality   quality; ///< ETC1 quality
+
+    /** @brief Compare keys
+     *  @param[in] other Key to compare
+     *  @returns whether the keys are equal
+     */
+    bool operator==(const Key &other) const
+    {
+      return packer == other.packer && quality == other.quality
+          && rgba == other.rgba;
+    }
+  };
+
+  /** @brief Cache key hasher */
+  struct KeyHash
+  {
+    /** @brief Hash a key
+     *  @param[in] key Key to hash
+     *  @returns hash
+     */
+    size_t operator()(const Key &key) const;
+  };
+
+  /** @brief Packed block */
+  struct Value
+  {
+    std::array<uint8_t, 8> block; ///< Packed ETC1 block
+    unsigned int           error; ///< Squared error of the packed block
+  };
+
+  /** @brief Cache shard */
+  struct Shard
+  {
+    std::mutex                              mutex; ///< Shard mutex
+    std::unordered_map<Key, Value, KeyHash> map;   ///< Packed blocks
+  };
+
+  /** @brief Number of shards */
+  static constexpr size_t NUM_SHARDS = 64;
+
+  /** @brief Maximum number of blocks in a shard */
+  static constexpr size_t MAX_SHARD_SIZE = 2048;
+
+  /** @brief Number of lookups before the hit rate is checked */
+  static constexpr size_t MIN_LOOKUPS = 16384;
+
+  /** @brief The cache is turned off below 1 hit per this many lookups */
+  static constexpr size_t HIT_RATE_DIVISOR = 32;
+
+  std::array<Shard, NUM_SHARDS> shards;        ///< Shards
+  std::atomic<size_t>           hit_count{0};  ///< Number of cache hits
+  std::atomic<size_t>           miss_count{0}; ///< Number of cache misses
+  std::atomic<bool>             active{true};  ///< Whether the cache is in use
+};
@@ -22,6 +22,7 @@
  */
 #pragma once
 
+#include <atomic>
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
@@ -34,6 +35,32 @@
  */
 std::vector<uint8_t> lzssEncode(const void *src, size_t len);
 
+/** @brief LZSS/LZ10 compression with a size limit
+ *
+ *  @details
+ *  Gives up as soon as the output grows past the limit, which may be lowered
+ *  by another thread while compressing.
+ *
+ *  @param[in]  src    Source buffer
+ *  @param[in]  len    Source length
+ *  @param[in]  limit  Output size limit
+ *  @returns Compressed buffer; empty if the output grew past the limit
+ */
+std::vector<uint8_t> lzssEncode(const void *src, size_t len,
+                                const std::atomic<size_t> &limit);
+
+/** @brief Optimal-parse LZSS/LZ10 compression
+ *
+ *  @details
+ *  Slower than lzssEncode(), but chooses the chunks that give the smallest
+ *  output. The output is decoded by lzssDecode() as usual.
+ *
+ *  @param[in]  src    Source buffer
+ *  @param[in]  len    Source length
+ *  @returns Compressed buffer
+ */
+std::vector<uint8_t> lzssOptimalEncode(const void *src, size_t len);
+
 /** @brief LZSS/LZ10 decompression
  *  @param[in]  src Source buffer
  *  @param[out] dst Destination buffer
@@ -49,6 +76,32 @@ void lzssDecode(const void *src, void *dst, size_t len);
  */
 std::vector<uint8_t> lz11Encode(const void *src, size_t len);
 
+/** @brief LZ11 compression with a size limit
+ *
+ *  @details
+ *  Gives up as soon as the output grows past the limit, which may be lowered
+ *  by another thread while compressing.
+ *
+ *  @param[in]  src    Source buffer
+ *  @param[in]  len    Source length
+ *  @param[in]  limit  Output size limit
+ *  @returns Compressed buffer; empty if the output grew past the limit
+ */
+std::vector<uint8_t> lz11Encode(const void *src, size_t len,
+                                const std::atomic<size_t> &limit);
+
+/** @brief Optimal-parse LZ11 compression
+ *
+ *  @details
+ *  Slower than lz11Encode(), but chooses the chunks that give the smallest
+ *  output. The output is decoded by lz11Decode() as usual.
+ *
+ *  @param[in]  src    Source buffer
+ *  @param[in]  len    Source length
+ *  @returns Compressed buffer
+ */
+std::vector<uint8_t> lz11OptimalEncode(const void *src, size_t len);
+
 /** @brief LZ11 decompression
  *  @param[in]  src Source buffer
  *  @param[out] dst Destination buffer
@@ -64,6 +117,20 @@ void lz11Decode(const void *src, void *dst, size_t len);
  */
 std::vector<uint8_t> rleEncode(const void *src, size_t len);
 
+/** @brief Run-length encoding compression with a size limit
+ *
+ *  @details
+ *  Gives up as soon as the output grows past the limit, which may be lowered
+ *  by another thread while compressing.
+ *
+ *  @param[in]  src    Source buffer
+ *  @param[in]  len    Source length
+ *  @param[in]  limit  Output size limit
+ *  @returns Compressed buffer; empty if the output grew past the limit
+ */
+std::vector<uint8_t> rleEncode(const void *src, size_t len,
+                               const std::atomic<size_t> &limit);
+
 /** @brief Run-length encoding decompression
  *  @param[in]  src Source buffer
  *  @param[out] dst Destination buffer
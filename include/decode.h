@@ -0,0 +1,210 @@
+/*------------------------------------------------------------------------------
+ * Copyright (c) 2017
+ *     Michael Theall (mtheall)
+ *
+ * This file is part of tex3ds.
+ *
+ * tex3ds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * tex3ds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with tex3ds.  If not, see <http://www.gnu.org/licenses/>.
+ *----------------------------------------------------------------------------*/
+/** @file decode.h
+ *  @brief Image decoding routines
+ *
+ *  @details
+ *  Each decoder is the inverse of the matching encoder in encode.h: it reads a
+ *  band of encoded 8x8 tiles and writes the pixels they represent, which is
+ *  exactly what the 3DS will display. The preview image is rebuilt from the encoded
+ *  output this way, so the encoders never have to write to the source image.
+ *
+ *  @note All of the decoding routines write the tile in Morton order (see
+ *  morton_offset()), except for ETC1/ETC1A4 which do not involve swizzling.
+ */
+#pragma once
+#include "bitmap.h"
+#include <cstddef>
+#include <cstdint>
+
+/** @namespace decode
+ *  @brief Image decoding namespace
+ */
+namespace decode
+{
+
+/** @brief Band decoder
+ *
+ *  @details
+ *  Tiles are numbered in raster order across an image whose width is the
+ *  stride.
+ *
+ *  @param[in]  in     Encoded data for the first tile of the band
+ *  @param[out] p      Pixel data for the whole image
+ *  @param[in]  stride Pixel data stride
+ *  @param[in]  first  First tile of the band
+ *  @param[in]  count  Number of tiles in the band
+ */
+typedef void (*Decoder)(const uint8_t *in, Pixel *p, size_t stride,
+                        size_t first, size_t count);
+
+/** @brief RGBA8888 decoder
+ *  @param[in]  in     Encoded data (256 bytes per tile)
+ *  @param[out] p      Pixel data
+ *  @param[in]  stride Pixel data stride
+ *  @param[in]  first  First tile of the band
+ *  @param[in]  count  Number of tiles in the band
+ */
+void rgba8888(const uint8_t *in, Pixel *p, size_t stride, size_t first,
+              size_t count);
+
+/** @brief RGB888 decoder
+ *  @param[in]  in     Encoded data (192 bytes per tile)
+ *  @param[out] p      Pixel data
+ *  @param[in]  stride Pixel data stride
+ *  @param[in]  first  First tile of the band
+ *  @param[in]  count  Number of tiles in the band
+ */
+void rgb888(const uint8_t *in, Pixel *p, size_t stride, size_t first,
+            size_t count);
+
+/** @brief RGB565 decoder
+ *  @param[in]  in     Encoded data (128 bytes per tile)
+ *  @param[out] p      Pixel data
+ *  @param[in]  stride Pixel data stride
+ *  @param[in]  first  First tile of the band
+ *  @param[in]  count  Number of tiles in the band
+ */
+void rgb565(const uint8_t *in, Pixel *p, size_t stride, size_t first,
+            size_t count);
+
+/** @brief RGBA5551 decoder
+ *  @param[in]  in     Encoded data (128 bytes per tile)
+ *  @param[out] p      Pixel data
+ *  @param[in]  stride Pixel data stride
+ *  @param[in]  first  First tile of the band
+ *  @param[in]  count  Number of tiles in the band
+ */
+void rgba5551(const uint8_t *in, Pixel *p, size_t stride, size_t first,
+              size_t count);
+
+/** @brief RGBA4444 decoder
+ *  @param[in]  in     Encoded data (128 bytes per tile)
+ *  @param[out] p      Pixel data
+ *  @param[in]  stride Pixel data stride
+ *  @param[in]  first  First tile of the band
+ *  @param[in]  count  Number of tiles in the band
+ */
+void rgba4444(const uint8_t *in, Pixel *p, size_t stride, size_t first,
+              size_t count);
+
+/** @brief LA88 decoder
+ *  @param[in]  in     Encoded data (128 bytes per tile)
+ *  @param[out] p      Pixel data
+ *  @param[in]  stride Pixel data stride
+ *  @param[in]  first  First tile of the band
+ *  @param[in]  count  Number of tiles in the band
+ */
+void la88(const uint8_t *in, Pixel *p, size_t stride, size_t first,
+          size_t count);
+
+/** @brief HILO88 decoder
+ *
+ *  @details
+ *  HI goes to the red channel and LO to the green channel; blue is 0.
+ *
+ *  @param[in]  in     Encoded data (128 bytes per tile)
+ *  @param[out] p      Pixel data
+ *  @param[in]  stride Pixel data stride
+ *  @param[in]  first  First tile of the band
+ *  @param[in]  count  Number of tiles in the band
+ */
+void hilo88(const uint8_t *in, Pixel *p, size_t stride, size_t first,
+            size_t count);
+
+/** @brief L8 decoder
+ *  @param[in]  in     Encoded data (64 bytes per tile)
+ *  @param[out] p      Pixel data
+ *  @param[in]  stride Pixel data stride
+ *  @param[in]  first  First tile of the band
+ *  @param[in]  count  Number of tiles in the band
+ */
+void l8(const uint8_t *in, Pixel *p, size_t stride, size_t first,
+        size_t count);
+
+/** @brief A8 decoder
+ *
+ *  @details
+ *  The RGB channels are 0.
+ *
+ *  @param[in]  in     Encoded data (64 bytes per tile)
+ *  @param[out] p      Pixel data
+ *  @param[in]  stride Pixel data stride
+ *  @param[in]  first  First tile of the band
+ *  @param[in]  count  Number of tiles in the band
+ */
+void a8(const uint8_t *in, Pixel *p, size_t stride, size_t first,
+        size_t count);
+
+/** @brief LA44 decoder
+ *  @param[in]  in     Encoded data (64 bytes per tile)
+ *  @param[out] p      Pixel data
+ *  @param[in]  stride Pixel data stride
+ *  @param[in]  first  First tile of the band
+ *  @param[in]  count  Number of tiles in the band
+ */
+void la44(const uint8_t *in, Pixel *p, size_t stride, size_t first,
+          size_t count);
+
+/** @brief L4 decoder
+ *  @param[in]  in     Encoded data (32 bytes per tile)
+ *  @param[out] p      Pixel data
+ *  @param[in]  stride Pixel data stride
+ *  @param[in]  first  First tile of the band
+ *  @param[in]  count  Number of tiles in the band
+ */
+void l4(const uint8_t *in, Pixel *p, size_t stride, size_t first,
+        size_t count);
+
+/** @brief A4 decoder
+ *
+ *  @details
+ *  The RGB channels are 0.
+ *
+ *  @param[in]  in     Encoded data (32 bytes per tile)
+ *  @param[out] p      Pixel data
+ *  @param[in]  stride Pixel data stride
+ *  @param[in]  first  First tile of the band
+ *  @param[in]  count  Number of tiles in the band
+ */
+void a4(const uint8_t *in, Pixel *p, size_t stride, size_t first,
+        size_t count);
+
+/** @brief ETC1 decoder
+ *  @param[in]  in     Encoded data (32 bytes per tile)
+ *  @param[out] p      Pixel data
+ *  @param[in]  stride Pixel data stride
+ *  @param[in]  first  First tile of the band
+ *  @param[in]  count  Number of tiles in the band
+ */
+void etc1(const uint8_t *in, Pixel *p, size_t stride, size_t first,
+          size_t count);
+
+/** @brief ETC1A4 decoder
+ *  @param[in]  in     Encoded data (64 bytes per tile)
+ *  @param[out] p      Pixel data
+ *  @param[in]  stride Pixel data stride
+ *  @param[in]  first  First tile of the band
+ *  @param[in]  count  Number of tiles in the band
+ */
+void etc1a4(const uint8_t *in, Pixel *p, size_t stride, size_t first,
+            size_t count);
+
+}
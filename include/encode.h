@@ -20,12 +20,16 @@
 /** @file encode.h
  *  @brief Image encoding routines
  *
- *  @note All of the encoding routines expect the tile to be swizzled, except
- *  for ETC1/ETC1A4 which do not involve swizzling.
+ *  @note All of the encoding routines read the tile in Morton order (see
+ *  morton_offset()), except for ETC1/ETC1A4 which do not involve swizzling.
+ *  The pixel data itself is never swizzled. The bit layout of every format
+ *  other than ETC1/ETC1A4 is described in format.h.
  */
 #pragma once
 #include <cassert>
-#include "magick_compat.h"
+#include "bitmap.h"
+#include "block_cache.h"
+#include "etc1_packer.h"
 #include "rg_etc1.h"
 #include "subimage.h"
 #include <vector>
@@ -117,38 +121,61 @@ encode(const SubImage &sub, uint16_t width, uint16_t height, Buffer &out)
 /** @brief Work unit
  *
  *  @details
- *  A work unit encapsulates the work needed to process a single 8x8 tile from
- *  a texture.
+ *  A work unit encapsulates the work needed to process a band of consecutive
+ *  8x8 tiles from a texture. Tiles are numbered in raster order; the processor
+ *  is called once for the whole band and writes the encoded tiles to out,
+ *  which is advanced past them. Every format encodes a tile to a fixed number
+ *  of bytes, so each work unit can write directly to its own slice of the
+ *  output.
+ *
+ *  The pixel data is only read; the preview is rebuilt from the encoded output
+ *  by the matching decoder (see decode.h).
+ *
+ *  If etc1_errors is set, the ETC1 encoders also write the squared error of
+ *  each 4x4 block to it, in encoding order, and advance it past them.
  */
 struct WorkUnit
 {
-  Buffer                result;                ///< Work result
-  uint64_t              sequence;              ///< Work identifier
-  PixelPacket           p;                     ///< Pixel data buffer
+  const Pixel           *p;                    ///< Pixel data buffer
   size_t                stride;                ///< Pixel data stride
+  size_t                first;                 ///< First tile of the band
+  size_t                count;                 ///< Number of tiles in the band
+  uint8_t               *out;                  ///< Output buffer
   rg_etc1::etc1_quality etc1_quality;          ///< ETC1 quality option
-  bool                  output;                ///< Whether to output 3DS data
-  bool                  preview;               ///< Whether to output preview image
+  etc1::Packer          etc1_packer;           ///< ETC1 block packer
+  unsigned int          etc1_target_error;     ///< ETC1 error target
+  BlockCache            *etc1_cache;           ///< ETC1 block cache
+  uint32_t              *etc1_errors;          ///< ETC1 block errors output
   void                  (*process)(WorkUnit&); ///< Work unit processor
 
   /** @brief Constructor
-   *  @param[in] sequence     Work identifier
-   *  @param[in] p            Pixel data buffer
-   *  @param[in] stride       Pixel data stride
-   *  @param[in] etc1_quality ETC1 quality option
-   *  @param[in] output       Whether to output 3DS data
-   *  @param[in] preview      Whether to output preview image
-   *  @param[in] process      Work unit processor
+   *  @param[in] p                 Pixel data buffer
+   *  @param[in] stride            Pixel data stride
+   *  @param[in] first             First tile of the band
+   *  @param[in] count             Number of tiles in the band
+   *  @param[in] out               Output buffer
+   *  @param[in] etc1_quality      ETC1 quality option
+   *  @param[in] etc1_packer       ETC1 block packer
+   *  @param[in] etc1_target_error ETC1 error target; 0 for fixed quality
+   *  @param[in] etc1_cache        ETC1 block cache; may be null
+   *  @param[in] etc1_errors       ETC1 block errors output; may be null
+   *  @param[in] process           Work unit processor
    */
-  WorkUnit(uint64_t sequence, PixelPacket p, size_t stride,
-           rg_etc1::etc1_quality etc1_quality, bool output, bool preview,
+  WorkUnit(const Pixel *p, size_t stride, size_t first, size_t count,
+           uint8_t *out, rg_etc1::etc1_quality etc1_quality,
+           etc1::Packer etc1_packer, unsigned int etc1_target_error,
+           BlockCache *etc1_cache, uint32_t *etc1_errors,
            void (*process)(WorkUnit&))
-  : sequence(sequence),
-    p(p),
+  : p(p),
     stride(stride),
+    first(first),
+    count(count),
+    out(out),
     etc1_quality(etc1_quality),
-    output(output),
-    preview(preview),
+    etc1_packer(etc1_packer),
+    etc1_target_error(etc1_target_error),
+    etc1_cache(etc1_cache),
+    etc1_errors(etc1_errors),
     process(process)
   { }
 
@@ -157,22 +184,12 @@ struct WorkUnit
   WorkUnit(WorkUnit &&other) = default;
   WorkUnit& operator=(const WorkUnit &other) = delete;
   WorkUnit& operator=(WorkUnit &&other) = default;
-
-  /** @brief Work unit comparator
-   *  @param[in] other Work unit to compare
-   *  @returns sequence > other.sequence
-   */
-  bool operator<(const WorkUnit &other) const
-  {
-    /* greater-than for min-heap */
-    return sequence > other.sequence;
-  }
 };
 
 /** @brief RGBA8888 encoder
  *
  *  @details
- *  Outputs the tile in RGBA8888 (32bpp) format. Data is output in ABGR order.
+ *  Outputs the tiles in RGBA8888 (32bpp) format. Data is output in ABGR order.
  *
  *  If the source image has no alpha channel, every pixel will be opaque.
  *
@@ -183,7 +200,7 @@ void rgba8888(WorkUnit &work);
 /** @brief RGB888 encoder
  *
  *  @details
- *  Outputs the tile in RGB888 (24bpp) format. Data is output in BGR order. The
+ *  Outputs the tiles in RGB888 (24bpp) format. Data is output in BGR order. The
  *  alpha channel is ignored; every pixel is opaque.
  *
  *  @param[in] work Work unit
@@ -193,7 +210,7 @@ void rgb888(WorkUnit &work);
 /** @brief RGB565 encoder
  *
  *  @details
- *  Outputs the tile in RGB565 (16bpp) format. The upper 5 bits are red, the
+ *  Outputs the tiles in RGB565 (16bpp) format. The upper 5 bits are red, the
  *  middle 6 bits are green, the lower 5 bits are blue. The data is output as
  *  16-bit values in little-endian. The alpha channel is ignored; every pixel is
  *  opaque.
@@ -205,7 +222,7 @@ void rgb565(WorkUnit &work);
 /** @brief RGBA5551 encoder
  *
  *  @details
- *  Outputs the tile in RGBA5551 (16bpp) format. The upper 5 bits are red, the
+ *  Outputs the tiles in RGBA5551 (16bpp) format. The upper 5 bits are red, the
  *  next lower 5 bits are green, the next lower 5 bits are blue, the lowest bit
  *  is alpha. The data is output as 16-bit values in little-endian.
  *
@@ -218,7 +235,7 @@ void rgba5551(WorkUnit &work);
 /** @brief RGBA4444 encoder
  *
  *  @details
- *  Outputs the tile in RGBA4444 (16bpp) format. The upper 4 bits are red, the
+ *  Outputs the tiles in RGBA4444 (16bpp) format. The upper 4 bits are red, the
  *  next lower 4 bits are green, the next lower 4 bits are blue, the lower 4
  *  bits are alpha. The data is output as 16-bit values in little-endian.
  *
@@ -231,7 +248,7 @@ void rgba4444(WorkUnit &work);
 /** @brief LA88 encoder
  *
  *  @details
- *  Outputs the tile in LA88 (16bpp) format. L is the luminance, which is
+ *  Outputs the tiles in LA88 (16bpp) format. L is the luminance, which is
  *  calculated from the RGB components with gamma correction. The data is output
  *  in AL order.
  *
@@ -244,9 +261,9 @@ void la88(WorkUnit &work);
 /** @brief HILO88 encoder
  *
  *  @details
- *  Outputs the tile in HILO88 (16bpp) format. HI corresponds to the data in the
- *  red channel; LO corresponds to the data in the green channel. The blue and
- *  alpha channels are ignored. The data is output in LOHI order.
+ *  Outputs the tiles in HILO88 (16bpp) format. HI corresponds to the data in
+ *  the red channel; LO corresponds to the data in the green channel. The blue
+ *  and alpha channels are ignored. The data is output in LOHI order.
  *
  *  @param[in] work Work unit
  */
@@ -255,7 +272,7 @@ void hilo88(WorkUnit &work);
 /** @brief L8 encoder
  *
  *  @details
- *  Outputs the tile in L8 (8bpp) format. L is the luminance, which is
+ *  Outputs the tiles in L8 (8bpp) format. L is the luminance, which is
  *  calculated from the RGB components with gamma correction. The alpha channel
  *  is ignored; every pixel is opaque.
  *
@@ -266,7 +283,7 @@ void l8(WorkUnit &work);
 /** @brief A8 encoder
  *
  *  @details
- *  Outputs the tile in A8 (8bpp) format. The RGB channels are ignored.
+ *  Outputs the tiles in A8 (8bpp) format. The RGB channels are ignored.
  *
  *  If the source image has no alpha channel, every pixel will be opaque.
  *
@@ -277,7 +294,7 @@ void a8(WorkUnit &work);
 /** @brief LA44 encoder
  *
  *  @details
- *  Outputs the tile in LA44 (8bpp) format. L is the luminance, which is
+ *  Outputs the tiles in LA44 (8bpp) format. L is the luminance, which is
  *  calculated from the RGB components with gamma correction. The upper 4 bits
  *  are luminance, the lower 4 bits are alpha.
  *
@@ -290,7 +307,7 @@ void la44(WorkUnit &work);
 /** @brief L4 encoder
  *
  *  @details
- *  Outputs the tile in L4 (4bpp) format. L is the luminance, which is
+ *  Outputs the tiles in L4 (4bpp) format. L is the luminance, which is
  *  calculated from the RGB components with gamma correction. For each pair of
  *  pixels, the first resides in the lower 4 bits, and the second resides in the
  *  upper 4 bits. The alpha channel is ignored; every pixel is opaque.
@@ -302,8 +319,8 @@ void l4(WorkUnit &work);
 /** @brief A4 encoder
  *
  *  @details
- *  Outputs the tile in A8 (8bpp) format. The RGB channels are ignored. For each
- *  pair of pixels, the first resides in the lower 4 bits, and the second
+ *  Outputs the tiles in A4 (4bpp) format. The RGB channels are ignored. For
+ *  each pair of pixels, the first resides in the lower 4 bits, and the second
  *  resides in the upper 4 bits.
  *
  *  If the source image has no alpha channel, every pixel will be opaque.
@@ -315,9 +332,10 @@ void a4(WorkUnit &work);
 /** @brief ETC1 encoder
  *
  *  @details
- *  Outputs the tile in ETC1 (4bpp) format. The tile is split into 4 4x4 blocks,
- *  each of which are encoded into a 64-bit value. Each 64-bit value is output
- *  in little-endian order. The alpha channel is ignored; every pixel is opaque.
+ *  Outputs the tiles in ETC1 (4bpp) format. The tile is split into 4 4x4
+ *  blocks, each of which are encoded into a 64-bit value. Each 64-bit value is
+ *  output in little-endian order. The alpha channel is ignored; every pixel is
+ *  opaque.
  *
  *  @param[in] work Work unit
  */
@@ -326,7 +344,7 @@ void etc1(WorkUnit &work);
 /** @brief ETC1A4 encoder
  *
  *  @details
- *  Outputs the tile in ETC1A4 (8bpp) format. The tile is split into 4 4x4
+ *  Outputs the tiles in ETC1A4 (8bpp) format. The tile is split into 4 4x4
  *  blocks, each of which are encoded into an 8-byte alpha block followed by the
  *  64-bit ETC1 encoding. The alpha block is encoded with X/Y transposed. For
  *  each pair of pixels, the first resides in the lower 4 bits, and the second
@@ -337,4 +355,22 @@ void etc1(WorkUnit &work);
  */
 void etc1a4(WorkUnit &work);
 
+/** @brief Refine one 4x4 block of an encoded ETC1/ETC1A4 tile
+ *
+ *  @details
+ *  Packs the block with rg_etc1 at medium and then high quality, and replaces
+ *  the encoded block whenever the result has a lower error. The encoded block
+ *  is valid at all times.
+ *
+ *  @param[in]    p      Tile pixel data
+ *  @param[in]    stride Pixel data stride
+ *  @param[in]    block  Block index within the tile (0-3), in encoding order
+ *  @param[in]    out    Encoded tile
+ *  @param[inout] error  Squared error of the encoded block
+ *  @param[in]    alpha  Whether the tile is ETC1A4
+ *  @param[in]    cache  ETC1 block cache; may be null
+ */
+void etc1_refine(const Pixel *p, size_t stride, size_t block, uint8_t *out,
+                 uint32_t &error, bool alpha, BlockCache *cache);
+
 }
@@ -0,0 +1,70 @@
+/*------------------------------------------------------------------------------
+ * Copyright (c) 2017
+ *     Michael Theall (mtheall)
+ *
+ * This file is part of tex3ds.
+ *
+ * tex3ds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * tex3ds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with tex3ds.  If not, see <http://www.gnu.org/licenses/>.
+ *----------------------------------------------------------------------------*/
+/** @file etc1_packer.h
+ *  @brief ETC1 block packers
+ *
+ *  @details
+ *  The ETC1 encoder hands batches of 4x4 blocks to a packer. rg_etc1's
+ *  search-based packer (rg_etc1::pack_etc1_blocks) is the default; the draft
+ *  packer trades quality for speed while iterating on textures.
+ */
+#pragma once
+#include "rg_etc1.h"
+
+/** @namespace etc1
+ *  @brief ETC1 packer namespace
+ */
+namespace etc1
+{
+
+/** @brief ETC1 block packer
+ *
+ *  @details
+ *  Blocks are 16 RGBA pixels in raster order, as for rg_etc1::pack_etc1_block.
+ *  Packers must be deterministic and thread safe.
+ *
+ *  @param[out] out    Packed ETC1 blocks (8 bytes each, big-endian)
+ *  @param[in]  in     4x4 RGBA blocks
+ *  @param[out] errors Squared error of each packed block
+ *  @param[in]  count  Number of blocks
+ *  @param[in]  params ETC1 parameters
+ */
+typedef void (*Packer)(void *out, const unsigned int *in, unsigned int *errors,
+                       unsigned int count, rg_etc1::etc1_pack_params &params);
+
+/** @brief Draft ETC1 packer
+ *
+ *  @details
+ *  Each subblock gets its average colour as the base colour, and the
+ *  intensity table and selectors are then fitted to that colour. Both flips
+ *  are tried. Differential mode is used whenever the colours fit it. There is
+ *  no search over base colours, so this is several times faster than rg_etc1
+ *  at any quality, at some cost in PSNR. The quality in params is ignored.
+ *
+ *  @param[out] out    Packed ETC1 blocks (8 bytes each, big-endian)
+ *  @param[in]  in     4x4 RGBA blocks
+ *  @param[out] errors Squared error of each packed block
+ *  @param[in]  count  Number of blocks
+ *  @param[in]  params ETC1 parameters
+ */
+void draft(void *out, const unsigned int *in, unsigned int *errors,
+           unsigned int count, rg_etc1::etc1_pack_params &params);
+
+}
@@ -0,0 +1,270 @@
+/*------------------------------------------------------------------------------
+ * Copyright (c) 2017
+ *     Michael Theall (mtheall)
+ *
+ * This file is part of tex3ds.
+ *
+ * tex3ds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * tex3ds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with tex3ds.  If not, see <http://www.gnu.org/licenses/>.
+ *----------------------------------------------------------------------------*/
+/** @file format.h
+ *  @brief Compile-time pixel format descriptors
+ *
+ *  @details
+ *  Every format other than ETC1/ETC1A4 stores each pixel as a fixed-width
+ *  value built from bit fields, one per channel. A format is described by its
+ *  bits per pixel and its fields; encode_tile() and decode_tile() are
+ *  instantiated from the description, so each format gets its own fully
+ *  inlined tile loop which the compiler can unroll and vectorize.
+ *
+ *  Pixels are stored in Morton order (see morton_offset()). Values wider than
+ *  a byte are stored little-endian; in 4bpp formats the first pixel of each
+ *  pair resides in the lower 4 bits and the second in the upper 4 bits.
+ */
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include "bitmap.h"
+#include "quantum.h"
+
+/** @namespace format
+ *  @brief Pixel format namespace
+ */
+namespace format
+{
+
+/** @brief Channel a field is taken from */
+enum Source
+{
+  RED,       ///< Red channel
+  GREEN,     ///< Green channel
+  BLUE,      ///< Blue channel
+  ALPHA,     ///< Alpha channel
+  LUMINANCE, ///< Gamma-corrected luminance of the RGB channels
+};
+
+/** @brief Bit field of an encoded pixel
+ *  @tparam src   Channel the field is taken from
+ *  @tparam bits  Field width
+ *  @tparam shift Field offset from the least significant bit
+ */
+template<Source src, unsigned bits, unsigned shift>
+struct Field
+{
+  static constexpr Source source = src; ///< Channel the field is taken from
+
+  /** @brief Encode the field
+   *  @param[in] c Pixel
+   *  @param[in] l 8-bit luminance of the pixel
+   *  @returns field in position
+   */
+  static uint32_t pack(const Pixel &c, uint8_t l)
+  {
+    uint32_t v = 0;
+    switch(src)
+    {
+      case RED:       v = channel_to_bits<bits>(c.r); break;
+      case GREEN:     v = channel_to_bits<bits>(c.g); break;
+      case BLUE:      v = channel_to_bits<bits>(c.b); break;
+      case ALPHA:     v = channel_to_bits<bits>(c.a); break;
+      case LUMINANCE: v = l >> (8 - bits);            break;
+    }
+
+    return v << shift;
+  }
+
+  /** @brief Decode the field
+   *  @param[in]  v Encoded pixel
+   *  @param[out] c Pixel
+   */
+  static void unpack(uint32_t v, Pixel &c)
+  {
+    Channel ch = bits_to_channel<bits>((v >> shift) & ((1u << bits) - 1));
+    switch(src)
+    {
+      case RED:       c.r = ch;             break;
+      case GREEN:     c.g = ch;             break;
+      case BLUE:      c.b = ch;             break;
+      case ALPHA:     c.a = ch;             break;
+      case LUMINANCE: c.r = c.g = c.b = ch; break;
+    }
+  }
+};
+
+/** @brief Check whether any field is taken from a channel
+ *  @tparam src Channel to look for
+ *  @returns false
+ */
+template<Source src>
+constexpr bool uses()
+{
+  return false;
+}
+
+/** @brief Check whether any field is taken from a channel
+ *  @tparam src    Channel to look for
+ *  @tparam F      First field
+ *  @tparam Fields Remaining fields
+ *  @returns whether any field is taken from src
+ */
+template<Source src, typename F, typename... Fields>
+constexpr bool uses()
+{
+  return F::source == src || uses<src, Fields...>();
+}
+
+/** @brief Pixel format descriptor
+ *
+ *  @details
+ *  Channels without a field decode as 0, except for alpha which decodes as
+ *  opaque.
+ *
+ *  @tparam bpp    Bits per pixel; 4 or a multiple of 8
+ *  @tparam Fields Bit fields
+ */
+template<unsigned bpp, typename... Fields>
+struct Format
+{
+  static_assert(bpp == 4 || (bpp % 8 == 0 && bpp <= 32), "unsupported bpp");
+
+  static constexpr unsigned bits_per_pixel = bpp;     ///< Bits per pixel
+  static constexpr size_t   tile_size      = 8 * bpp; ///< Bytes per tile
+
+  /** @brief Whether the format needs the pixel luminance */
+  static constexpr bool luminance = uses<LUMINANCE, Fields...>();
+
+  /** @brief Encode a pixel
+   *  @param[in] c Pixel
+   *  @param[in] l 8-bit luminance of the pixel
+   *  @returns encoded pixel
+   */
+  static uint32_t pack(const Pixel &c, uint8_t l)
+  {
+    uint32_t v = 0;
+    using expand = int[];
+    (void)expand{0, (v |= Fields::pack(c, l), 0)...};
+    return v;
+  }
+
+  /** @brief Decode a pixel
+   *  @param[in] v Encoded pixel
+   *  @returns pixel
+   */
+  static Pixel unpack(uint32_t v)
+  {
+    Pixel c = { 0, 0, 0, CHANNEL_MAX };
+    using expand = int[];
+    (void)expand{0, (Fields::unpack(v, c), 0)...};
+    return c;
+  }
+};
+
+typedef Format<32, Field<ALPHA, 8,  0>, Field<BLUE,  8,  8>,
+                   Field<GREEN, 8, 16>, Field<RED,   8, 24>>  RGBA8888;
+typedef Format<24, Field<BLUE,  8,  0>, Field<GREEN, 8,  8>,
+                   Field<RED,   8, 16>>                       RGB888;
+typedef Format<16, Field<RED,   5, 11>, Field<GREEN, 5,  6>,
+                   Field<BLUE,  5,  1>, Field<ALPHA, 1,  0>>  RGBA5551;
+typedef Format<16, Field<RED,   5, 11>, Field<GREEN, 6,  5>,
+                   Field<BLUE,  5,  0>>                       RGB565;
+typedef Format<16, Field<RED,   4, 12>, Field<GREEN, 4,  8>,
+                   Field<BLUE,  4,  4>, Field<ALPHA, 4,  0>>  RGBA4444;
+typedef Format<16, Field<ALPHA, 8,  0>, Field<LUMINANCE, 8, 8>> LA88;
+typedef Format<16, Field<GREEN, 8,  0>, Field<RED,   8,  8>>  HILO88;
+typedef Format<8,  Field<LUMINANCE, 8, 0>>                    L8;
+typedef Format<8,  Field<ALPHA, 8,  0>>                       A8;
+typedef Format<8,  Field<ALPHA, 4,  0>, Field<LUMINANCE, 4, 4>> LA44;
+typedef Format<4,  Field<LUMINANCE, 4, 0>>                    L4;
+typedef Format<4,  Field<ALPHA, 4,  0>>                       A4;
+
+/** @brief Encode a tile
+ *  @tparam     F      Pixel format
+ *  @param[in]  p      Tile pixel data
+ *  @param[in]  stride Pixel data stride
+ *  @param[out] out    Output buffer
+ */
+template<typename F>
+void encode_tile(const Pixel *p, size_t stride, uint8_t *out)
+{
+  uint8_t lum[64];
+  if(F::luminance)
+    luminance_tile(p, stride, lum);
+
+  // read the tile in Morton order
+  for(size_t k = 0; k < 64; ++k)
+  {
+    uint32_t v = F::pack(p[morton_offset(k, stride)],
+                         F::luminance ? lum[morton_offset(k, 8)] : 0);
+
+    if(F::bits_per_pixel == 4)
+    {
+      if(k & 1)
+        *out++ |= v << 4;
+      else
+        *out = v;
+    }
+    else
+    {
+      for(size_t i = 0; i < F::bits_per_pixel / 8; ++i)
+        *out++ = v >> (8*i);
+    }
+  }
+}
+
+/** @brief Decode a tile
+ *  @tparam     F      Pixel format
+ *  @param[in]  in     Encoded tile
+ *  @param[out] p      Tile pixel data
+ *  @param[in]  stride Pixel data stride
+ */
+template<typename F>
+void decode_tile(const uint8_t *in, Pixel *p, size_t stride)
+{
+  // write the tile in Morton order
+  for(size_t k = 0; k < 64; ++k)
+  {
+    uint32_t v = 0;
+
+    if(F::bits_per_pixel == 4)
+      v = in[k/2] >> (k & 1 ? 4 : 0);
+    else
+    {
+      for(size_t i = 0; i < F::bits_per_pixel / 8; ++i)
+        v |= static_cast<uint32_t>(*in++) << (8*i);
+    }
+
+    p[morton_offset(k, stride)] = F::unpack(v);
+  }
+}
+
+/** @brief Call a function for each tile of a band
+ *
+ *  @details
+ *  Tiles are numbered in raster order across an image whose width is the
+ *  stride; the function receives the offset of the tile's first pixel.
+ *
+ *  @param[in] stride Pixel data stride
+ *  @param[in] first  First tile of the band
+ *  @param[in] count  Number of tiles in the band
+ *  @param[in] tile   Function to call
+ */
+template<typename Tile>
+inline void for_each_tile(size_t stride, size_t first, size_t count, Tile tile)
+{
+  const size_t tiles_per_row = stride / 8;
+
+  for(size_t t = first; t < first + count; ++t)
+    tile((t / tiles_per_row) * 8 * stride + (t % tiles_per_row) * 8);
+}
+
+}
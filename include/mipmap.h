@@ -0,0 +1,44 @@
+/*------------------------------------------------------------------------------
+ * Copyright (c) 2017
+ *     Michael Theall (mtheall)
+ *
+ * This file is part of tex3ds.
+ *
+ * tex3ds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * tex3ds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with tex3ds.  If not, see <http://www.gnu.org/licenses/>.
+ *----------------------------------------------------------------------------*/
+/** @file mipmap.h
+ *  @brief Native mipmap generation
+ */
+#pragma once
+#include <vector>
+#include "bitmap.h"
+
+namespace mipmap
+{
+
+/** @brief Generate a mipmap chain with a 2x2 box filter in linear light
+ *
+ *  @details
+ *  Each level is built from the previous one rather than from the base
+ *  image. Color is averaged in linear light, weighted by alpha; alpha is
+ *  averaged as-is. Odd trailing rows/columns are dropped. The levels are
+ *  built straight from the staging buffers, without going through
+ *  ImageMagick.
+ *
+ *  @param[in] base Base level
+ *  @returns mipmap levels below the base level, largest first
+ */
+std::vector<Bitmap> box_linear(const Bitmap &base);
+
+}
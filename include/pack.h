@@ -0,0 +1,79 @@
+/*------------------------------------------------------------------------------
+ * Copyright (c) 2017
+ *     Michael Theall (mtheall)
+ *
+ * This file is part of tex3ds.
+ *
+ * tex3ds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * tex3ds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with tex3ds.  If not, see <http://www.gnu.org/licenses/>.
+ *----------------------------------------------------------------------------*/
+/** @file pack.h
+ *  @brief Tile packing kernels
+ */
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "bitmap.h"
+
+/** @namespace pack
+ *  @brief Tile packing namespace
+ *
+ *  @details
+ *  Packing kernels quantize and pack a whole 8x8 tile, reading it in Morton
+ *  order straight from the unswizzled bitmap. SIMD kernels
+ *  are selected at runtime from the features of the CPU; the scalar kernels
+ *  are the generic format.h encoders, which they must match bit for bit.
+ *
+ *  The luminance formats take the luminance from luminance_tile(), which is
+ *  table-driven and stays scalar; their kernels vectorize the Morton reorder
+ *  and the nibble packing around it.
+ */
+namespace pack
+{
+
+/** @brief Tile packing kernel
+ *  @param[in]  p      Tile pixel data
+ *  @param[in]  stride Pixel data stride
+ *  @param[out] out    Output buffer
+ */
+typedef void (*Kernel)(const Pixel *p, size_t stride, uint8_t *out);
+
+/** @brief Set of tile packing kernels */
+struct Kernels
+{
+  const char *name;     ///< Instruction set name
+  Kernel     rgb565;    ///< RGB565 (128 bytes per tile)
+  Kernel     rgba5551;  ///< RGBA5551 (128 bytes per tile)
+  Kernel     rgba4444;  ///< RGBA4444 (128 bytes per tile)
+  Kernel     la44;      ///< LA44 (64 bytes per tile)
+  Kernel     l4;        ///< L4 (32 bytes per tile)
+  Kernel     a4;        ///< A4 (32 bytes per tile)
+};
+
+/** @brief Get the best kernels supported by this CPU
+ *  @returns kernels
+ */
+const Kernels& kernels();
+
+/** @brief Get the scalar reference kernels
+ *  @returns kernels
+ */
+const Kernels& scalar_kernels();
+
+/** @brief Get every set of kernels supported by this CPU
+ *  @returns kernels, best first; the scalar kernels are always last
+ */
+std::vector<const Kernels*> supported_kernels();
+
+}
@@ -23,6 +23,7 @@
 #pragma once
 #include <algorithm>
 #include <cmath>
+#include "bitmap.h"
 #include "magick_compat.h"
 
 namespace
@@ -63,6 +64,44 @@ inline Magick::Quantum quantize(Magick::Quantum v)
   return bits_to_quantum<bits>(quantum_to_bits<bits>(v));
 }
 
+/** @brief Convert a staging channel to an n-bit value
+ *
+ *  @details
+ *  Equivalent to quantum_to_bits() on the Magick::Quantum the channel was
+ *  exported from.
+ *
+ *  @tparam    bits Number of bits for output value
+ *  @param[in] v    Channel to convert
+ *  @returns n-bit value
+ */
+template <int bits>
+inline uint8_t channel_to_bits(Channel v)
+{
+  return v >> (CHANNEL_BITS - bits);
+}
+
+/** @brief Convert an n-bit value to a staging channel
+ *  @tparam    bits Number of bits for input value
+ *  @param[in] v    Input n-bit value
+ *  @returns channel
+ */
+template <int bits>
+inline Channel bits_to_channel(uint8_t v)
+{
+  return v * CHANNEL_MAX / ((1<<bits)-1);
+}
+
+/** @brief Quantize a staging channel to its n-bit equivalent
+ *  @tparam    bits Number of significant bits
+ *  @param[in] v    Channel to quantize
+ *  @returns quantized channel
+ */
+template <int bits>
+inline Channel quantize_channel(Channel v)
+{
+  return bits_to_channel<bits>(channel_to_bits<bits>(v));
+}
+
 /** @brief sRGB Gamma inverse
  *  @param[in] v Value to get inverse gamma
  *  @return inverse gamma
@@ -85,26 +124,17 @@ inline double gamma(double v)
   return 1.055 * std::pow(v, 1.0/2.4) - 0.055;
 }
 
-/** @brief Get luminance from RGB with gamma correction
- *  @param[in] c Color to get luminance
- *  @return luminance
- */
-inline Magick::Quantum luminance(const Magick::Color &c)
-{
-  // ITU Recommendation BT.709
-  const double r = 0.212655;
-  const double g = 0.715158;
-  const double b = 0.072187;
-
-  using Magick::Quantum;
-
-  // Gamma correction
-  double v = gamma(r * gamma_inverse(static_cast<double>(quantumRed(c))   / QuantumRange)
-                 + g * gamma_inverse(static_cast<double>(quantumGreen(c)) / QuantumRange)
-                 + b * gamma_inverse(static_cast<double>(quantumBlue(c))  / QuantumRange));
-
-  // clamp
-  return std::max(0.0, std::min(1.0, v)) * QuantumRange;
 }
 
-}
+/** @brief Get the 8-bit luminance of an 8x8 tile with gamma correction
+ *
+ *  @details
+ *  The result is identical to quantizing the gamma-corrected BT.709
+ *  luminance of each pixel to 8 bits; lower precisions are a right shift of
+ *  it.
+ *
+ *  @param[in]  p      Tile pixel data
+ *  @param[in]  stride Pixel data stride
+ *  @param[out] out    Luminance of each pixel, row-major
+ */
+void luminance_tile(const Pixel *p, size_t stride, uint8_t *out);
@@ -46,6 +46,28 @@ namespace rg_etc1
    // pack_etc1_block() does not currently support "perceptual" colorspace metrics - it primarily optimizes for RGB RMSE.
    unsigned int pack_etc1_block(void* pETC1_block, const unsigned int* pSrc_pixels_rgba, etc1_pack_params& pack_params);
 
+   // Packs num_blocks 4x4 blocks, stored as separate arrays: pSrc_pixels_rgba holds 16 pixels per block, pETC1_blocks receives 8 bytes per block, and pErrors receives the squared error of each block.
+   // The output is identical to calling pack_etc1_block() on each block. Solid blocks are packed first in a single pass, then the rest share one optimizer, which saves per-call setup and keeps the lookup tables in cache.
+   // This function is thread safe, and does not dynamically allocate any memory.
+   void pack_etc1_blocks(void* pETC1_blocks, const unsigned int* pSrc_pixels_rgba, unsigned int* pErrors, unsigned int num_blocks, etc1_pack_params& pack_params);
+
+   // Runs the loops that build the precomputed lookup tables. inverse_lookup is indexed by [diff + (inten << 1) + (selector << 4)][color],
+   // and holds the best packed color in the low byte and its error in the high byte. quant5 is indexed by an 8-bit value plus 8.
+   void generate_etc1_tables(unsigned short inverse_lookup[64][256], unsigned char quant5[256 + 16]);
+
+   // Returns whether the precomputed lookup tables match generate_etc1_tables().
+   bool check_etc1_tables();
+
+   // Self-test of the selector kernels. Kernel set 0 is the one the packer uses on this CPU, and the last one is scalar.
+   unsigned int etc1_kernel_count();
+
+   // Returns the name of a kernel set, or nullptr if index is out of range.
+   const char* etc1_kernel_name(unsigned int index);
+
+   // Compares the selectors and errors of a kernel set against the scalar kernels on random, flat and two-color subblocks.
+   // Returns false on the first mismatch.
+   bool check_etc1_kernel(unsigned int index);
+
 } // namespace rg_etc1
 
 //------------------------------------------------------------------------------
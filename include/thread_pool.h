@@ -0,0 +1,134 @@
+/*------------------------------------------------------------------------------
+ * Copyright (c) 2017
+ *     Michael Theall (mtheall)
+ *
+ * This file is part of tex3ds.
+ *
+ * tex3ds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * tex3ds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with tex3ds.  If not, see <http://www.gnu.org/licenses/>.
+ *----------------------------------------------------------------------------*/
+/** @file thread_pool.h
+ *  @brief Worker thread pool
+ */
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/** @brief Worker thread pool
+ *
+ *  @details
+ *  The worker threads are started once and live until the pool is destroyed,
+ *  so submitting a batch of jobs does not pay for thread creation.
+ *
+ *  Each worker owns a job deque. Jobs submitted from outside the pool are
+ *  dealt round-robin onto the deques; jobs submitted by a worker go onto its
+ *  own deque. A worker takes jobs from the back of its own deque, and when it
+ *  runs dry it steals from the front of the other workers' deques, so uneven
+ *  jobs (e.g. ETC1 blocks) don't leave workers idle while others still have a
+ *  backlog.
+ */
+class ThreadPool
+{
+public:
+  /** @brief Job */
+  typedef std::function<void()> Job;
+
+  /** @brief Constructor
+   *  @param[in] num_threads Number of worker threads; 0 for one per hardware
+   *                         thread
+   */
+  explicit ThreadPool(size_t num_threads = 0);
+
+  /** @brief Destructor
+   *
+   *  @details
+   *  Waits for all outstanding jobs and joins the worker threads.
+   */
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool &other) = delete;
+  ThreadPool(ThreadPool &&other) = delete;
+  ThreadPool& operator=(const ThreadPool &other) = delete;
+  ThreadPool& operator=(ThreadPool &&other) = delete;
+
+  /** @brief Submit a job
+   *  @param[in] job Job to run on a worker thread
+   */
+  void submit(Job job);
+
+  /** @brief Wait for all submitted jobs to complete
+   *
+   *  @details
+   *  If any job threw an exception, the first one is rethrown here.
+   *
+   *  @note Must not be called from a job.
+   */
+  void wait();
+
+  /** @brief Get number of worker threads
+   *  @returns number of worker threads
+   */
+  size_t size() const
+  {
+    return workers.size();
+  }
+
+private:
+  /** @brief Per-worker job deque */
+  struct Queue
+  {
+    std::mutex      mutex; ///< Deque mutex
+    std::deque<Job> jobs;  ///< Queued jobs
+  };
+
+  /** @brief Worker thread entry point
+   *  @param[in] index Worker index
+   */
+  void work_thread(size_t index);
+
+  /** @brief Take a job from a worker's own deque
+   *  @param[in]  index Worker index
+   *  @param[out] job   Job taken
+   *  @returns whether a job was taken
+   */
+  bool pop(size_t index, Job &job);
+
+  /** @brief Steal a job from another worker's deque
+   *  @param[in]  index Worker index of the thief
+   *  @param[out] job   Job taken
+   *  @returns whether a job was taken
+   */
+  bool steal(size_t index, Job &job);
+
+  /** @brief Mark a job as complete */
+  void finish();
+
+  std::vector<std::thread>            workers;   ///< Worker threads
+  std::vector<std::unique_ptr<Queue>> queues;    ///< Per-worker job deques
+  std::mutex                          mutex;     ///< Sleep/wake mutex
+  std::condition_variable             work_cond; ///< Signalled when a job is queued
+  std::condition_variable             done_cond; ///< Signalled when all jobs complete
+  std::exception_ptr                  error;     ///< First exception thrown by a job
+  std::atomic<size_t>                 queued;    ///< Number of queued jobs
+  std::atomic<size_t>                 pending;   ///< Number of queued or running jobs
+  std::atomic<size_t>                 next;      ///< Next deque for outside submissions
+  bool                                quit;      ///< Whether workers should exit
+};
@@ -0,0 +1,76 @@
+/*------------------------------------------------------------------------------
+ * Copyright (c) 2017
+ *     Michael Theall (mtheall)
+ *
+ * This file is part of tex3ds.
+ *
+ * tex3ds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * tex3ds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with tex3ds.  If not, see <http://www.gnu.org/licenses/>.
+ *----------------------------------------------------------------------------*/
+/** @file bitmap.cpp
+ *  @brief Flat RGBA staging buffer
+ */
+#include <algorithm>
+#include "bitmap.h"
+
+namespace
+{
+
+/** @brief Cache line size */
+constexpr uintptr_t CACHE_LINE = 64;
+
+/** @brief Rows exported at a time; one row of tiles */
+constexpr size_t STRIP_ROWS = 8;
+
+}
+
+Bitmap::Bitmap(size_t width, size_t height)
+: w(width),
+  h(height),
+  storage(width * height + CACHE_LINE / sizeof(Pixel)),
+  a_min(0),
+  a_max(0)
+{
+  // align to the start of a cache line
+  uintptr_t addr = reinterpret_cast<uintptr_t>(storage.data());
+  addr = (addr + CACHE_LINE - 1) & ~(CACHE_LINE - 1);
+  pixels = reinterpret_cast<Pixel*>(addr);
+}
+
+Bitmap::Bitmap(Magick::Image img)
+: Bitmap(img.columns(), img.rows())
+{
+  a_min = CHANNEL_MAX;
+  a_max = 0;
+
+  for(size_t y = 0; y < h; y += STRIP_ROWS)
+  {
+    size_t rows = std::min(STRIP_ROWS, h - y);
+    Pixel  *p   = pixels + y*w;
+
+    img.write(0, y, w, rows, "RGBA", CHANNEL_STORAGE, p);
+
+    for(size_t i = 0; i < w*rows; ++i)
+    {
+      a_min = std::min(a_min, p[i].a);
+      a_max = std::max(a_max, p[i].a);
+    }
+  }
+}
+
+Magick::Image Bitmap::image() const
+{
+  Magick::Image img;
+  img.read(w, h, "RGBA", CHANNEL_STORAGE, pixels);
+  return img;
+}
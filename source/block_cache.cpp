@@ -0,0 +1,148 @@
+/*------------------------------------------------------------------------------
+ * Copyright (c) 2017
+ *     Michael Theall (mtheall)
+ *
+ * This file is part of tex3ds.
+ *
+ * tex3ds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * tex3ds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with tex3ds.  If not, see <http://www.gnu.org/licenses/>.
+ *----------------------------------------------------------------------------*/
+/** @file block_cache.cpp
+ *  @brief ETC1 block cache
+ */
+#include <cstring>
+#include <vector>
+#include "block_cache.h"
+
+constexpr size_t BlockCache::NUM_SHARDS;
+constexpr size_t BlockCache::MAX_SHARD_SIZE;
+constexpr size_t BlockCache::MIN_LOOKUPS;
+constexpr size_t BlockCache::HIT_RATE_DIVISOR;
+
+size_t BlockCache::KeyHash::operator()(const Key &key) const
+{
+  uint64_t hash = key.quality;
+
+  // mix in the block a word at a time
+  for(size_t i = 0; i < key.rgba.size(); i += sizeof(uint64_t))
+  {
+    uint64_t word;
+    std::memcpy(&word, key.rgba.data() + i, sizeof(word));
+
+    hash = (hash ^ word) * UINT64_C(0x9E3779B97F4A7C15);
+    hash ^= hash >> 32;
+  }
+
+  return hash;
+}
+
+void BlockCache::pack(uint8_t *out, const uint8_t *in, unsigned int *errors,
+                      size_t count, rg_etc1::etc1_pack_params &params,
+                      etc1::Packer packer)
+{
+  if(!active)
+  {
+    packer(out, reinterpret_cast<const unsigned int*>(in), errors, count,
+           params);
+    return;
+  }
+
+  // blocks that missed, in first-seen order; source[i] is the miss that
+  // block i is filled from, or SIZE_MAX if it hit
+  std::vector<Key>                         keys;
+  std::vector<Shard*>                      key_shards;
+  std::vector<size_t>                      source(count, SIZE_MAX);
+  std::unordered_map<Key, size_t, KeyHash> pending;
+
+  for(size_t i = 0; i < count; ++i)
+  {
+    Key key;
+    std::memcpy(key.rgba.data(), in + i*key.rgba.size(), key.rgba.size());
+    key.packer  = packer;
+    key.quality = params.m_quality;
+
+    // low bits pick the bucket inside the shard, so pick the shard from the top
+    size_t hash  = KeyHash()(key);
+    Shard  &shard = shards[(hash >> 26) % NUM_SHARDS];
+
+    {
+      std::lock_guard<std::mutex> lock(shard.mutex);
+
+      auto it = shard.map.find(key);
+      if(it != shard.map.end())
+      {
+        std::memcpy(out + i*8, it->second.block.data(), it->second.block.size());
+        errors[i] = it->second.error;
+        ++hit_count;
+        continue;
+      }
+    }
+
+    // repeated within this batch; packed along with its first occurrence
+    auto it = pending.emplace(key, keys.size());
+    if(!it.second)
+    {
+      source[i] = it.first->second;
+      ++hit_count;
+      continue;
+    }
+
+    source[i] = keys.size();
+    keys.emplace_back(key);
+    key_shards.emplace_back(&shard);
+    ++miss_count;
+  }
+
+  if(keys.empty())
+    return;
+
+  // pack outside of the locks; this is the expensive part
+  std::vector<uint8_t>      miss_in(keys.size() * 64);
+  std::vector<uint8_t>      miss_out(keys.size() * 8);
+  std::vector<unsigned int> miss_errors(keys.size());
+  for(size_t k = 0; k < keys.size(); ++k)
+    std::memcpy(&miss_in[k*64], keys[k].rgba.data(), keys[k].rgba.size());
+
+  packer(miss_out.data(), reinterpret_cast<const unsigned int*>(miss_in.data()),
+         miss_errors.data(), keys.size(), params);
+
+  for(size_t k = 0; k < keys.size(); ++k)
+  {
+    Value value;
+    std::memcpy(value.block.data(), &miss_out[k*8], value.block.size());
+    value.error = miss_errors[k];
+
+    std::lock_guard<std::mutex> lock(key_shards[k]->mutex);
+
+    // start the shard over rather than let it grow without bound
+    if(key_shards[k]->map.size() >= MAX_SHARD_SIZE)
+      key_shards[k]->map.clear();
+
+    key_shards[k]->map.emplace(keys[k], value);
+  }
+
+  // give up on the cache if blocks are not repeating
+  size_t hits    = hit_count;
+  size_t lookups = hits + miss_count;
+  if(lookups >= MIN_LOOKUPS && hits * HIT_RATE_DIVISOR < lookups)
+    active = false;
+
+  for(size_t i = 0; i < count; ++i)
+  {
+    if(source[i] != SIZE_MAX)
+    {
+      std::memcpy(out + i*8, &miss_out[source[i]*8], 8);
+      errors[i] = miss_errors[source[i]];
+    }
+  }
+}
@@ -0,0 +1,208 @@
+/*------------------------------------------------------------------------------
+ * Copyright (c) 2017
+ *     Michael Theall (mtheall)
+ *
+ * This file is part of tex3ds.
+ *
+ * tex3ds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * tex3ds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with tex3ds.  If not, see <http://www.gnu.org/licenses/>.
+ *----------------------------------------------------------------------------*/
+/** @file decode.cpp
+ *  @brief Image decoding routines
+ */
+#include "decode.h"
+#include "format.h"
+#include "quantum.h"
+#include "rg_etc1.h"
+
+namespace
+{
+
+/** @brief Decode a band with a format descriptor
+ *  @tparam     F      Pixel format
+ *  @param[in]  in     Encoded data for the first tile of the band
+ *  @param[out] p      Pixel data
+ *  @param[in]  stride Pixel data stride
+ *  @param[in]  first  First tile of the band
+ *  @param[in]  count  Number of tiles in the band
+ */
+template<typename F>
+void decode_band(const uint8_t *in, Pixel *p, size_t stride, size_t first,
+                 size_t count)
+{
+  format::for_each_tile(stride, first, count, [&](size_t offset)
+  {
+    format::decode_tile<F>(in, p + offset, stride);
+    in += F::tile_size;
+  });
+}
+
+/** @brief ETC1/ETC1A4 tile decoder
+ *  @param[in]  in     Encoded tile
+ *  @param[out] p      Tile pixel data
+ *  @param[in]  stride Pixel data stride
+ *  @param[in]  alpha  Whether the tile has alpha data
+ */
+void etc1_tile(const uint8_t *in, Pixel *p, size_t stride, bool alpha)
+{
+  for(size_t j = 0; j < 8; j += 4)
+  {
+    for(size_t i = 0; i < 8; i += 4)
+    {
+      const uint8_t *in_alpha = in;
+      uint8_t       in_block[8];
+      uint8_t       out_block[4*4*4];
+
+      // alpha block precedes etc1 block
+      if(alpha)
+        in += 8;
+
+      // etc1 block is stored little-endian; rg_etc1 wants big-endian
+      for(size_t k = 0; k < 8; ++k)
+        in_block[k] = in[8-k-1];
+      in += 8;
+
+      rg_etc1::unpack_etc1_block(in_block, reinterpret_cast<unsigned int*>(out_block));
+
+      for(size_t y = 0; y < 4; ++y)
+      {
+        for(size_t x = 0; x < 4; ++x)
+        {
+          Pixel &c = p[(j+y)*stride + i + x];
+
+          c.r = bits_to_channel<8>(out_block[y*16 + x*4 + 0]);
+          c.g = bits_to_channel<8>(out_block[y*16 + x*4 + 1]);
+          c.b = bits_to_channel<8>(out_block[y*16 + x*4 + 2]);
+
+          // decode 4bpp alpha; X/Y axes are swapped
+          if(alpha)
+            c.a = bits_to_channel<4>(in_alpha[2*x + y/2] >> (y & 1 ? 4 : 0) & 0xF);
+          else
+            c.a = CHANNEL_MAX;
+        }
+      }
+    }
+  }
+}
+
+/** @brief ETC1/ETC1A4 decoder
+ *  @param[in]  in     Encoded data for the first tile of the band
+ *  @param[out] p      Pixel data
+ *  @param[in]  stride Pixel data stride
+ *  @param[in]  first  First tile of the band
+ *  @param[in]  count  Number of tiles in the band
+ *  @param[in]  alpha  Whether the tiles have alpha data
+ */
+void etc1_common(const uint8_t *in, Pixel *p, size_t stride, size_t first,
+                 size_t count, bool alpha)
+{
+  // 8 bytes per 4x4 block, plus 8 for the alpha block
+  const size_t tile_size = alpha ? 64 : 32;
+
+  format::for_each_tile(stride, first, count, [&](size_t offset)
+  {
+    etc1_tile(in, p + offset, stride, alpha);
+    in += tile_size;
+  });
+}
+
+}
+
+namespace decode
+{
+
+void rgba8888(const uint8_t *in, Pixel *p, size_t stride, size_t first,
+              size_t count)
+{
+  decode_band<format::RGBA8888>(in, p, stride, first, count);
+}
+
+void rgb888(const uint8_t *in, Pixel *p, size_t stride, size_t first,
+            size_t count)
+{
+  decode_band<format::RGB888>(in, p, stride, first, count);
+}
+
+void rgb565(const uint8_t *in, Pixel *p, size_t stride, size_t first,
+            size_t count)
+{
+  decode_band<format::RGB565>(in, p, stride, first, count);
+}
+
+void rgba5551(const uint8_t *in, Pixel *p, size_t stride, size_t first,
+              size_t count)
+{
+  decode_band<format::RGBA5551>(in, p, stride, first, count);
+}
+
+void rgba4444(const uint8_t *in, Pixel *p, size_t stride, size_t first,
+              size_t count)
+{
+  decode_band<format::RGBA4444>(in, p, stride, first, count);
+}
+
+void la88(const uint8_t *in, Pixel *p, size_t stride, size_t first,
+          size_t count)
+{
+  decode_band<format::LA88>(in, p, stride, first, count);
+}
+
+void hilo88(const uint8_t *in, Pixel *p, size_t stride, size_t first,
+            size_t count)
+{
+  decode_band<format::HILO88>(in, p, stride, first, count);
+}
+
+void l8(const uint8_t *in, Pixel *p, size_t stride, size_t first,
+        size_t count)
+{
+  decode_band<format::L8>(in, p, stride, first, count);
+}
+
+void a8(const uint8_t *in, Pixel *p, size_t stride, size_t first,
+        size_t count)
+{
+  decode_band<format::A8>(in, p, stride, first, count);
+}
+
+void la44(const uint8_t *in, Pixel *p, size_t stride, size_t first,
+          size_t count)
+{
+  decode_band<format::LA44>(in, p, stride, first, count);
+}
+
+void l4(const uint8_t *in, Pixel *p, size_t stride, size_t first,
+        size_t count)
+{
+  decode_band<format::L4>(in, p, stride, first, count);
+}
+
+void a4(const uint8_t *in, Pixel *p, size_t stride, size_t first,
+        size_t count)
+{
+  decode_band<format::A4>(in, p, stride, first, count);
+}
+
+void etc1(const uint8_t *in, Pixel *p, size_t stride, size_t first,
+          size_t count)
+{
+  etc1_common(in, p, stride, first, count, false);
+}
+
+void etc1a4(const uint8_t *in, Pixel *p, size_t stride, size_t first,
+            size_t count)
+{
+  etc1_common(in, p, stride, first, count, true);
+}
+
+}
@@ -20,476 +20,293 @@
 /** @file encode.cpp
  *  @brief Image encoding routines
  */
+#include <algorithm>
+#include <cstring>
+#include <vector>
 #include "encode.h"
+#include "format.h"
+#include "pack.h"
 #include "quantum.h"
 #include "rg_etc1.h"
 
 namespace
 {
 
-/** @brief ETC1/ETC1A4 encoder
- *  @param[in] work  Work unit
- *  @param[in] alpha Whether to output alpha data
+/** @brief Encode a band with a format descriptor
+ *  @tparam    F    Pixel format
+ *  @param[in] work Work unit
  */
-void etc1_common(encode::WorkUnit &work, bool alpha)
+template<typename F>
+void encode_band(encode::WorkUnit &work)
 {
-  rg_etc1::etc1_pack_params params;
-  params.clear();
-  params.m_quality = work.etc1_quality;
-
-  for(size_t j = 0; j < 8; j += 4)
+  format::for_each_tile(work.stride, work.first, work.count, [&](size_t offset)
   {
-    for(size_t i = 0; i < 8; i += 4)
-    {
-      uint8_t in_block[4*4*4];
-      uint8_t out_block[8];
-      uint8_t out_alpha[8] = {0,0,0,0,0,0,0,0};
-
-      if(work.output || work.preview)
-      {
-        // iterate each 4x4 subblock
-        for(size_t y = 0; y < 4; ++y)
-        {
-          for(size_t x = 0; x < 4; ++x)
-          {
-            Magick::Color c = work.p[(j+y)*work.stride + i + x];
-
-            in_block[y*16 + x*4 + 0] = quantum_to_bits<8>(quantumRed(c));
-            in_block[y*16 + x*4 + 1] = quantum_to_bits<8>(quantumGreen(c));
-            in_block[y*16 + x*4 + 2] = quantum_to_bits<8>(quantumBlue(c));
-            in_block[y*16 + x*4 + 3] = 0xFF;
-
-            if(alpha && work.output)
-            {
-              // encode 4bpp alpha; X/Y axes are swapped
-              if(y & 1)
-                out_alpha[2*x + y/2] |= (quantum_to_bits<4>(quantumAlpha(c)) << 4);
-              else
-                out_alpha[2*x + y/2] |= (quantum_to_bits<4>(quantumAlpha(c)) << 0);
-            }
-          }
-        }
-
-        // encode etc1 block
-        rg_etc1::pack_etc1_block(out_block, reinterpret_cast<unsigned int*>(in_block), params);
-      }
-
-      if(work.output)
-      {
-        // alpha block precedes etc1 block
-        if(alpha)
-        {
-          for(size_t i = 0; i < 8; ++i)
-            work.result.push_back(out_alpha[i]);
-        }
-
-        // rg_etc1 outputs in big-endian; convert to little-endian
-        for(size_t i = 0; i < 8; ++i)
-          work.result.push_back(out_block[8-i-1]);
-      }
-
-      if(work.preview)
-      {
-        rg_etc1::unpack_etc1_block(out_block, reinterpret_cast<unsigned int*>(in_block));
-
-        for(size_t y = 0; y < 4; ++y)
-        {
-          for(size_t x = 0; x < 4; ++x)
-          {
-            Magick::Color c = work.p[(j+y)*work.stride + i + x];
-
-            quantumRed(c,   bits_to_quantum<8>(in_block[y*16 + x*4 + 0]));
-            quantumGreen(c, bits_to_quantum<8>(in_block[y*16 + x*4 + 1]));
-            quantumBlue(c,  bits_to_quantum<8>(in_block[y*16 + x*4 + 2]));
-
-            if(alpha)
-              quantumAlpha(c, quantize<4>(quantumAlpha(c)));
-            else
-            {
-              using Magick::Quantum;
-              quantumAlpha(c, QuantumRange);
-            }
-
-            work.p[(j+y)*work.stride + i + x] = c;
-          }
-        }
-      }
-    }
-  }
+    format::encode_tile<F>(work.p + offset, work.stride, work.out);
+    work.out += F::tile_size;
+  });
 }
 
-}
-
-namespace encode
-{
-
-void rgba8888(WorkUnit &work)
+/** @brief Encode a band with a packing kernel
+ *  @param[in] work      Work unit
+ *  @param[in] kernel    Packing kernel
+ *  @param[in] tile_size Bytes per tile
+ */
+void pack_band(encode::WorkUnit &work, pack::Kernel kernel, size_t tile_size)
 {
-  for(size_t j = 0; j < 8; ++j)
+  format::for_each_tile(work.stride, work.first, work.count, [&](size_t offset)
   {
-    for(size_t i = 0; i < 8; ++i)
-    {
-      Magick::Color c = work.p[j*work.stride + i];
-
-      if(work.output)
-      {
-        work.result.push_back(quantum_to_bits<8>(quantumAlpha(c)));
-        work.result.push_back(quantum_to_bits<8>(quantumBlue(c)));
-        work.result.push_back(quantum_to_bits<8>(quantumGreen(c)));
-        work.result.push_back(quantum_to_bits<8>(quantumRed(c)));
-      }
+    kernel(work.p + offset, work.stride, work.out);
+    work.out += tile_size;
+  });
+}
 
-      if(work.preview)
-      {
-        quantumRed(c,   quantize<8>(quantumRed(c)));
-        quantumGreen(c, quantize<8>(quantumGreen(c)));
-        quantumBlue(c,  quantize<8>(quantumBlue(c)));
-        quantumAlpha(c, quantize<8>(quantumAlpha(c)));
+/** @brief Pack ETC1 blocks
+ *  @param[out] out    Packed ETC1 blocks (big-endian)
+ *  @param[in]  in     4x4 RGBA blocks
+ *  @param[out] errors Squared error of each packed block
+ *  @param[in]  count  Number of blocks
+ *  @param[in]  params ETC1 parameters
+ *  @param[in]  packer ETC1 block packer
+ *  @param[in]  cache  ETC1 block cache; may be null
+ */
+void etc1_pack(uint8_t *out, const uint8_t *in, unsigned int *errors,
+               size_t count, rg_etc1::etc1_pack_params &params,
+               etc1::Packer packer, BlockCache *cache)
+{
+  if(cache)
+    return cache->pack(out, in, errors, count, params, packer);
 
-        work.p[j*work.stride + i] = c;
-      }
-    }
-  }
+  packer(out, reinterpret_cast<const unsigned int*>(in), errors, count, params);
 }
 
-void rgb888(WorkUnit &work)
+/** @brief Pack ETC1 blocks at the lowest quality that meets an error target
+ *
+ *  @details
+ *  The blocks are packed at low quality, and only the blocks whose error is
+ *  above the target are packed again at medium and then high quality. The
+ *  packing with the lowest error is kept.
+ *
+ *  @param[out] out    Packed ETC1 blocks (big-endian)
+ *  @param[in]  in     4x4 RGBA blocks
+ *  @param[out] errors Squared error of each packed block
+ *  @param[in]  count  Number of blocks
+ *  @param[in]  params ETC1 parameters
+ *  @param[in]  packer ETC1 block packer
+ *  @param[in]  cache  ETC1 block cache; may be null
+ *  @param[in]  target Squared error target
+ */
+void etc1_pack_adaptive(uint8_t *out, const uint8_t *in, unsigned int *errors,
+                        size_t count, rg_etc1::etc1_pack_params &params,
+                        etc1::Packer packer, BlockCache *cache,
+                        unsigned int target)
 {
-  for(size_t j = 0; j < 8; ++j)
+  params.m_quality = rg_etc1::cLowQuality;
+  etc1_pack(out, in, errors, count, params, packer, cache);
+
+  std::vector<size_t>       retry;
+  std::vector<uint8_t>      trial_in;
+  std::vector<uint8_t>      trial_out;
+  std::vector<unsigned int> trial_errors;
+
+  for(auto quality: { rg_etc1::cMediumQuality, rg_etc1::cHighQuality })
   {
-    for(size_t i = 0; i < 8; ++i)
+    retry.clear();
+    for(size_t i = 0; i < count; ++i)
     {
-      Magick::Color c = work.p[j*work.stride + i];
+      if(errors[i] > target)
+        retry.push_back(i);
+    }
 
-      if(work.output)
-      {
-        work.result.push_back(quantum_to_bits<8>(quantumBlue(c)));
-        work.result.push_back(quantum_to_bits<8>(quantumGreen(c)));
-        work.result.push_back(quantum_to_bits<8>(quantumRed(c)));
-      }
+    if(retry.empty())
+      break;
 
-      if(work.preview)
-      {
-        using Magick::Quantum;
+    trial_in.resize(retry.size() * 64);
+    trial_out.resize(retry.size() * 8);
+    trial_errors.resize(retry.size());
+    for(size_t k = 0; k < retry.size(); ++k)
+      std::memcpy(&trial_in[k*64], in + retry[k]*64, 64);
 
-        quantumRed(c,   quantize<8>(quantumRed(c)));
-        quantumGreen(c, quantize<8>(quantumGreen(c)));
-        quantumBlue(c,  quantize<8>(quantumBlue(c)));
-        quantumAlpha(c, QuantumRange);
+    params.m_quality = quality;
+    etc1_pack(trial_out.data(), trial_in.data(), trial_errors.data(),
+              retry.size(), params, packer, cache);
 
-        work.p[j*work.stride + i] = c;
+    for(size_t k = 0; k < retry.size(); ++k)
+    {
+      if(trial_errors[k] < errors[retry[k]])
+      {
+        std::memcpy(out + retry[k]*8, &trial_out[k*8], 8);
+        errors[retry[k]] = trial_errors[k];
       }
     }
   }
 }
 
-void rgba5551(WorkUnit &work)
+/** @brief Gather a 4x4 ETC1 block
+ *  @param[in]  p         Block pixel data
+ *  @param[in]  stride    Pixel data stride
+ *  @param[out] in_block  RGBA block for rg_etc1
+ *  @param[out] out_alpha 4bpp alpha block; may be null
+ */
+void etc1_block(const Pixel *p, size_t stride, uint8_t *in_block,
+                uint8_t *out_alpha)
 {
-  for(size_t j = 0; j < 8; ++j)
+  for(size_t y = 0; y < 4; ++y)
   {
-    for(size_t i = 0; i < 8; ++i)
+    for(size_t x = 0; x < 4; ++x)
     {
-      Magick::Color c = work.p[j*work.stride + i];
-
-      if(work.output)
-      {
-        uint16_t v = (quantum_to_bits<5>(quantumRed(c))   << 11)
-                   | (quantum_to_bits<5>(quantumGreen(c)) <<  6)
-                   | (quantum_to_bits<5>(quantumBlue(c))  <<  1)
-                   | (quantum_to_bits<1>(quantumAlpha(c)) <<  0);
+      const Pixel &c = p[y*stride + x];
 
-        work.result.push_back(v >> 0);
-        work.result.push_back(v >> 8);
-      }
+      in_block[y*16 + x*4 + 0] = channel_to_bits<8>(c.r);
+      in_block[y*16 + x*4 + 1] = channel_to_bits<8>(c.g);
+      in_block[y*16 + x*4 + 2] = channel_to_bits<8>(c.b);
+      in_block[y*16 + x*4 + 3] = 0xFF;
 
-      if(work.preview)
+      if(out_alpha)
       {
-        quantumRed(c,   quantize<5>(quantumRed(c)));
-        quantumGreen(c, quantize<5>(quantumGreen(c)));
-        quantumBlue(c,  quantize<5>(quantumBlue(c)));
-        quantumAlpha(c, quantize<1>(quantumAlpha(c)));
-
-        work.p[j*work.stride + i] = c;
+        // encode 4bpp alpha; X/Y axes are swapped
+        if(y & 1)
+          out_alpha[2*x + y/2] |= (channel_to_bits<4>(c.a) << 4);
+        else
+          out_alpha[2*x + y/2] |= (channel_to_bits<4>(c.a) << 0);
       }
     }
   }
 }
 
-void rgb565(WorkUnit &work)
+/** @brief ETC1/ETC1A4 encoder
+ *
+ *  @details
+ *  Every block of the band is gathered first and packed in one batch.
+ *
+ *  @param[in] work  Work unit
+ *  @param[in] alpha Whether to output alpha data
+ */
+void etc1_common(encode::WorkUnit &work, bool alpha)
 {
-  for(size_t j = 0; j < 8; ++j)
+  const size_t num_blocks = work.count * 4;
+
+  std::vector<uint8_t>      in(num_blocks * 64);
+  std::vector<uint8_t>      packed(num_blocks * 8);
+  std::vector<uint8_t>      alphas(alpha ? num_blocks * 8 : 0, 0);
+  std::vector<unsigned int> errors(num_blocks);
+
+  // gather each 4x4 subblock of each tile
+  size_t block = 0;
+  format::for_each_tile(work.stride, work.first, work.count, [&](size_t offset)
   {
-    for(size_t i = 0; i < 8; ++i)
+    for(size_t j = 0; j < 8; j += 4)
     {
-      Magick::Color c = work.p[j*work.stride + i];
-
-      if(work.output)
+      for(size_t i = 0; i < 8; i += 4)
       {
-        uint16_t v = (quantum_to_bits<5>(quantumRed(c))   << 11)
-                   | (quantum_to_bits<6>(quantumGreen(c)) <<  5)
-                   | (quantum_to_bits<5>(quantumBlue(c))  <<  0);
-
-        work.result.push_back(v >> 0);
-        work.result.push_back(v >> 8);
+        etc1_block(work.p + offset + j*work.stride + i, work.stride,
+                   &in[block * 64], alpha ? &alphas[block * 8] : nullptr);
+        ++block;
       }
+    }
+  });
 
-      if(work.preview)
-      {
-        using Magick::Quantum;
+  // encode etc1 blocks
+  rg_etc1::etc1_pack_params params;
+  params.clear();
+  params.m_quality = work.etc1_quality;
 
-        quantumRed(c,   quantize<5>(quantumRed(c)));
-        quantumGreen(c, quantize<6>(quantumGreen(c)));
-        quantumBlue(c,  quantize<5>(quantumBlue(c)));
-        quantumAlpha(c, QuantumRange);
+  if(work.etc1_target_error)
+  {
+    etc1_pack_adaptive(packed.data(), in.data(), errors.data(), num_blocks,
+                       params, work.etc1_packer, work.etc1_cache,
+                       work.etc1_target_error);
+  }
+  else
+  {
+    etc1_pack(packed.data(), in.data(), errors.data(), num_blocks, params,
+              work.etc1_packer, work.etc1_cache);
+  }
 
-        work.p[j*work.stride + i] = c;
-      }
-    }
+  if(work.etc1_errors)
+  {
+    work.etc1_errors = std::copy(errors.begin(), errors.end(),
+                                 work.etc1_errors);
   }
-}
 
-void rgba4444(WorkUnit &work)
-{
-  for(size_t j = 0; j < 8; ++j)
+  uint8_t *&out = work.out;
+  for(size_t block = 0; block < num_blocks; ++block)
   {
-    for(size_t i = 0; i < 8; ++i)
+    // alpha block precedes etc1 block
+    if(alpha)
     {
-      Magick::Color c = work.p[j*work.stride + i];
+      for(size_t i = 0; i < 8; ++i)
+        *out++ = alphas[block*8 + i];
+    }
 
-      if(work.output)
-      {
-        uint16_t v = (quantum_to_bits<4>(quantumRed(c))   << 12)
-                   | (quantum_to_bits<4>(quantumGreen(c)) <<  8)
-                   | (quantum_to_bits<4>(quantumBlue(c))  <<  4)
-                   | (quantum_to_bits<4>(quantumAlpha(c)) <<  0);
+    // rg_etc1 outputs in big-endian; convert to little-endian
+    for(size_t i = 0; i < 8; ++i)
+      *out++ = packed[block*8 + 8-i-1];
+  }
+}
 
-        work.result.push_back(v >> 0);
-        work.result.push_back(v >> 8);
-      }
+}
 
-      if(work.preview)
-      {
-        quantumRed(c,   quantize<4>(quantumRed(c)));
-        quantumGreen(c, quantize<4>(quantumGreen(c)));
-        quantumBlue(c,  quantize<4>(quantumBlue(c)));
-        quantumAlpha(c, quantize<4>(quantumAlpha(c)));
+namespace encode
+{
 
-        work.p[j*work.stride + i] = c;
-      }
-    }
-  }
+void rgba8888(WorkUnit &work)
+{
+  encode_band<format::RGBA8888>(work);
 }
 
-void la88(WorkUnit &work)
+void rgb888(WorkUnit &work)
 {
-  for(size_t j = 0; j < 8; ++j)
-  {
-    for(size_t i = 0; i < 8; ++i)
-    {
-      Magick::Color c = work.p[j*work.stride + i];
+  encode_band<format::RGB888>(work);
+}
 
-      if(work.output)
-      {
-        work.result.push_back(quantum_to_bits<8>(quantumAlpha(c)));
-        work.result.push_back(quantum_to_bits<8>(luminance(c)));
-      }
+void rgba5551(WorkUnit &work)
+{
+  pack_band(work, pack::kernels().rgba5551, format::RGBA5551::tile_size);
+}
 
-      if(work.preview)
-      {
-        Magick::Quantum l = quantize<8>(luminance(c));
+void rgb565(WorkUnit &work)
+{
+  pack_band(work, pack::kernels().rgb565, format::RGB565::tile_size);
+}
 
-        quantumRed(c,   l);
-        quantumGreen(c, l);
-        quantumBlue(c,  l);
-        quantumAlpha(c, quantize<8>(quantumAlpha(c)));
+void rgba4444(WorkUnit &work)
+{
+  pack_band(work, pack::kernels().rgba4444, format::RGBA4444::tile_size);
+}
 
-        work.p[j*work.stride + i] = c;
-      }
-    }
-  }
+void la88(WorkUnit &work)
+{
+  encode_band<format::LA88>(work);
 }
 
 void hilo88(WorkUnit &work)
 {
-  for(size_t j = 0; j < 8; ++j)
-  {
-    for(size_t i = 0; i < 8; ++i)
-    {
-      Magick::Color c = work.p[j*work.stride + i];
-
-      if(work.output)
-      {
-        work.result.push_back(quantum_to_bits<8>(quantumGreen(c)));
-        work.result.push_back(quantum_to_bits<8>(quantumRed(c)));
-      }
-
-      if(work.preview)
-      {
-        using Magick::Quantum;
-
-        quantumRed(c,   quantize<8>(quantumRed(c)));
-        quantumGreen(c, quantize<8>(quantumGreen(c)));
-        quantumBlue(c,  0);
-        quantumAlpha(c, QuantumRange);
-
-        work.p[j*work.stride + i] = c;
-      }
-    }
-  }
+  encode_band<format::HILO88>(work);
 }
 
 void l8(WorkUnit &work)
 {
-  for(size_t j = 0; j < 8; ++j)
-  {
-    for(size_t i = 0; i < 8; ++i)
-    {
-      Magick::Color c = work.p[j*work.stride + i];
-
-      if(work.output)
-        work.result.push_back(quantum_to_bits<8>(luminance(c)));
-
-      if(work.preview)
-      {
-        Magick::Quantum l = quantize<8>(luminance(c));
-
-        using Magick::Quantum;
-
-        quantumRed(c,   l);
-        quantumGreen(c, l);
-        quantumBlue(c,  l);
-        quantumAlpha(c, QuantumRange);
-
-        work.p[j*work.stride + i] = c;
-      }
-    }
-  }
+  encode_band<format::L8>(work);
 }
 
 void a8(WorkUnit &work)
 {
-  for(size_t j = 0; j < 8; ++j)
-  {
-    for(size_t i = 0; i < 8; ++i)
-    {
-      Magick::Color c = work.p[j*work.stride + i];
-
-      if(work.output)
-        work.result.push_back(quantum_to_bits<8>(quantumAlpha(c)));
-
-      if(work.preview)
-      {
-        quantumRed(c,   0);
-        quantumGreen(c, 0);
-        quantumBlue(c,  0);
-        quantumAlpha(c, quantize<8>(quantumAlpha(c)));
-
-        work.p[j*work.stride + i] = c;
-      }
-    }
-  }
+  encode_band<format::A8>(work);
 }
 
 void la44(WorkUnit &work)
 {
-  for(size_t j = 0; j < 8; ++j)
-  {
-    for(size_t i = 0; i < 8; ++i)
-    {
-      Magick::Color c = work.p[j*work.stride + i];
-
-      if(work.output)
-      {
-        work.result.push_back((quantum_to_bits<4>(luminance(c))    << 4)
-                            | (quantum_to_bits<4>(quantumAlpha(c)) << 0));
-      }
-
-      if(work.preview)
-      {
-        Magick::Quantum l = quantize<4>(luminance(c));
-
-        quantumRed(c,   l);
-        quantumGreen(c, l);
-        quantumBlue(c,  l);
-        quantumAlpha(c, quantize<4>(quantumAlpha(c)));
-
-        work.p[j*work.stride + i] = c;
-      }
-    }
-  }
+  pack_band(work, pack::kernels().la44, format::LA44::tile_size);
 }
 
 void l4(WorkUnit &work)
 {
-  for(size_t j = 0; j < 8; ++j)
-  {
-    for(size_t i = 0; i < 8; ++i)
-    {
-      Magick::Color c1 = work.p[j*work.stride + i+0],
-                    c2 = work.p[j*work.stride + i+1];
-
-      if(work.output)
-      {
-        work.result.push_back((quantum_to_bits<4>(luminance(c2)) << 4)
-                            | (quantum_to_bits<4>(luminance(c1)) << 0));
-      }
-
-      if(work.preview)
-      {
-        Magick::Quantum l = quantize<4>(luminance(c1));
-
-        using Magick::Quantum;
-
-        quantumRed(c1,   l);
-        quantumGreen(c1, l);
-        quantumBlue(c1,  l);
-        quantumAlpha(c1, QuantumRange);
-
-        l = quantize<4>(luminance(c2));
-
-        quantumRed(c2,   l);
-        quantumGreen(c2, l);
-        quantumBlue(c2,  l);
-        quantumAlpha(c2, QuantumRange);
-
-        work.p[j*work.stride + i+0] = c1;
-        work.p[j*work.stride + i+1] = c2;
-      }
-    }
-  }
+  pack_band(work, pack::kernels().l4, format::L4::tile_size);
 }
 
 void a4(WorkUnit &work)
 {
-  for(size_t j = 0; j < 8; ++j)
-  {
-    for(size_t i = 0; i < 8; ++i)
-    {
-      Magick::Color c1 = work.p[j*work.stride + i+0],
-                    c2 = work.p[j*work.stride + i+1];
-
-      if(work.output)
-      {
-        work.result.push_back((quantum_to_bits<4>(quantumAlpha(c2)) << 4)
-                            | (quantum_to_bits<4>(quantumAlpha(c1)) << 0));
-      }
-
-      if(work.preview)
-      {
-        quantumRed(c1,   0);
-        quantumGreen(c1, 0);
-        quantumBlue(c1,  0);
-        quantumAlpha(c1, quantize<4>(quantumAlpha(c1)));
-
-        quantumRed(c2,   0);
-        quantumGreen(c2, 0);
-        quantumBlue(c2,  0);
-        quantumAlpha(c2, quantize<4>(quantumAlpha(c2)));
-
-        work.p[j*work.stride + i+0] = c1;
-        work.p[j*work.stride + i+1] = c2;
-      }
-    }
-  }
+  pack_band(work, pack::kernels().a4, format::A4::tile_size);
 }
 
 void etc1(WorkUnit &work)
@@ -502,4 +319,37 @@ void etc1a4(WorkUnit &work)
   etc1_common(work, true);
 }
 
+void etc1_refine(const Pixel *p, size_t stride, size_t block, uint8_t *out,
+                 uint32_t &error, bool alpha, BlockCache *cache)
+{
+  uint8_t in_block[4*4*4];
+
+  // blocks are encoded in raster order; the alpha block precedes each one
+  p   += (block / 2) * 4 * stride + (block % 2) * 4;
+  out += block * (alpha ? 16 : 8) + (alpha ? 8 : 0);
+
+  etc1_block(p, stride, in_block, nullptr);
+
+  rg_etc1::etc1_pack_params params;
+  params.clear();
+
+  for(auto quality: { rg_etc1::cMediumQuality, rg_etc1::cHighQuality })
+  {
+    uint8_t      out_block[8];
+    unsigned int trial_error;
+    params.m_quality = quality;
+    etc1_pack(out_block, in_block, &trial_error, 1, params,
+              rg_etc1::pack_etc1_blocks, cache);
+
+    if(trial_error < error)
+    {
+      // rg_etc1 outputs in big-endian; convert to little-endian
+      for(size_t i = 0; i < 8; ++i)
+        out[i] = out_block[8-i-1];
+
+      error = trial_error;
+    }
+  }
+}
+
 }
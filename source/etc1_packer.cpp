@@ -0,0 +1,301 @@
+/*------------------------------------------------------------------------------
+ * Copyright (c) 2017
+ *     Michael Theall (mtheall)
+ *
+ * This file is part of tex3ds.
+ *
+ * tex3ds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * tex3ds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with tex3ds.  If not, see <http://www.gnu.org/licenses/>.
+ *----------------------------------------------------------------------------*/
+/** @file etc1_packer.cpp
+ *  @brief ETC1 block packers
+ */
+#include <algorithm>
+#include <cstdlib>
+#include <cstdint>
+#include "etc1_packer.h"
+
+namespace
+{
+
+/** @brief ETC1 intensity modifier tables, indexed by selector */
+const int modifiers[8][4] =
+{
+  {  2,   8,  -2,   -8, },
+  {  5,  17,  -5,  -17, },
+  {  9,  29,  -9,  -29, },
+  { 13,  42, -13,  -42, },
+  { 18,  60, -18,  -60, },
+  { 24,  80, -24,  -80, },
+  { 33, 106, -33, -106, },
+  { 47, 183, -47, -183, },
+};
+
+/** @brief Subblock pixels */
+struct Subblock
+{
+  const uint8_t *px[8];  ///< Pixels (RGBA bytes)
+  unsigned int  pos[8];  ///< Selector bit of each pixel
+  int           sum[3];  ///< Sum of each colour component
+};
+
+/** @brief Clamp a colour component
+ *  @param[in] v Value to clamp
+ *  @returns clamped value
+ */
+inline int clamp8(int v)
+{
+  return std::min(std::max(v, 0), 255);
+}
+
+/** @brief Expand a base colour component to 8 bits
+ *  @param[in] v    Colour component
+ *  @param[in] diff Whether v is 5-bit (differential mode) rather than 4-bit
+ *  @returns expanded colour component
+ */
+inline int expand(int v, bool diff)
+{
+  return diff ? (v << 3) | (v >> 2) : (v << 4) | v;
+}
+
+/** @brief Estimate the best intensity table for a base colour
+ *
+ *  @details
+ *  A modifier m moves all three components of the base colour by m, so,
+ *  ignoring clamping, the error for a pixel is |p-base|^2 - 2ms + 3m^2 where
+ *  s is the sum of the component differences p-base. The best selector only
+ *  depends on s, and since the tables are symmetric, only on |s|.
+ *
+ *  @param[in]  sub      Subblock
+ *  @param[in]  base     Base colour
+ *  @param[out] table    Best intensity table
+ *  @returns estimated squared error
+ */
+int estimate_subblock(const Subblock &sub, const int base[3],
+                      unsigned int &table)
+{
+  int sq = 0, s[8];
+  for(unsigned int i = 0; i < 8; ++i)
+  {
+    const int dr = sub.px[i][0] - base[0];
+    const int dg = sub.px[i][1] - base[1];
+    const int db = sub.px[i][2] - base[2];
+
+    sq  += dr*dr + dg*dg + db*db;
+    s[i] = std::abs(dr + dg + db);
+  }
+
+  int best = INT32_MAX;
+  for(unsigned int t = 0; t < 8; ++t)
+  {
+    const int a = modifiers[t][0], b = modifiers[t][1];
+
+    // nearest modifier to |s|/3; the threshold is the midpoint
+    int estimate = 0;
+    for(unsigned int i = 0; i < 8; ++i)
+    {
+      const int m = 2*s[i] > 3*(a+b) ? b : a;
+      estimate += 3*m*m - 2*m*s[i];
+    }
+
+    if(estimate < best)
+    {
+      best  = estimate;
+      table = t;
+    }
+  }
+
+  return sq + best;
+}
+
+/** @brief Choose the selectors for a base colour and intensity table
+ *  @param[in]  sub       Subblock
+ *  @param[in]  base      Base colour
+ *  @param[in]  table     Intensity table
+ *  @param[out] selectors Selector of each pixel
+ *  @returns squared error
+ */
+unsigned int fit_subblock(const Subblock &sub, const int base[3],
+                          unsigned int table, uint8_t selectors[8])
+{
+  int colors[4][3];
+  for(unsigned int k = 0; k < 4; ++k)
+  {
+    for(unsigned int c = 0; c < 3; ++c)
+      colors[k][c] = clamp8(base[c] + modifiers[table][k]);
+  }
+
+  unsigned int error = 0;
+  for(unsigned int i = 0; i < 8; ++i)
+  {
+    unsigned int best_k = 0, best_e = UINT32_MAX;
+    for(unsigned int k = 0; k < 4; ++k)
+    {
+      const int dr = colors[k][0] - sub.px[i][0];
+      const int dg = colors[k][1] - sub.px[i][1];
+      const int db = colors[k][2] - sub.px[i][2];
+
+      const unsigned int e = dr*dr + dg*dg + db*db;
+      if(e < best_e)
+      {
+        best_e = e;
+        best_k = k;
+      }
+    }
+
+    selectors[i] = best_k;
+    error       += best_e;
+  }
+
+  return error;
+}
+
+/** @brief Pack one block
+ *
+ *  @details
+ *  Both flips are ranked by estimate_subblock(); only the better one has its
+ *  selectors and error computed exactly.
+ *
+ *  @param[out] out Packed ETC1 block (big-endian)
+ *  @param[in]  in  4x4 RGBA block
+ *  @returns squared error of the packed block
+ */
+unsigned int draft_block(uint8_t *out, const uint8_t *in)
+{
+  Subblock     subs[2][2];
+  int          best_estimate = INT32_MAX;
+  unsigned int best_flip = 0, best_diff = 0, best_table[2] = { 0, 0 };
+  int          best_color[2][3];
+
+  for(unsigned int flip = 0; flip < 2; ++flip)
+  {
+    // gather the subblocks: side by side 2x4 halves, or 4x2 halves if flipped
+    Subblock     (&sub)[2] = subs[flip];
+    unsigned int n[2] = { 0, 0 };
+
+    for(unsigned int k = 0; k < 2; ++k)
+      sub[k].sum[0] = sub[k].sum[1] = sub[k].sum[2] = 0;
+
+    for(unsigned int y = 0; y < 4; ++y)
+    {
+      for(unsigned int x = 0; x < 4; ++x)
+      {
+        const unsigned int k = flip ? y / 2 : x / 2;
+        const uint8_t      *p = in + y*16 + x*4;
+
+        sub[k].px[n[k]]  = p;
+        sub[k].pos[n[k]] = x*4 + y;
+        ++n[k];
+
+        for(unsigned int c = 0; c < 3; ++c)
+          sub[k].sum[c] += p[c];
+      }
+    }
+
+    // quantize the average colours for both modes
+    int c5[2][3], c4[2][3];
+    bool diff_ok = true;
+    for(unsigned int c = 0; c < 3; ++c)
+    {
+      for(unsigned int k = 0; k < 2; ++k)
+      {
+        c5[k][c] = (sub[k].sum[c] * 31 + 8 * 255 / 2) / (8 * 255);
+        c4[k][c] = (sub[k].sum[c] * 15 + 8 * 255 / 2) / (8 * 255);
+      }
+
+      const int d = c5[1][c] - c5[0][c];
+      if(d < -4 || d > 3)
+        diff_ok = false;
+    }
+
+    // 5-bit colours are finer than 4-bit ones, so only fall back to
+    // individual colours when the differential mode can't hold them
+    const unsigned int diff = diff_ok;
+    int          (&color)[2][3] = diff ? c5 : c4;
+    int          estimate = 0;
+    unsigned int table[2];
+    for(unsigned int k = 0; k < 2; ++k)
+    {
+      int base[3];
+      for(unsigned int c = 0; c < 3; ++c)
+        base[c] = expand(color[k][c], diff);
+
+      estimate += estimate_subblock(sub[k], base, table[k]);
+    }
+
+    if(estimate < best_estimate)
+    {
+      best_estimate = estimate;
+      best_flip     = flip;
+      best_diff     = diff;
+      best_table[0] = table[0];
+      best_table[1] = table[1];
+      std::copy(&color[0][0], &color[0][0] + 6, &best_color[0][0]);
+    }
+  }
+
+  // compute the selectors and exact error of the chosen encoding
+  const Subblock (&sub)[2] = subs[best_flip];
+  unsigned int   error = 0, msb = 0, lsb = 0;
+  for(unsigned int k = 0; k < 2; ++k)
+  {
+    int base[3];
+    for(unsigned int c = 0; c < 3; ++c)
+    {
+      base[c] = expand(best_color[k][c], best_diff);
+    }
+
+    uint8_t selectors[8];
+    error += fit_subblock(sub[k], base, best_table[k], selectors);
+
+    // selector bits are stored column-major, msb plane first
+    for(unsigned int i = 0; i < 8; ++i)
+    {
+      msb |= (selectors[i] >> 1) << sub[k].pos[i];
+      lsb |= (selectors[i] & 1)  << sub[k].pos[i];
+    }
+  }
+
+  for(unsigned int c = 0; c < 3; ++c)
+  {
+    if(best_diff)
+      out[c] = (best_color[0][c] << 3) | ((best_color[1][c] - best_color[0][c]) & 7);
+    else
+      out[c] = (best_color[0][c] << 4) | best_color[1][c];
+  }
+
+  out[3] = (best_table[0] << 5) | (best_table[1] << 2) | (best_diff << 1) | best_flip;
+  out[4] = msb >> 8;
+  out[5] = msb;
+  out[6] = lsb >> 8;
+  out[7] = lsb;
+
+  return error;
+}
+
+}
+
+namespace etc1
+{
+
+void draft(void *out, const unsigned int *in, unsigned int *errors,
+           unsigned int count, rg_etc1::etc1_pack_params&)
+{
+  uint8_t       *dst = static_cast<uint8_t*>(out);
+  const uint8_t *src = reinterpret_cast<const uint8_t*>(in);
+
+  for(unsigned int i = 0; i < count; ++i)
+    errors[i] = draft_block(dst + i*8, src + i*64);
+}
+
+}
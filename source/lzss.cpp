@@ -22,9 +22,9 @@
  */
 
 #include "compress.h"
-#ifndef NDEBUG
+#include <algorithm>
+#include <array>
 #include <cstring>
-#endif
 #include <vector>
 
 /** @brief LZSS/LZ10 maximum match length */
@@ -49,93 +49,470 @@ enum LZSS_t
   LZ11, ///< LZ11 compression
 };
 
-const uint8_t*
-rfind(const uint8_t *first, const uint8_t *last, const uint8_t &val)
+/** @brief Hash-chain match finder
+ *
+ *  @details
+ *  Every position is linked into a chain of earlier positions whose next
+ *  three bytes hash the same, most recent first, so only positions that can
+ *  start a match of at least three bytes are visited. Shorter matches are
+ *  never encoded, so they are not looked for.
+ *
+ *  The chains live in a ring. The encoder looks ahead up to a maximum match
+ *  length past its current position, so the ring covers the displacement
+ *  window plus that lookahead. The last few results are kept as well, since
+ *  the positions looked ahead at are the ones encoded next.
+ */
+class MatchFinder
 {
-  assert(last >= first);
-  while(--last >= first)
+public:
+  /** @brief Constructor
+   *  @param[in] start    Input buffer
+   *  @param[in] len      Input length
+   *  @param[in] max_disp Maximum displacement
+   *  @param[in] max_len  Maximum match length
+   */
+  MatchFinder(const uint8_t *start, size_t len, size_t max_disp,
+              size_t max_len)
+  : start(start),
+    end(start + len),
+    max_disp(max_disp),
+    inserted(0),
+    head(HASH_SIZE, NONE),
+    run_head(256, NONE),
+    memo(),
+    memo_next(0),
+    last_pos(0),
+    last_len(0),
+    last_disp(0),
+    last_max(0)
   {
-    if(*last == val)
-      return last;
+    // the ring never needs to be larger than the input
+    size_t ring = 1;
+    while(ring < std::min(len, max_disp + max_len + 1))
+      ring <<= 1;
+
+    chain.resize(ring);
+    run_chain.resize(ring);
+    ring_mask = ring - 1;
   }
 
-  return nullptr;
-}
+  /** @brief Find best buffer match
+   *
+   *  @details
+   *  Picks the same match as an exhaustive backward scan would: the nearest
+   *  match if one reaches len, otherwise the farthest of the longest.
+   *
+   *  @param[in]  buffer Encoding buffer
+   *  @param[in]  len    Length of encoding buffer
+   *  @param[out] outlen Length of match; 0 if there is no match of at least
+   *                     three bytes
+   *  @returns Best match
+   *  @retval nullptr no match
+   */
+  const uint8_t* find(const uint8_t *buffer, size_t len, size_t &outlen)
+  {
+    assert(buffer > start);
+    assert(buffer + len <= end);
 
-/** @brief Find best buffer match
- *  @param[in]  start     Input buffer
- *  @param[in]  buffer    Encoding buffer
- *  @param[in]  len       Length of encoding buffer
- *  @param[in]  max_disp  Maximum displacement
- *  @param[out] outlen    Length of match
- *  @returns Best match
- *  @retval nullptr no match
- */
-const uint8_t*
-find_best_match(const uint8_t *start, const uint8_t *buffer, size_t len,
-                size_t max_disp, size_t &outlen)
-{
-  assert(buffer > start);
+    // the encoder looks ahead at the positions it will encode next, so each
+    // position is usually asked for twice
+    for(auto &match: memo)
+    {
+      if(match.buffer == buffer && match.len == len)
+      {
+        outlen = match.outlen;
+        return match.start;
+      }
+    }
+
+    Match &match = memo[memo_next];
+    memo_next = (memo_next + 1) % memo.size();
 
-  // clamp start to maximum displacement from buffer
-  if(buffer - start > static_cast<ptrdiff_t>(max_disp))
-    start = buffer - max_disp;
+    match.buffer = buffer;
+    match.len    = len;
+    match.start  = search(buffer, len, match.outlen);
 
-  const uint8_t *best_start = buffer;
-  size_t        best_len = 0;
+    outlen = match.outlen;
+    return match.start;
+  }
 
-  // find nearest matching start byte
-  const uint8_t *p = rfind(start, buffer, *buffer);
-  while(p)
+  /** @brief Find the length of the longest match
+   *
+   *  @details
+   *  Unlike find(), any match of the longest length will do. Positions must
+   *  be asked for in order; the match found at the previous position still
+   *  holds here one byte shorter, so the search starts from it.
+   *
+   *  Inside a run of one byte value, the hash chain holds every earlier
+   *  position of the run, so walking it at each position of a long run is
+   *  quadratic. A match from a position q preceded by the same byte would
+   *  have been one byte longer from q - 1 at the previous position, so it is
+   *  no longer than the carried match, unless the length limit stopped it
+   *  there. Only the positions that start a run of that byte can beat it,
+   *  and those have a chain of their own. The result is as long as walking
+   *  the hash chain would find, so the optimal parse stays optimal.
+   *
+   *  @param[in]  buffer Encoding buffer
+   *  @param[in]  len    Length of encoding buffer
+   *  @param[out] disp   Displacement of the match
+   *  @returns Length of match; 0 if there is no match of at least three bytes
+   */
+  size_t longest(const uint8_t *buffer, size_t len, size_t &disp)
   {
-    // find length of match
-    size_t test_len = 1;
-    for(size_t i = 1; i < len; ++i)
+    assert(buffer > start);
+    assert(buffer + len <= end);
+
+    const size_t pos    = buffer - start;
+    const size_t window = pos > max_disp ? pos - max_disp : 0;
+
+    size_t best_len = 0;
+    disp = 0;
+
+    if(pos == last_pos + 1 && last_len > 3)
     {
-      if(p[i] == buffer[i])
-        ++test_len;
-      else
-        break;
+      best_len = std::min(last_len - 1, len);
+      disp     = last_disp;
+      best_len += match_length(buffer - disp + best_len, buffer + best_len,
+                               len - best_len);
     }
 
-    if(test_len >= best_len)
+    if(best_len < len && len >= 3)
     {
-      // this match is the best so far, so save it
-      best_start = p;
-      best_len   = test_len;
+      link(pos);
+
+      // inside a run, only a position that starts a run of the same byte can
+      // beat the carried match, unless the length limit cut that match short
+      const bool   in_run = pos == last_pos + 1 && buffer[-1] == buffer[0]
+                         && (last_max > len
+                             || (last_max == len && best_len + 1 < len));
+      const size_t *next  = in_run ? run_chain.data() : chain.data();
+
+      for(size_t p = in_run ? run_head[buffer[0]] : head[hash(buffer)];
+          p != NONE && p >= window; p = next[p & ring_mask])
+      {
+        if(p >= pos)
+          continue;
+
+        // only a longer match is of any use
+        if(start[p + best_len] != buffer[best_len])
+          continue;
+
+        size_t test_len = match_length(start + p, buffer, len);
+        if(test_len > best_len)
+        {
+          best_len = test_len;
+          disp     = pos - p;
+
+          if(best_len == len)
+            break;
+        }
+      }
     }
 
-    // if we maximized the match, stop here
-    if(best_len == len)
-      break;
+    if(best_len < 3)
+      best_len = 0;
+
+    last_pos   = pos;
+    last_len   = best_len;
+    last_disp  = disp;
+    last_max   = len;
 
-    // find next nearest matching byte and try again
-    p = rfind(start, p, *buffer);
+    return best_len;
   }
 
-  if(best_len)
+private:
+  /** @brief Link every position before a position into its chain
+   *  @param[in] pos Position
+   */
+  void link(size_t pos)
   {
-    // we found a match, so return it
+    for(; inserted < pos; ++inserted)
+    {
+      if(start + inserted + 3 <= end)
+      {
+        size_t &h = head[hash(start + inserted)];
+        chain[inserted & ring_mask] = h;
+        h = inserted;
+      }
+
+      if(inserted == 0 || start[inserted - 1] != start[inserted])
+      {
+        size_t &h = run_head[start[inserted]];
+        run_chain[inserted & ring_mask] = h;
+        h = inserted;
+      }
+    }
+  }
+
+  /** @brief Search for the best buffer match
+   *  @param[in]  buffer Encoding buffer
+   *  @param[in]  len    Length of encoding buffer
+   *  @param[out] outlen Length of match; 0 if there is no match of at least
+   *                     three bytes
+   *  @returns Best match
+   *  @retval nullptr no match
+   */
+  const uint8_t* search(const uint8_t *buffer, size_t len, size_t &outlen)
+  {
+    outlen = 0;
+    if(len < 3)
+      return nullptr;
+
+    const size_t pos    = buffer - start;
+    const size_t window = pos > max_disp ? pos - max_disp : 0;
+
+    link(pos);
+
+    const uint8_t *best_start = nullptr;
+    size_t        best_len    = 0;
+
+    for(size_t p = head[hash(buffer)]; p != NONE && p >= window;
+        p = chain[p & ring_mask])
+    {
+      // the lookahead may have linked positions past this one
+      if(p >= pos)
+        continue;
+
+      // a match can only tie the best one if it reaches its last byte
+      if(best_len && start[p + best_len - 1] != buffer[best_len - 1])
+        continue;
+
+      size_t test_len = match_length(start + p, buffer, len);
+      if(test_len < 3)
+        continue;
+
+      if(test_len >= best_len)
+      {
+        // this match is the best so far, so save it
+        best_start = start + p;
+        best_len   = test_len;
+      }
+
+      // if we maximized the match, stop here
+      if(best_len == len)
+        break;
+    }
+
     outlen = best_len;
     return best_start;
   }
 
-  // no match found
-  outlen = 0;
-  return nullptr;
-}
+  /** @brief Found match */
+  struct Match
+  {
+    const uint8_t *buffer; ///< Encoding buffer
+    size_t        len;     ///< Length of encoding buffer
+    const uint8_t *start;  ///< Best match
+    size_t        outlen;  ///< Length of match
+  };
+
+  /** @brief Number of positions in the match cache */
+  static constexpr size_t MEMO_SIZE = 4;
+
+  /** @brief Number of hash chains */
+  static constexpr size_t HASH_SIZE = 1 << 15;
+
+  /** @brief End of chain */
+  static constexpr size_t NONE = SIZE_MAX;
+
+  /** @brief Hash the three bytes at a position
+   *  @param[in] p Position
+   *  @returns hash
+   */
+  static size_t hash(const uint8_t *p)
+  {
+    uint32_t v = p[0] | (p[1] << 8) | (p[2] << 16);
+    return (v * UINT32_C(2654435761)) >> (32 - 15);
+  }
+
+  /** @brief Get the length of a match, a word at a time
+   *  @param[in] a   Earlier position
+   *  @param[in] b   Later position
+   *  @param[in] len Maximum length
+   *  @returns match length
+   */
+  static size_t match_length(const uint8_t *a, const uint8_t *b, size_t len)
+  {
+    size_t i = 0;
+    for(; i + sizeof(uint64_t) <= len; i += sizeof(uint64_t))
+    {
+      uint64_t x, y;
+      std::memcpy(&x, a + i, sizeof(x));
+      std::memcpy(&y, b + i, sizeof(y));
+
+      // finish the mismatching word a byte at a time
+      if(x != y)
+        break;
+    }
+
+    while(i < len && a[i] == b[i])
+      ++i;
+
+    return i;
+  }
+
+  const uint8_t                *start;    ///< Input buffer
+  const uint8_t                *end;      ///< End of input buffer
+  size_t                       max_disp;  ///< Maximum displacement
+  size_t                       inserted;  ///< Number of positions linked so far
+  size_t                       ring_mask; ///< Chain ring index mask
+  std::vector<size_t>          head;      ///< Most recent position of each hash
+  std::vector<size_t>          chain;     ///< Previous position with the same hash
+  std::vector<size_t>          run_head;  ///< Most recent run start of each byte
+  std::vector<size_t>          run_chain; ///< Previous run start of the same byte
+  std::array<Match, MEMO_SIZE> memo;      ///< Recently found matches
+  size_t                       memo_next; ///< Next match cache slot to replace
+  size_t                       last_pos;  ///< Position of the last longest()
+  size_t                       last_len;  ///< Length found by the last longest()
+  size_t                       last_disp; ///< Displacement found by the last longest()
+  size_t                       last_max;  ///< Length limit of the last longest()
+};
+
+constexpr size_t MatchFinder::MEMO_SIZE;
+constexpr size_t MatchFinder::HASH_SIZE;
+constexpr size_t MatchFinder::NONE;
+
+/** @brief LZSS/LZ10/LZ11 token writer */
+class TokenWriter
+{
+public:
+  /** @brief Constructor
+   *  @param[in] mode LZ mode
+   *  @param[in] len  Source length
+   */
+  TokenWriter(LZSS_t mode, size_t len)
+  : mode(mode),
+    chunks(0),
+    shift(7)
+  {
+    assert(mode == LZ10 || mode == LZ11);
+
+    // append compression header
+    if(mode == LZ10)
+      compressionHeader(result, 0x10, len);
+    else
+      compressionHeader(result, 0x11, len);
+
+    // reserve an encode byte in output buffer
+    code_pos = result.size();
+    result.push_back(0);
+  }
+
+  /** @brief Append a copy chunk
+   *  @param[in] byte Byte to copy
+   */
+  void literal(uint8_t byte)
+  {
+    next_chunk();
+
+    // this is a copy chunk; append this byte to the output buffer
+    result.push_back(byte);
+  }
+
+  /** @brief Append a compressed chunk
+   *  @param[in] disp   Displacement back from the current position
+   *  @param[in] tmplen Length of match
+   */
+  void match(size_t disp, size_t tmplen)
+  {
+    next_chunk();
+
+    // mark this chunk as compressed
+    assert(code_pos < result.size());
+    result[code_pos] |= (1 << shift);
+
+    // encode the displacement and length
+    assert(disp >= 1);
+    --disp;
+    assert(disp <= 0xFFF);
+
+    if(mode == LZ10)
+    {
+      assert(tmplen-3 <= 0xF);
+      result.push_back(((tmplen-3) << 4) | (disp >> 8));
+      result.push_back(disp);
+    }
+    else if(tmplen <= 0x10)
+    {
+      assert(tmplen > 2);
+      assert(tmplen-1 <= 0xF);
+      result.push_back(((tmplen-1) << 4) | (disp >> 8));
+      result.push_back(disp);
+    }
+    else if(tmplen <= 0x110)
+    {
+      assert(tmplen >= 0x11);
+      assert(tmplen-0x11 <= 0xFF);
+      result.push_back((tmplen-0x11) >> 4);
+      result.push_back(((tmplen-0x11) << 4) | (disp >> 8));
+      result.push_back(disp);
+    }
+    else
+    {
+      assert(tmplen >= 0x111);
+      assert(tmplen-0x111 <= 0xFFFF);
+      result.push_back((1 << 4) | (tmplen-0x111) >> 12);
+      result.push_back(((tmplen-0x111) >> 4));
+      result.push_back(((tmplen-0x111) << 4) | (disp >> 8));
+      result.push_back(disp);
+    }
+  }
+
+  /** @brief Finish the output
+   *  @returns Compressed buffer
+   */
+  std::vector<uint8_t> finish()
+  {
+    // pad the output buffer to 4 bytes
+    if(result.size() & 0x3)
+      result.resize((result.size()+3) & ~0x3);
+
+    // return the output data
+    return std::move(result);
+  }
+
+  /** @brief Get the output size so far
+   *  @returns Output size so far
+   */
+  size_t size() const
+  {
+    return result.size();
+  }
+
+private:
+  /** @brief Advance to the next chunk's code byte bit */
+  void next_chunk()
+  {
+    if(chunks == 8)
+    {
+      // we need to encode more data, so add a new code byte
+      code_pos = result.size();
+      result.push_back(0);
+      chunks = 0;
+    }
+
+    shift = 7 - chunks++;
+  }
+
+  std::vector<uint8_t> result;   ///< Output buffer
+  LZSS_t               mode;     ///< LZ mode
+  size_t               code_pos; ///< Position of the current code byte
+  size_t               chunks;   ///< Chunks in the current code byte
+  size_t               shift;    ///< Code byte bit of the current chunk
+};
 
 /** @brief LZSS/LZ10/LZ11 compression
  *  @param[in]  buffer Source buffer
  *  @param[in]  len    Source length
- *  @param[out] outlen Output length
  *  @param[in]  mode   LZ mode
- *  @returns Compressed buffer
+ *  @param[in]  limit  Output size limit; may be null
+ *  @returns Compressed buffer; empty if the output grew past the limit
  */
 std::vector<uint8_t>
-lzssCommonEncode(const uint8_t *buffer,
-                 size_t        len,
-                 LZSS_t        mode)
+lzssCommonEncode(const uint8_t             *buffer,
+                 size_t                    len,
+                 LZSS_t                    mode,
+                 const std::atomic<size_t> *limit)
 {
   // get maximum match length
   const size_t max_len  = mode == LZ10 ? LZ10_MAX_LEN  : LZ11_MAX_LEN;
@@ -143,26 +520,11 @@ lzssCommonEncode(const uint8_t *buffer,
   // get maximum displacement
   const size_t max_disp = mode == LZ10 ? LZ10_MAX_DISP : LZ11_MAX_DISP;
 
-  assert(mode == LZ10 || mode == LZ11);
-
-  // create output buffer
-  std::vector<uint8_t> result;
-
-  // append compression header
-  if(mode == LZ10)
-    compressionHeader(result, 0x10, len);
-  else
-    compressionHeader(result, 0x11, len);
-
-  // reserve an encode byte in output buffer
-  size_t code_pos = result.size();
-  result.push_back(0);
-
-  // initialize shift
-  size_t shift = 7;
+  TokenWriter writer(mode, len);
 
   // encode every byte
   const uint8_t *start = buffer;
+  MatchFinder   finder(buffer, len, max_disp, max_len);
 #ifndef NDEBUG
   const uint8_t *end   = buffer + len;
 #endif
@@ -171,13 +533,17 @@ lzssCommonEncode(const uint8_t *buffer,
     assert(buffer < end);
     assert(buffer + len == end);
 
+    // give up once this output can't be the smallest
+    if(limit && writer.size() > limit->load(std::memory_order_relaxed))
+      return std::vector<uint8_t>();
+
     const uint8_t *tmp;
     size_t        tmplen;
 
     if(buffer != start)
     {
       // find best match
-      tmp = find_best_match(start, buffer, std::min(len, max_len), max_disp, tmplen);
+      tmp = finder.find(buffer, std::min(len, max_len), tmplen);
       if(tmp != NULL)
       {
         assert(tmp >= start);
@@ -202,14 +568,14 @@ lzssCommonEncode(const uint8_t *buffer,
       size_t skip_len, next_len;
 
       // get best match starting at the next byte
-      find_best_match(start, buffer+1, std::min(len-1, max_len), max_disp, skip_len);
+      finder.find(buffer+1, std::min(len-1, max_len), skip_len);
 
       // check if the match is too small to compress
       if(skip_len < 3)
         skip_len = 1;
 
       // get best match for data following the current compressed chunk
-      find_best_match(start, buffer+tmplen, std::min(len-tmplen, max_len), max_disp, next_len);
+      finder.find(buffer+tmplen, std::min(len-tmplen, max_len), next_len);
 
       // check if the match is too small to compress
       if(next_len < 3)
@@ -224,94 +590,196 @@ lzssCommonEncode(const uint8_t *buffer,
 
     if(tmplen < 3)
     {
-      // this is a copy chunk; append this byte to the output buffer
-      result.push_back(*buffer);
-
       // only one byte is copied
+      writer.literal(*buffer);
       tmplen = 1;
     }
-    else if(mode == LZ10)
-    {
-      // mark this chunk as compressed
-      assert(code_pos < result.size());
-      result[code_pos] |= (1 << shift);
+    else
+      writer.match(buffer - tmp, tmplen);
 
-      // encode the displacement and length
-      size_t disp = buffer - tmp - 1;
-      assert(tmplen-3 <= 0xF);
-      assert(disp <= 0xFFF);
-      result.push_back(((tmplen-3) << 4) | (disp >> 8));
-      result.push_back(disp);
-    }
-    else if(tmplen <= 0x10)
-    {
-      // mark this chunk as compressed
-      assert(code_pos < result.size());
-      result[code_pos] |= (1 << shift);
+    // advance input buffer
+    buffer += tmplen;
+    len    -= tmplen;
+  }
 
-      // encode the displacement and length
-      size_t disp = buffer - tmp - 1;
-      assert(tmplen > 2);
-      assert(tmplen-1 <= 0xF);
-      assert(disp <= 0xFFF);
-      result.push_back(((tmplen-1) << 4) | (disp >> 8));
-      result.push_back(disp);
-    }
-    else if(tmplen <= 0x110)
-    {
-      // mark this chunk as compressed
-      assert(code_pos < result.size());
-      result[code_pos] |= (1 << shift);
+  return writer.finish();
+}
 
-      // encode the displacement and length
-      size_t disp = buffer - tmp - 1;
-      assert(tmplen >= 0x11);
-      assert(tmplen-0x11 <= 0xFF);
-      assert(disp <= 0xFFF);
-      result.push_back((tmplen-0x11) >> 4);
-      result.push_back(((tmplen-0x11) << 4) | (disp >> 8));
-      result.push_back(disp);
-    }
-    else
-    {
-      // mark this chunk as compressed
-      assert(code_pos < result.size());
-      result[code_pos] |= (1 << shift);
+/** @brief Range minimum over the parse costs
+ *
+ *  @details
+ *  Bottom-up segment tree; each leaf holds the cost of encoding the input
+ *  from that position on. Costs and positions are packed into one key so
+ *  the minimum also says where it is, preferring later positions (longer
+ *  matches) on ties.
+ */
+class CostTree
+{
+public:
+  /** @brief Constructor
+   *  @param[in] size Number of positions
+   */
+  explicit CostTree(size_t size)
+  : size(size),
+    tree(2 * size, UINT64_MAX)
+  {
+    assert(size <= UINT32_MAX);
+  }
 
-      // encode the displacement and length
-      size_t disp = buffer - tmp - 1;
-      assert(tmplen >= 0x111);
-      assert(tmplen-0x111 <= 0xFFFF);
-      assert(disp <= 0xFFF);
-      result.push_back((1 << 4) | (tmplen-0x111) >> 12);
-      result.push_back(((tmplen-0x111) >> 4));
-      result.push_back(((tmplen-0x111) << 4) | (disp >> 8));
-      result.push_back(disp);
+  /** @brief Get the cost at a position
+   *  @param[in] pos Position
+   *  @returns cost
+   */
+  uint64_t get(size_t pos) const
+  {
+    return tree[pos + size] >> 32;
+  }
+
+  /** @brief Set the cost at a position
+   *  @param[in] pos  Position
+   *  @param[in] cost Cost
+   */
+  void set(size_t pos, uint64_t cost)
+  {
+    assert(cost <= UINT32_MAX);
+
+    size_t i = pos + size;
+    tree[i] = (cost << 32) | (UINT32_MAX - pos);
+
+    for(i /= 2; i >= 1; i /= 2)
+      tree[i] = std::min(tree[2*i], tree[2*i+1]);
+  }
+
+  /** @brief Find the cheapest position in a range
+   *  @param[in]  first First position
+   *  @param[in]  last  Last position (inclusive)
+   *  @param[out] best  Cheapest position
+   *  @returns cost at best
+   */
+  uint64_t min(size_t first, size_t last, size_t &best) const
+  {
+    uint64_t key = UINT64_MAX;
+    for(size_t l = first + size, r = last + size + 1; l < r; l /= 2, r /= 2)
+    {
+      if(l & 1)
+        key = std::min(key, tree[l++]);
+      if(r & 1)
+        key = std::min(key, tree[--r]);
     }
 
-    // advance input buffer
-    buffer += tmplen;
-    len    -= tmplen;
+    best = UINT32_MAX - (key & UINT32_MAX);
+    return key >> 32;
+  }
+
+private:
+  size_t                size; ///< Number of positions
+  std::vector<uint64_t> tree; ///< Segment tree of packed costs and positions
+};
+
+/** @brief Optimal-parse LZSS/LZ10/LZ11 compression
+ *
+ *  @details
+ *  Every prefix of a match is itself a match at the same displacement, so
+ *  only the longest match at each position is needed. Walking backwards, the
+ *  cheapest way to encode the rest of the input from each position is
+ *  either a copy chunk or a compressed chunk of some length up to that
+ *  longest match. The cost is in bits: a code byte bit plus the chunk's
+ *  bytes. LZ11 chunks take two, three or four bytes depending on the
+ *  length, so the cheapest length is looked up separately in each of those
+ *  ranges.
+ *
+ *  @param[in]  buffer Source buffer
+ *  @param[in]  len    Source length
+ *  @param[in]  mode   LZ mode
+ *  @returns Compressed buffer
+ */
+std::vector<uint8_t>
+lzssOptimalCommonEncode(const uint8_t *buffer,
+                        size_t        len,
+                        LZSS_t        mode)
+{
+  // get maximum match length
+  const size_t max_len  = mode == LZ10 ? LZ10_MAX_LEN  : LZ11_MAX_LEN;
+
+  // get maximum displacement
+  const size_t max_disp = mode == LZ10 ? LZ10_MAX_DISP : LZ11_MAX_DISP;
+
+  /** @brief Compressed chunk length range and its size in bits */
+  struct LengthRange
+  {
+    size_t   first; ///< Shortest length
+    size_t   last;  ///< Longest length
+    uint64_t bits;  ///< Chunk size, including its code byte bit
+  };
+
+  static const LengthRange lz10_ranges[] =
+  {
+    { 3, LZ10_MAX_LEN, 17 },
+  };
+
+  static const LengthRange lz11_ranges[] =
+  {
+    { 3,     0x10,         17 },
+    { 0x11,  0x110,        25 },
+    { 0x111, LZ11_MAX_LEN, 33 },
+  };
+
+  const LengthRange *ranges     = mode == LZ10 ? lz10_ranges : lz11_ranges;
+  const size_t      num_ranges = mode == LZ10 ? 1 : 3;
+
+  // longest match (and its displacement) at each position
+  std::vector<uint32_t> match_len(len, 0);
+  std::vector<uint16_t> match_disp(len, 0);
+  MatchFinder           finder(buffer, len, max_disp, max_len);
+  for(size_t i = 1; i < len; ++i)
+  {
+    size_t disp;
+    match_len[i]  = finder.longest(buffer + i, std::min(len - i, max_len), disp);
+    match_disp[i] = disp;
+  }
 
-    if(shift == 0 && len != 0)
+  // cheapest chunk at each position; 1 is a copy chunk
+  std::vector<uint32_t> choice(len, 1);
+  CostTree              cost(len + 1);
+  cost.set(len, 0);
+
+  for(size_t i = len; i-- > 0;)
+  {
+    uint64_t best = 9 + cost.get(i + 1);
+
+    for(size_t r = 0; r < num_ranges; ++r)
     {
-      // we need to encode more data, so add a new code byte
-      shift = 8;
-      code_pos = result.size();
-      result.push_back(0);
+      if(match_len[i] < ranges[r].first)
+        break;
+
+      size_t   next;
+      uint64_t trial = ranges[r].bits
+                     + cost.min(i + ranges[r].first,
+                                i + std::min<size_t>(ranges[r].last, match_len[i]),
+                                next);
+      if(trial < best)
+      {
+        best      = trial;
+        choice[i] = next - i;
+      }
     }
 
-    // advance code byte bit position
-    if(shift != 0)
-      --shift;
+    cost.set(i, best);
   }
 
-  // pad the output buffer to 4 bytes
-  if(result.size() & 0x3)
-    result.resize((result.size()+3) & ~0x3);
+  TokenWriter writer(mode, len);
+  for(size_t i = 0; i < len; i += choice[i])
+  {
+    if(choice[i] == 1)
+      writer.literal(buffer[i]);
+    else
+    {
+      assert(std::memcmp(buffer + i, buffer + i - match_disp[i], choice[i]) == 0);
+      writer.match(match_disp[i], choice[i]);
+    }
+  }
 
-  // return the output data
-  return result;
+  return writer.finish();
 }
 
 }
@@ -319,13 +787,41 @@ lzssCommonEncode(const uint8_t *buffer,
 std::vector<uint8_t>
 lzssEncode(const void *src, size_t len)
 {
-  return lzssCommonEncode(reinterpret_cast<const uint8_t*>(src), len, LZ10);
+  return lzssCommonEncode(reinterpret_cast<const uint8_t*>(src), len, LZ10,
+                          nullptr);
 }
 
 std::vector<uint8_t>
 lz11Encode(const void *src, size_t len)
 {
-  return lzssCommonEncode(reinterpret_cast<const uint8_t*>(src), len, LZ11);
+  return lzssCommonEncode(reinterpret_cast<const uint8_t*>(src), len, LZ11,
+                          nullptr);
+}
+
+std::vector<uint8_t>
+lzssEncode(const void *src, size_t len, const std::atomic<size_t> &limit)
+{
+  return lzssCommonEncode(reinterpret_cast<const uint8_t*>(src), len, LZ10,
+                          &limit);
+}
+
+std::vector<uint8_t>
+lz11Encode(const void *src, size_t len, const std::atomic<size_t> &limit)
+{
+  return lzssCommonEncode(reinterpret_cast<const uint8_t*>(src), len, LZ11,
+                          &limit);
+}
+
+std::vector<uint8_t>
+lzssOptimalEncode(const void *src, size_t len)
+{
+  return lzssOptimalCommonEncode(reinterpret_cast<const uint8_t*>(src), len, LZ10);
+}
+
+std::vector<uint8_t>
+lz11OptimalEncode(const void *src, size_t len)
+{
+  return lzssOptimalCommonEncode(reinterpret_cast<const uint8_t*>(src), len, LZ11);
 }
 
 void lzssDecode(const void *source, void *dest, size_t size)
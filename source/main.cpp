@@ -21,28 +21,36 @@
  *  @brief Program entry point
  */
 #include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <chrono>
 #include <climits>
-#include <condition_variable>
 #include <cmath>
+#include <cstdint>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
-#include <queue>
+#include <functional>
+#include <memory>
 #include <set>
 #include <stdexcept>
-#include <thread>
 #include <vector>
 #include <getopt.h>
 #include <libgen.h>
 
 #include "atlas.h"
+#include "bitmap.h"
+#include "block_cache.h"
 #include "compress.h"
+#include "decode.h"
 #include "encode.h"
+#include "etc1_packer.h"
 #include "magick_compat.h"
+#include "mipmap.h"
 #include "quantum.h"
 #include "rg_etc1.h"
 #include "subimage.h"
+#include "thread_pool.h"
 
 namespace
 {
@@ -132,12 +140,14 @@ const ProcessFormatMap output_format_strings[] =
 /** @brief Compression format */
 enum CompressionFormat
 {
-  COMPRESSION_NONE, ///< No compression
-  COMPRESSION_LZ10, ///< LZSS/LZ10 compression
-  COMPRESSION_LZ11, ///< LZ11 compression
-  COMPRESSION_RLE,  ///< Run-length encoding compression
-  COMPRESSION_HUFF, ///< Huffman encoding
-  COMPRESSION_AUTO, ///< Choose best compression
+  COMPRESSION_NONE,         ///< No compression
+  COMPRESSION_LZ10,         ///< LZSS/LZ10 compression
+  COMPRESSION_LZ11,         ///< LZ11 compression
+  COMPRESSION_LZ10_OPTIMAL, ///< Optimal-parse LZSS/LZ10 compression
+  COMPRESSION_LZ11_OPTIMAL, ///< Optimal-parse LZ11 compression
+  COMPRESSION_RLE,          ///< Run-length encoding compression
+  COMPRESSION_HUFF,         ///< Huffman encoding
+  COMPRESSION_AUTO,         ///< Choose best compression
 };
 
 typedef std::pair<const char*, CompressionFormat> CompressionFormatMap;
@@ -146,14 +156,16 @@ typedef CaseInsensitiveComparator<CompressionFormat> CompressionFormatComparator
 /** @brief Compression format strings */
 const CompressionFormatMap compression_format_strings[] =
 {
-  { "auto",     COMPRESSION_AUTO, },
-  { "huff",     COMPRESSION_HUFF, },
-  { "huffman",  COMPRESSION_HUFF, },
-  { "lz10",     COMPRESSION_LZ10, },
-  { "lz11",     COMPRESSION_LZ11, },
-  { "lzss",     COMPRESSION_LZ10, },
-  { "none",     COMPRESSION_NONE, },
-  { "rle",      COMPRESSION_RLE,  },
+  { "auto",         COMPRESSION_AUTO,         },
+  { "huff",         COMPRESSION_HUFF,         },
+  { "huffman",      COMPRESSION_HUFF,         },
+  { "lz10",         COMPRESSION_LZ10,         },
+  { "lz10-optimal", COMPRESSION_LZ10_OPTIMAL, },
+  { "lz11",         COMPRESSION_LZ11,         },
+  { "lz11-optimal", COMPRESSION_LZ11_OPTIMAL, },
+  { "lzss",         COMPRESSION_LZ10,         },
+  { "none",         COMPRESSION_NONE,         },
+  { "rle",          COMPRESSION_RLE,          },
 };
 
 typedef std::pair<const char*, FilterType> FilterTypeMap;
@@ -227,18 +239,39 @@ ProcessFormat process_format = RGBA8888;
 /** @brief ETC1 quality option */
 rg_etc1::etc1_quality etc1_quality = rg_etc1::cMediumQuality;
 
+/** @brief ETC1 block packer option */
+etc1::Packer etc1_packer = rg_etc1::pack_etc1_blocks;
+
+/** @brief ETC1 block error target option; 0 for fixed quality */
+unsigned int etc1_target_error = 0;
+
+/** @brief ETC1 refinement time budget in milliseconds; 0 for none */
+unsigned long time_budget = 0;
+
 /** @brief Compression format option */
 CompressionFormat compression_format = COMPRESSION_AUTO;
 
+/** @brief Run every -z auto candidate on the full image data */
+bool compress_exhaustive = false;
+
 /** @brief Mipmap filter type option */
 FilterType filter_type = Magick::UndefinedFilter;
 
+/** @brief Generate mipmaps with the native linear-light box filter */
+bool fast_mipmap = false;
+
 /** @brief Processing mode option */
 ProcessingMode process_mode = PROCESS_NORMAL;
 
 /** @brief Trim input images */
 bool trim = false;
 
+/** @brief Number of tiles per work unit; 0 for automatic */
+size_t grain = 0;
+
+/** @brief Print statistics */
+bool verbose = false;
+
 /** @brief Output subimage data */
 std::vector<SubImage> subimage_data;
 
@@ -435,107 +468,15 @@ std::vector<Magick::Image> load_image(Magick::Image &img)
   return result;
 }
 
-/** @brief Swizzle an 8x8 tile (Morton order)
- *  @param[in] p       Tile to swizzle
- *  @param[in] reverse Whether to unswizzle
- */
-void swizzle(PixelPacket p, bool reverse)
-{
-  // swizzle foursome table
-  static const unsigned char table[][4] =
-  {
-    {  2,  8, 16,  4, },
-    {  3,  9, 17,  5, },
-    {  6, 10, 24, 20, },
-    {  7, 11, 25, 21, },
-    { 14, 26, 28, 22, },
-    { 15, 27, 29, 23, },
-    { 34, 40, 48, 36, },
-    { 35, 41, 49, 37, },
-    { 38, 42, 56, 52, },
-    { 39, 43, 57, 53, },
-    { 46, 58, 60, 54, },
-    { 47, 59, 61, 55, },
-  };
-
-  if(!reverse)
-  {
-    // swizzle each foursome
-    for(const auto &entry: table)
-    {
-      Magick::Color tmp = p[entry[0]];
-      p[entry[0]]       = p[entry[1]];
-      p[entry[1]]       = p[entry[2]];
-      p[entry[2]]       = p[entry[3]];
-      p[entry[3]]       = tmp;
-    }
-  }
-  else
-  {
-    // unswizzle each foursome
-    for(const auto &entry: table)
-    {
-      Magick::Color tmp = p[entry[3]];
-      p[entry[3]]       = p[entry[2]];
-      p[entry[2]]       = p[entry[1]];
-      p[entry[1]]       = p[entry[0]];
-      p[entry[0]]       = tmp;
-    }
-  }
-
-  // (un)swizzle each pair
-  swapPixel(p[12], p[18]);
-  swapPixel(p[13], p[19]);
-  swapPixel(p[44], p[50]);
-  swapPixel(p[45], p[51]);
-}
-
-/** @brief Swizzle an image (Morton order)
- *  @param[in] img     Image to swizzle
- *  @param[in] reverse Whether to unswizzle
- */
-void swizzle(Magick::Image &img, bool reverse)
-{
-  Pixels cache(img);
-  size_t height = img.rows();
-  size_t width  = img.columns();
-
-  // (un)swizzle each tile
-  for(size_t j = 0; j < height; j += 8)
-  {
-    for(size_t i = 0; i < width; i += 8)
-    {
-      PixelPacket p = cache.get(i, j, 8, 8);
-      swizzle(p, reverse);
-      cache.sync();
-    }
-  }
-}
-
 /** @brief Check if an image has any transparency
- *  @param[in] img Image to check
+ *  @param[in] bitmap Exported image to check
  *  @returns whether image has any transparency
  */
 template<int bits>
-bool has_alpha(Magick::Image &img)
+bool has_alpha(const Bitmap &bitmap)
 {
-  Pixels      cache(img);
-  PixelPacket p = cache.get(0, 0, img.columns(), img.rows());
-
-  size_t num = img.rows() * img.columns();
-
-  // check all pixels
-  for(size_t i = 0; i < num; ++i)
-  {
-    Magick::Color c = *p++;
-
-    // if the quantized pixel is not fully opaque, return true
-    if(quantum_to_bits<bits>(quantumAlpha(c)))
-      return true;
-  }
-
-  // no (partially) transparent pixels found
-  return false;
+  // a quantized alpha is non-zero somewhere iff it is for the highest alpha
+  return channel_to_bits<bits>(bitmap.alpha_max()) != 0;
 }
 
 /** @brief Add prefix to a file name
@@ -555,9 +496,14 @@ std::string add_prefix(std::string path, std::string prefix)
 }
 
 /** @brief Finalize process format
- *  @param[in] images Input images
+ *
+ *  @details
+ *  Uses the alpha statistics gathered when the images were exported, so this
+ *  does not have to scan the images again.
+ *
+ *  @param[in] images Exported input images
  */
-void finalize_process_format(std::vector<Magick::Image> &images)
+void finalize_process_format(const std::vector<Bitmap> &images)
 {
   // check each sub-image for transparency
   if(process_format == AUTO_L8
@@ -579,320 +525,558 @@ void finalize_process_format(std::vector<Magick::Image> &images)
     process_format = ETC1;
 }
 
-/** @brief Work queue */
-std::queue<encode::WorkUnit> work_queue;
+/** @brief Get bits per pixel of the process format
+ *  @param[in] format Process format
+ *  @returns bits per pixel
+ */
+size_t bits_per_pixel(ProcessFormat format)
+{
+  switch(format)
+  {
+    case RGBA8888:
+      return 32;
 
-/** @brief Result queue */
-std::vector<encode::WorkUnit> result_queue;
+    case RGB888:
+      return 24;
 
-/** @brief Work queue condition variable */
-std::condition_variable work_cond;
+    case RGBA5551:
+    case RGB565:
+    case RGBA4444:
+    case LA88:
+    case HILO88:
+      return 16;
 
-/** @brief Result queue condition variable */
-std::condition_variable result_cond;
+    case L8:
+    case A8:
+    case LA44:
+    case ETC1A4:
+      return 8;
 
-/** @brief Work queue mutex */
-std::mutex work_mutex;
+    case L4:
+    case A4:
+    case ETC1:
+      return 4;
 
-/** @brief Result queue mutex */
-std::mutex result_mutex;
+    case AUTO_L8:
+    case AUTO_L4:
+    case AUTO_ETC1:
+      // should have been changed with finalize_process_format()
+      break;
+  }
+
+  std::abort();
+}
 
-/** @brief Whether anymore work is coming */
-bool work_done = false;
+/** @brief Worker thread pool */
+std::unique_ptr<ThreadPool> thread_pool;
 
-/** @brief Work thread
- *  @param[in] param Unused
+/** @brief ETC1 block cache; shared by every image we process */
+std::unique_ptr<BlockCache> etc1_cache;
+
+/** @brief Get number of tiles per work unit
+ *  @param[in] num_tiles     Number of tiles in the image
+ *  @param[in] tiles_per_row Number of tiles in one row of the image
+ *  @returns number of tiles per work unit
  */
-void work_thread(void *param)
+size_t band_size(size_t num_tiles, size_t tiles_per_row)
 {
-  std::unique_lock<std::mutex> mutex(work_mutex);
-  while(true)
-  {
-    // wait for work
-    while(!work_done && work_queue.empty())
-      work_cond.wait(mutex);
-
-    // if there's no more work, quit
-    if(work_done && work_queue.empty())
-      return;
-
-    // get a work unit
-    encode::WorkUnit work = std::move(work_queue.front());
-    work_queue.pop();
-    mutex.unlock();
-
-    // process the work unit
-    work.process(work);
-
-    // put result on the result queue
-    result_mutex.lock();
-    result_queue.push_back(std::move(work));
-    std::push_heap(result_queue.begin(), result_queue.end());
-    result_cond.notify_one();
-    result_mutex.unlock();
-
-    mutex.lock();
-  }
+  if(grain != 0)
+    return grain;
+
+  // ETC1 block cost varies wildly (solid blocks return early), so hand out
+  // many small bands and let idle workers steal them; a tile is already far
+  // more work than the band overhead
+  if(process_format == ETC1 || process_format == ETC1A4)
+    return std::max<size_t>(num_tiles / (thread_pool->size() * 16), 1);
+
+  // aim for a few bands per worker so the load still balances, but never hand
+  // out less than a tile row unless the image is too small to go around
+  size_t band = num_tiles / (thread_pool->size() * 4);
+  if(band < tiles_per_row && num_tiles / tiles_per_row >= thread_pool->size())
+    band = tiles_per_row;
+
+  return std::max<size_t>(band, 1);
 }
 
-/** @brief Process image
- *  @param[in] img Image to process
+/** @brief Work job
+ *
+ *  @details
+ *  Encodes a band of consecutive tiles directly into the output buffer.
+ *
+ *  @param[in] p       Pixel data for the whole image
+ *  @param[in] width   Image width
+ *  @param[in] first   First tile of the band
+ *  @param[in] count   Number of tiles in the band
+ *  @param[in] out     Output buffer for the first tile of the band
+ *  @param[in] errors  ETC1 block errors for the first tile of the band; may
+ *                     be null
+ *  @param[in] process Work unit processor
  */
-void process_image(Magick::Image &img)
+void work_job(const Pixel *p, size_t width, size_t first, size_t count,
+              uint8_t *out, uint32_t *errors,
+              void (*process)(encode::WorkUnit&))
 {
-  // get the image prefix
-  const std::string prefix = img.comment();
-
-  void (*process)(encode::WorkUnit&) = nullptr;
+  // the error target and time budget override the quality option, including
+  // draft; blocks recorded for refinement start out at the lowest quality
+  const bool adaptive = etc1_target_error || errors;
+  encode::WorkUnit work(p, width, first, count, out,
+                        errors ? rg_etc1::cLowQuality : etc1_quality,
+                        adaptive ? rg_etc1::pack_etc1_blocks : etc1_packer,
+                        etc1_target_error, etc1_cache.get(), errors, process);
+
+  work.process(work);
+}
 
-  // get the processing routine
+/** @brief Get the work unit processor for the process format
+ *  @returns work unit processor
+ */
+void (*get_processor())(encode::WorkUnit&)
+{
   switch(process_format)
   {
     case RGBA8888:
-      process = encode::rgba8888;
-      break;
+      return encode::rgba8888;
 
     case RGB888:
-      process = encode::rgb888;
-      break;
+      return encode::rgb888;
 
     case RGBA5551:
-      process = encode::rgba5551;
-      break;
+      return encode::rgba5551;
 
     case RGB565:
-      process = encode::rgb565;
-      break;
+      return encode::rgb565;
 
     case RGBA4444:
-      process = encode::rgba4444;
-      break;
+      return encode::rgba4444;
 
     case LA88:
-      process = encode::la88;
-      break;
+      return encode::la88;
 
     case HILO88:
-      process = encode::hilo88;
-      break;
+      return encode::hilo88;
 
     case L8:
-      process = encode::l8;
-      break;
+      return encode::l8;
 
     case A8:
-      process = encode::a8;
-      break;
+      return encode::a8;
 
     case LA44:
-      process = encode::la44;
-      break;
+      return encode::la44;
 
     case L4:
-      process = encode::l4;
-      break;
+      return encode::l4;
 
     case A4:
-      process = encode::a4;
-      break;
+      return encode::a4;
 
     case ETC1:
-      process = encode::etc1;
-      break;
+      return encode::etc1;
 
     case ETC1A4:
-      process = encode::etc1a4;
+      return encode::etc1a4;
+
+    case AUTO_L8:
+    case AUTO_L4:
+    case AUTO_ETC1:
+      // should have been changed with finalize_process_format()
       break;
+  }
+
+  std::abort();
+}
+
+/** @brief Get the band decoder for the process format
+ *  @returns band decoder
+ */
+decode::Decoder get_decoder()
+{
+  switch(process_format)
+  {
+    case RGBA8888:
+      return decode::rgba8888;
+
+    case RGB888:
+      return decode::rgb888;
+
+    case RGBA5551:
+      return decode::rgba5551;
+
+    case RGB565:
+      return decode::rgb565;
+
+    case RGBA4444:
+      return decode::rgba4444;
+
+    case LA88:
+      return decode::la88;
+
+    case HILO88:
+      return decode::hilo88;
+
+    case L8:
+      return decode::l8;
+
+    case A8:
+      return decode::a8;
+
+    case LA44:
+      return decode::la44;
+
+    case L4:
+      return decode::l4;
+
+    case A4:
+      return decode::a4;
+
+    case ETC1:
+      return decode::etc1;
+
+    case ETC1A4:
+      return decode::etc1a4;
 
     case AUTO_L8:
     case AUTO_L4:
     case AUTO_ETC1:
       // should have been changed with finalize_process_format()
-      std::abort();
       break;
   }
 
-  // mipmap queue
-  std::queue<Magick::Image> img_queue;
+  std::abort();
+}
 
+/** @brief Generate the mipmap chain for an image
+ *  @param[in]  img     Base level image
+ *  @param[in]  base    Exported base level image
+ *  @param[out] mipmaps Mipmap chain, base level first
+ */
+void generate_mipmaps(const Magick::Image &img, Bitmap &&base,
+                      std::vector<Bitmap> &mipmaps)
+{
   // add base level
-  img_queue.push(img);
+  mipmaps.emplace_back(std::move(base));
 
-  // keep preview width/height
-  size_t preview_width  = img.columns();
-  size_t preview_height = img.rows();
+  size_t width  = img.columns();
+  size_t height = img.rows();
 
-  // generate mipmaps
-  if(filter_type != Magick::UndefinedFilter
-  && preview_width > 8 && preview_height > 8)
-  {
-    size_t width  = preview_width;
-    size_t height = preview_height;
+  if(filter_type == Magick::UndefinedFilter || width <= 8 || height <= 8)
+    return;
 
-    // mipmaps will go on the right third of the preview image
-    preview_width *= 1.5;
+  if(fast_mipmap)
+  {
+    // each level from the previous one
+    for(auto &level: mipmap::box_linear(mipmaps.back()))
+      mipmaps.emplace_back(std::move(level));
+    return;
+  }
 
-    // mipmaps must have both dimensions >= 8
-    while(width > 8 && height > 8)
-    {
-      // copy image
-      img = img_queue.front();
+  // mipmaps must have both dimensions >= 8
+  while(width > 8 && height > 8)
+  {
+    // copy image
+    Magick::Image mipmap(img);
 
-      // set resize filter type
-      img.filterType(filter_type);
+    // set resize filter type
+    mipmap.filterType(filter_type);
 
-      // half each dimension
-      width  = width / 2;
-      height = height / 2;
+    // half each dimension
+    width  = width / 2;
+    height = height / 2;
 
-      // resize the image
-      img.resize(Magick::Geometry(width, height));
+    // resize the image
+    mipmap.resize(Magick::Geometry(width, height));
 
-      // add to mipmap queue
-      img_queue.push(img);
-    }
+    // add to mipmap chain
+    mipmaps.emplace_back(mipmap);
   }
+}
+
+/** @brief Write the preview image for one sub-image
+ *  @param[in] first  First level of the mipmap chain
+ *  @param[in] last   End of the mipmap chain
+ *  @param[in] prefix Sub-image prefix
+ */
+void write_preview(std::vector<Bitmap>::iterator first,
+                   std::vector<Bitmap>::iterator last,
+                   const std::string &prefix)
+{
+  // keep preview width/height; mipmaps go on the right third
+  size_t preview_width  = first->width();
+  size_t preview_height = first->height();
+  if(last - first > 1)
+    preview_width *= 1.5;
 
   // create the preview image
   Magick::Image preview(Magick::Geometry(preview_width, preview_height),
                         transparent());
 
-  // create worker threads
-  std::vector<std::thread> workers;
-  work_mutex.lock();
-  work_done = false;
-  work_mutex.unlock();
-  for(size_t i = 0; i < std::thread::hardware_concurrency(); ++i)
-    workers.push_back(std::thread(work_thread, nullptr));
-
   size_t voff = 0; // vertical offset for mipmap preview
   size_t hoff = 0; // horizontal offset for mipmap preview
 
-  // process each image in the mipmap queue
-  while(!img_queue.empty())
+  for(auto it = first; it != last; ++it)
   {
-    // get the first image in the queue
-    img = img_queue.front();
-    img_queue.pop();
-
-    // get the mipmap dimensions
-    size_t width  = img.columns();
-    size_t height = img.rows();
+    Magick::Image img = it->image();
 
-    // all formats are swizzled except ETC1/ETC1A4
-    if(process_format != ETC1 && process_format != ETC1A4)
-      swizzle(img, false);
+    // composite the mipmap onto the preview
+    preview.composite(img, Magick::Geometry(0, 0, hoff, voff),
+                      Magick::OverCompositeOp);
 
-    // get pixel cache
-    Pixels      cache(img);
-    PixelPacket p = cache.get(0, 0, img.columns(), img.rows());
-
-    // process each 8x8 tile
-    uint64_t num_work = 0;
-    for(size_t j = 0; j < height; j += 8)
+    // position for next mipmap
+    voff += img.rows();
+    if(hoff == 0)
     {
-      for(size_t i = 0; i < width; i += 8)
-      {
-        // create the work unit
-        encode::WorkUnit work(num_work++,
-                              p + (j*width + i),
-                              width,
-                              etc1_quality,
-                              !output_path.empty(),
-                              !preview_path.empty(),
-                              process);
-
-        // queue the work unit
-        work_mutex.lock();
-        work_queue.push(std::move(work));
-        work_cond.notify_one();
-        work_mutex.unlock();
-      }
+      voff = 0;
+      hoff = img.columns();
     }
+  }
 
-    if(img_queue.empty())
+  try
+  {
+    // output the preview image
+    preview.write(add_prefix(preview_path, prefix));
+  }
+  catch(...)
+  {
+    try
     {
-      // no more work is coming
-      work_mutex.lock();
-      work_done = true;
-      work_cond.notify_all();
-      work_mutex.unlock();
+      // type couldn't be determined from file extension, so try png
+      preview.magick("PNG");
+      preview.write(add_prefix(preview_path, prefix));
     }
-
-    // gather results
-    for(uint64_t num_result = 0; num_result < num_work; ++num_result)
+    catch(...)
     {
-      // wait for the next result
-      std::unique_lock<std::mutex> mutex(result_mutex);
-      while(result_queue.empty()
-      || result_queue.front().sequence != num_result)
-      {
-        result_cond.wait(mutex);
-      }
+      std::fprintf(stderr, "Failed to output preview\n");
+    }
+  }
+}
+
+/** @brief Refine ETC1 blocks until the time budget runs out
+ *
+ *  @details
+ *  The blocks are refined worst first: every worker claims the next block in
+ *  error order until there are none left or the deadline has passed. Each
+ *  block is only ever replaced by a valid block with a lower error, so the
+ *  output is complete whenever the refinement stops.
+ *
+ *  @param[in] mipmaps  Encoded mipmap levels
+ *  @param[in] encoded  Encoded data for every level
+ *  @param[in] errors   Squared error of every encoded block
+ *  @param[in] deadline Time at which to stop refining
+ */
+void refine_etc1(const std::vector<Bitmap> &mipmaps, uint8_t *encoded,
+                 std::vector<uint32_t> &errors,
+                 std::chrono::steady_clock::time_point deadline)
+{
+  const bool   alpha     = process_format == ETC1A4;
+  const size_t tile_size = alpha ? 64 : 32;
 
-      // get the result's output buffer
-      encode::Buffer result;
-      std::pop_heap(result_queue.begin(), result_queue.end());
-      result.swap(result_queue.back().result);
-      result_queue.pop_back();
-      mutex.unlock();
+  // first tile of each level, counted across every level
+  std::vector<size_t> level_tiles;
+  size_t              num_tiles = 0;
+  for(auto &mipmap: mipmaps)
+  {
+    level_tiles.push_back(num_tiles);
+    num_tiles += (mipmap.width()/8) * (mipmap.height()/8);
+  }
 
-      // append the result's output buffer
-      image_data.insert(image_data.end(), result.begin(), result.end());
+  // worst blocks first; blocks that are already exact can't get any better
+  std::vector<uint32_t> order;
+  for(size_t i = 0; i < errors.size(); ++i)
+  {
+    if(errors[i] != 0)
+      order.push_back(i);
+  }
 
-      mutex.lock();
-    }
+  std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b)
+  {
+    return errors[a] > errors[b];
+  });
 
-    // synchronize the pixel cache
-    cache.sync();
+  std::atomic<size_t> next(0);
+  std::atomic<size_t> refined(0);
 
-    if(!preview_path.empty())
+  auto job = [&]()
+  {
+    for(size_t i = next++; i < order.size(); i = next++)
     {
-      // unswizzle the mipmap image
-      if(process_format != ETC1 && process_format != ETC1A4)
-        swizzle(img, true);
+      if(std::chrono::steady_clock::now() >= deadline)
+        return;
+
+      const size_t block = order[i];
+      const size_t tile  = block / 4;
+      const size_t level = std::upper_bound(level_tiles.begin(),
+                                            level_tiles.end(), tile)
+                         - level_tiles.begin() - 1;
+
+      const Bitmap &mipmap = mipmaps[level];
+      const size_t width   = mipmap.width();
+      const size_t t       = tile - level_tiles[level];
+      const Pixel  *p      = mipmap.data() + (t / (width/8)) * 8 * width
+                                           + (t % (width/8)) * 8;
+
+      encode::etc1_refine(p, width, block % 4, encoded + tile * tile_size,
+                          errors[block], alpha, etc1_cache.get());
+      ++refined;
+    }
+  };
 
-      // composite the mipmap onto the preview
-      preview.composite(img, Magick::Geometry(0, 0, hoff, voff),
-                        Magick::OverCompositeOp);
+  for(size_t i = 0; i < thread_pool->size(); ++i)
+    thread_pool->submit(job);
 
-      // position for next mipmap
-      voff += height;
-      if(hoff == 0)
-      {
-        voff = 0;
-        hoff = width;
-      }
-    }
+  // wait for the refinement to finish or run out of time
+  thread_pool->wait();
+
+  if(verbose)
+  {
+    std::fprintf(stderr, "ETC1 time budget: refined %zu of %zu blocks\n",
+                 refined.load(), order.size());
   }
+}
 
-  // join all the worker threads
-  while(!workers.empty())
+/** @brief Process images
+ *
+ *  @details
+ *  The tiles of every mipmap level of every sub-image are handed to the
+ *  workers as one batch, so the small levels don't run with idle workers.
+ *
+ *  The encoders only read the pixel data. If a preview is requested, the
+ *  encoded output is decoded back over the pixel data afterwards, again as one
+ *  batch, so the preview shows exactly what was encoded.
+ *
+ *  With an ETC1 time budget, every block is first packed at low quality and
+ *  the rest of the budget is spent refining the worst blocks.
+ *
+ *  @param[in] images  Images to process
+ *  @param[in] bitmaps Exported images; consumed as the base mipmap levels
+ */
+void process_images(std::vector<Magick::Image> &images,
+                    std::vector<Bitmap> &bitmaps)
+{
+  // nothing to output
+  if(output_path.empty() && preview_path.empty())
+    return;
+
+  // the budget covers the encoding itself
+  const auto deadline = std::chrono::steady_clock::now()
+                      + std::chrono::milliseconds(time_budget);
+
+  void (*process)(encode::WorkUnit&) = get_processor();
+  const size_t bpp       = bits_per_pixel(process_format);
+  const size_t tile_size = 8 * bpp;
+
+  // generate the mipmap chain for each sub-image; faces[i] is the first level
+  // of sub-image i
+  std::vector<Bitmap> mipmaps;
+  std::vector<size_t> faces;
+  for(size_t i = 0; i < images.size(); ++i)
+  {
+    faces.push_back(mipmaps.size());
+    generate_mipmaps(images[i], std::move(bitmaps[i]), mipmaps);
+  }
+  faces.push_back(mipmaps.size());
+
+  // size of the encoded mipmap chains
+  size_t chain_size = 0;
+  for(auto &mipmap: mipmaps)
+    chain_size += mipmap.width() * mipmap.height() * bpp / 8;
+
+  // presize the output so each work unit can encode directly into its slice;
+  // a preview without 3DS output still needs somewhere to encode to
+  encode::Buffer scratch;
+  uint8_t        *out;
+  if(!output_path.empty())
   {
-    workers.back().join();
-    workers.pop_back();
+    size_t offset = image_data.size();
+    image_data.resize(offset + chain_size);
+    out = image_data.data() + offset;
   }
+  else
+  {
+    scratch.resize(chain_size);
+    out = scratch.data();
+  }
+
+  uint8_t *encoded = out;
 
-  if(!preview_path.empty())
+  // record the error of every ETC1 block (four per tile) for refinement
+  const bool refine = time_budget != 0
+                   && (process_format == ETC1 || process_format == ETC1A4);
+  std::vector<uint32_t> errors(refine ? chain_size / tile_size * 4 : 0);
+
+  // number of tiles in the levels before this one
+  size_t level_tiles = 0;
+
+  // hand out every level at once
+  for(auto &mipmap: mipmaps)
   {
-    try
+    // get the mipmap dimensions
+    size_t width  = mipmap.width();
+    size_t height = mipmap.height();
+
+    // process each 8x8 tile, handing them out to the workers in bands
+    const size_t num_tiles = (width/8) * (height/8);
+    const size_t band      = band_size(num_tiles, width/8);
+
+    for(size_t first = 0; first < num_tiles; first += band)
     {
-      // output the preview image
-      preview.write(add_prefix(preview_path, prefix));
+      thread_pool->submit(std::bind(work_job,
+                                    mipmap.data(),
+                                    width,
+                                    first,
+                                    std::min(band, num_tiles - first),
+                                    out + first * tile_size,
+                                    refine ? &errors[(level_tiles + first) * 4]
+                                           : nullptr,
+                                    process));
     }
-    catch(...)
+
+    out         += num_tiles * tile_size;
+    level_tiles += num_tiles;
+  }
+
+  // wait for every level to be encoded
+  thread_pool->wait();
+
+  // spend whatever is left of the budget on the worst blocks
+  if(refine)
+    refine_etc1(mipmaps, encoded, errors, deadline);
+
+  if(preview_path.empty())
+    return;
+
+  // rebuild every level from the encoded data
+  decode::Decoder decoder = get_decoder();
+  for(auto &mipmap: mipmaps)
+  {
+    size_t width  = mipmap.width();
+    size_t height = mipmap.height();
+
+    // decoding is cheap next to encoding, so use at least a tile row per band
+    const size_t num_tiles = (width/8) * (height/8);
+    const size_t band      = std::max(num_tiles / (thread_pool->size() * 4),
+                                      width/8);
+
+    for(size_t first = 0; first < num_tiles; first += band)
     {
-      try
-      {
-        // type couldn't be determined from file extension, so try png
-        preview.magick("PNG");
-        preview.write(add_prefix(preview_path, prefix));
-      }
-      catch(...)
-      {
-        std::fprintf(stderr, "Failed to output preview\n");
-      }
+      thread_pool->submit(std::bind(decoder,
+                                    encoded + first * tile_size,
+                                    mipmap.data(),
+                                    width,
+                                    first,
+                                    std::min(band, num_tiles - first)));
     }
+
+    encoded += num_tiles * tile_size;
+  }
+
+  // wait for every level to be decoded
+  thread_pool->wait();
+
+  for(size_t i = 0; i < images.size(); ++i)
+  {
+    write_preview(mipmaps.begin() + faces[i],
+                  mipmaps.begin() + faces[i+1],
+                  images[i].comment());
   }
 }
 
@@ -1005,29 +1189,125 @@ std::vector<uint8_t> compressNone(const void *src, size_t len)
   return result;
 }
 
+/** @brief Auto-selectable compression routine */
+typedef std::vector<uint8_t> (*AutoCompressor)(const void*, size_t,
+                                               const std::atomic<size_t>&);
+
+/** @brief Sampled chunk size for the -z auto screen */
+constexpr size_t SAMPLE_CHUNK = 4096;
+
+/** @brief Number of sampled chunks for the -z auto screen */
+constexpr size_t SAMPLE_CHUNKS = 16;
+
+/** @brief Screen -z auto candidates on a sample of the source
+ *
+ *  @details
+ *  Every candidate compresses the same evenly spaced chunks of the source,
+ *  so the sample reflects the run lengths and match density that each of
+ *  them exploits. A candidate is kept only if its sampled size is within
+ *  1/8 of the smallest one, including storing the sample uncompressed.
+ *
+ *  @param[in]  src    Source buffer
+ *  @param[in]  len    Source length
+ *  @param[in]  funcs  Candidates
+ *  @param[in]  count  Number of candidates
+ *  @returns Whether each candidate could plausibly produce the smallest output
+ */
+std::vector<bool> compressScreen(const void *src, size_t len,
+                                 const AutoCompressor *funcs, size_t count)
+{
+  std::vector<bool> keep(count, true);
+
+  // too small to be worth sampling
+  if(compress_exhaustive || len < 4 * SAMPLE_CHUNK * SAMPLE_CHUNKS)
+    return keep;
+
+  const uint8_t *source = reinterpret_cast<const uint8_t*>(src);
+
+  std::vector<uint8_t> sample;
+  sample.reserve(SAMPLE_CHUNK * SAMPLE_CHUNKS);
+  for(size_t i = 0; i < SAMPLE_CHUNKS; ++i)
+  {
+    const uint8_t *chunk = source
+                         + i * (len - SAMPLE_CHUNK) / (SAMPLE_CHUNKS - 1);
+    sample.insert(std::end(sample), chunk, chunk + SAMPLE_CHUNK);
+  }
+
+  const std::atomic<size_t> limit(SIZE_MAX);
+  std::vector<size_t>       sizes(count);
+  size_t                    best = sample.size();
+
+  for(size_t i = 0; i < count; ++i)
+  {
+    sizes[i] = funcs[i](sample.data(), sample.size(), limit).size();
+    best     = std::min(best, sizes[i]);
+  }
+
+  for(size_t i = 0; i < count; ++i)
+    keep[i] = sizes[i] * 8 <= best * 9;
+
+  return keep;
+}
+
 /** @brief Auto-select compression
+ *
+ *  @details
+ *  The candidates that pass compressScreen() run concurrently on the thread
+ *  pool. Each one gives up as soon as its output grows past the smallest
+ *  output finished so far, which can never be the one that would have been
+ *  chosen.
+ *
  *  @param[in]  src    Source buffer
  *  @param[in]  len    Source length
  *  @returns Compressed buffer
  */
 std::vector<uint8_t> compressAuto(const void *src, size_t len)
 {
-  std::vector<uint8_t> best;
-
-  static std::vector<uint8_t> (*const compress_funcs[])(const void*,size_t) =
+  static const AutoCompressor compress_funcs[] =
   {
-    compressNone,
     lzssEncode,
     lz11Encode,
     //huffEncode, // broken
     rleEncode,
   };
 
-  for(const auto &compress: compress_funcs)
+  const size_t num_funcs = std::end(compress_funcs)
+                         - std::begin(compress_funcs);
+  const std::vector<bool> keep = compressScreen(src, len, compress_funcs,
+                                                num_funcs);
+
+  // the uncompressed output is the size to beat
+  std::vector<uint8_t> best = compressNone(src, len);
+  std::atomic<size_t>  limit(best.size());
+
+  std::vector<std::vector<uint8_t>> outputs(num_funcs);
+
+  for(size_t i = 0; i < num_funcs; ++i)
   {
-    std::vector<uint8_t> output = compress(src, len);
+    if(!keep[i])
+      continue;
 
-    if(best.empty() || (!output.empty() && output.size() < best.size()))
+    thread_pool->submit([&, i]()
+    {
+      std::vector<uint8_t> &output = outputs[i];
+      output = compress_funcs[i](src, len, limit);
+      if(output.empty())
+        return;
+
+      // lower the limit for the candidates still running
+      size_t current = limit.load();
+      while(output.size() < current
+         && !limit.compare_exchange_weak(current, output.size()))
+        ;
+    });
+  }
+
+  thread_pool->wait();
+
+  // ties go to the earliest candidate
+  for(auto &output: outputs)
+  {
+    if(!output.empty() && output.size() < best.size())
       best.swap(output);
   }
 
@@ -1056,6 +1336,14 @@ void write_image_data(FILE *fp)
       compress = lz11Encode;
       break;
 
+    case COMPRESSION_LZ10_OPTIMAL:
+      compress = lzssOptimalEncode;
+      break;
+
+    case COMPRESSION_LZ11_OPTIMAL:
+      compress = lz11OptimalEncode;
+      break;
+
     case COMPRESSION_RLE:
       compress = rleEncode;
       break;
@@ -1245,14 +1533,24 @@ void print_usage(const char *prog)
     "    -m, --mipmap <filter>        Generate mipmaps. See \"Mipmap Filter Options\"\n"
     "    -o, --output <output>        Output file\n"
     "    -p, --preview <preview>      Output preview file\n"
-    "    -q, --quality <etc1-quality> ETC1 quality. Valid options: low, medium (default), high\n"
+    "    -q, --quality <etc1-quality> ETC1 quality. Valid options: draft, low, medium (default), high\n"
     "    -r, --raw                    Output image data only\n"
     "    -t, --trim                   Trim input image(s)\n"
     "    -v, --version                Show version and copyright information\n"
     "    -z, --compress <compression> Compress output. See \"Compression Options\"\n"
     "    --atlas                      Generate texture atlas\n"
+    "    --compress-exhaustive        Run every -z auto candidate on the whole image\n"
+    "                                 instead of screening them on a sample first\n"
     "    --cubemap                    Generate a cubemap. See \"Cubemap\"\n"
+    "    --etc1-target-error <error>  Pack each ETC1 block at low quality, raising the\n"
+    "                                 quality only while its squared error exceeds\n"
+    "                                 <error>; overrides -q\n"
+    "    --grain <tiles>              Tiles encoded per work unit (default: automatic)\n"
     "    --skybox                     Generate a skybox. See \"Skybox\"\n"
+    "    --time-budget <ms>           Pack each ETC1 block at low quality, then refine\n"
+    "                                 the worst blocks until <ms> milliseconds have\n"
+    "                                 passed; overrides -q\n"
+    "    --verbose                    Print encoding statistics\n"
     "    <input>                      Input file\n\n"
 
     "  Format Options:\n"
@@ -1308,7 +1606,11 @@ void print_usage(const char *prog)
     "    -f auto-etc1\n"
     "      ETC1 when input has no alpha, otherwise ETC1A4\n\n"
 
-    "  Mipmap Filter Options:\n");
+    "  Mipmap Filter Options:\n"
+    "    -m fast\n"
+    "      2x2 box filter in linear light, each level from the previous one\n\n"
+
+    "    ImageMagick filters (each level from the base image):\n");
     for(const auto &type: filter_type_strings)
       std::printf("    -m %s\n", type.first);
 
@@ -1319,6 +1621,8 @@ void print_usage(const char *prog)
     "    -z huff, -z huffman  Huffman encoding (possible to produce garbage)\n"
     "    -z lzss, -z lz10     LZSS compression\n"
     "    -z lz11              LZ11 compression\n"
+    "    -z lz10-optimal      Optimal-parse LZSS compression (slower, smaller)\n"
+    "    -z lz11-optimal      Optimal-parse LZ11 compression (slower, smaller)\n"
     "    -z rle               Run-length encoding\n\n"
 
     "    NOTE: All compression types use a compression header: a single byte which denotes the compression type, followed by three bytes (little-endian) which specify the size of the uncompressed data. If the compression type byte has the MSB (0x80) set, the size is specified by four bytes (little-endian) plus three bytes of reserved (zero) padding.\n\n"
@@ -1356,9 +1660,12 @@ void print_usage(const char *prog)
 const struct option long_options[] =
 {
   { "atlas",    no_argument,       nullptr, 'a', },
+  { "compress-exhaustive", no_argument, nullptr, 'X', },
   { "cubemap",  no_argument,       nullptr, 'c', },
   { "depends",  required_argument, nullptr, 'd', },
+  { "etc1-target-error", required_argument, nullptr, 'e', },
   { "format",   required_argument, nullptr, 'f', },
+  { "grain",    required_argument, nullptr, 'g', },
   { "help",     no_argument,       nullptr, 'h', },
   { "mipmap",   required_argument, nullptr, 'm', },
   { "output",   required_argument, nullptr, 'o', },
@@ -1366,7 +1673,9 @@ const struct option long_options[] =
   { "quality",  required_argument, nullptr, 'q', },
   { "raw",      no_argument,       nullptr, 'r', },
   { "skybox",   no_argument,       nullptr, 's', },
+  { "time-budget", required_argument, nullptr, 'T', },
   { "trim",     no_argument,       nullptr, 't', },
+  { "verbose",  no_argument,       nullptr, 'V', },
   { "version",  no_argument,       nullptr, 'v', },
   { "compress", required_argument, nullptr, 'z', },
   { nullptr,    no_argument,       nullptr,   0, },
@@ -1499,6 +1808,21 @@ ParseStatus parseOptions(std::vector<char*> &args)
         depends_path = getPath(optarg);
         break;
 
+      case 'e':
+      {
+        // set etc1 block error target
+        char *end;
+        unsigned long value = std::strtoul(optarg, &end, 10);
+        if(*optarg == 0 || *end != 0 || value == 0 || value > UINT_MAX)
+        {
+          std::fprintf(stderr, "Invalid ETC1 target error '%s'\n", optarg);
+          return PARSE_FAILURE;
+        }
+
+        etc1_target_error = value;
+        break;
+      }
+
       case 'f':
       {
         // find matching output format
@@ -1519,6 +1843,21 @@ ParseStatus parseOptions(std::vector<char*> &args)
         break;
       }
 
+      case 'g':
+      {
+        // set work unit grain
+        char *end;
+        unsigned long value = std::strtoul(optarg, &end, 10);
+        if(*optarg == 0 || *end != 0 || value == 0 || value > UINT_MAX)
+        {
+          std::fprintf(stderr, "Invalid grain '%s'\n", optarg);
+          return PARSE_FAILURE;
+        }
+
+        grain = value;
+        break;
+      }
+
       case 'H':
         // set header path option
         header_path = getPath(optarg);
@@ -1570,6 +1909,14 @@ ParseStatus parseOptions(std::vector<char*> &args)
 
       case 'm':
       {
+        if(strcasecmp("fast", optarg) == 0)
+        {
+          // native filter; BoxFilter only marks mipmaps as enabled
+          filter_type = Magick::BoxFilter;
+          fast_mipmap = true;
+          break;
+        }
+
         // find matching mipmap filter type
         auto filter = std::lower_bound(std::begin(filter_type_strings),
                                        std::end(filter_type_strings),
@@ -1578,7 +1925,10 @@ ParseStatus parseOptions(std::vector<char*> &args)
 
         // set mipmap filter type option
         if(filter != std::end(filter_type_strings))
+        {
           filter_type = filter->second;
+          fast_mipmap = false;
+        }
         else
         {
           std::fprintf(stderr, "Invalid mipmap filter type '%s'\n", optarg);
@@ -1600,7 +1950,10 @@ ParseStatus parseOptions(std::vector<char*> &args)
 
       case 'q':
         // set ETC1 quality
-        if(strcasecmp("low", optarg) == 0)
+        etc1_packer = rg_etc1::pack_etc1_blocks;
+        if(strcasecmp("draft", optarg) == 0)
+          etc1_packer = etc1::draft;
+        else if(strcasecmp("low", optarg) == 0)
           etc1_quality = rg_etc1::cLowQuality;
         else if(strcasecmp("medium", optarg) == 0
              || strcasecmp("med", optarg) == 0)
@@ -1629,11 +1982,36 @@ ParseStatus parseOptions(std::vector<char*> &args)
         trim = true;
         break;
 
+      case 'T':
+      {
+        // set etc1 refinement time budget
+        char *end;
+        unsigned long value = std::strtoul(optarg, &end, 10);
+        if(*optarg == 0 || *end != 0 || value == 0 || value > UINT_MAX)
+        {
+          std::fprintf(stderr, "Invalid time budget '%s'\n", optarg);
+          return PARSE_FAILURE;
+        }
+
+        time_budget = value;
+        break;
+      }
+
+      case 'V':
+        // verbose
+        verbose = true;
+        break;
+
       case 'v':
         // print version
         print_version();
         return PARSE_EXIT;
 
+      case 'X':
+        // run every auto compression candidate
+        compress_exhaustive = true;
+        break;
+
       case 'z':
       {
         // find matching compression format
@@ -1715,6 +2093,9 @@ int main(int argc, char *argv[])
 
   try
   {
+    // start the worker threads; they are shared by every image we process
+    thread_pool.reset(new ThreadPool());
+
     std::vector<Magick::Image> images;
     if(process_mode == PROCESS_ATLAS)
     {
@@ -1740,12 +2121,27 @@ int main(int argc, char *argv[])
       images = load_image(img);
     }
 
+    // export the sub-images; this also gathers their alpha statistics
+    std::vector<Bitmap> bitmaps;
+    for(auto &img: images)
+      bitmaps.emplace_back(img);
+
     // finalize process format
-    finalize_process_format(images);
+    finalize_process_format(bitmaps);
 
-    // process each sub-image
-    for(size_t i = 0; i < images.size(); ++i)
-      process_image(images[i]);
+    // repeated blocks only need to be packed once
+    if(process_format == ETC1 || process_format == ETC1A4)
+      etc1_cache.reset(new BlockCache());
+
+    // process the sub-images
+    process_images(images, bitmaps);
+
+    if(verbose && etc1_cache)
+    {
+      std::fprintf(stderr, "ETC1 block cache: %zu hits, %zu misses%s\n",
+                   etc1_cache->hits(), etc1_cache->misses(),
+                   etc1_cache->enabled() ? "" : " (disabled)");
+    }
 
     // write output data
     write_output_data();
@@ -0,0 +1,186 @@
+/*------------------------------------------------------------------------------
+ * Copyright (c) 2017
+ *     Michael Theall (mtheall)
+ *
+ * This file is part of tex3ds.
+ *
+ * tex3ds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * tex3ds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with tex3ds.  If not, see <http://www.gnu.org/licenses/>.
+ *----------------------------------------------------------------------------*/
+/** @file mipmap.cpp
+ *  @brief Native mipmap generation
+ */
+#include <cstdint>
+#include "mipmap.h"
+#include "quantum.h"
+
+namespace
+{
+
+/** @brief 16-bit sRGB <-> linear conversion tables */
+struct GammaTables
+{
+  uint16_t to_linear[65536]; ///< sRGB to linear
+  uint16_t to_srgb[65536];   ///< Linear to sRGB
+
+  /** @brief Constructor */
+  GammaTables()
+  {
+    for(size_t i = 0; i < 65536; ++i)
+    {
+      to_linear[i] = gamma_inverse(i / 65535.0) * 65535.0 + 0.5;
+      to_srgb[i]   = gamma(i / 65535.0) * 65535.0 + 0.5;
+    }
+  }
+};
+
+/** @brief Get the gamma conversion tables
+ *  @returns gamma conversion tables
+ */
+const GammaTables& gamma_tables()
+{
+  static const GammaTables tables;
+  return tables;
+}
+
+/** @brief Widen a staging channel to 16 bits
+ *  @param[in] c Staging channel
+ *  @returns 16-bit channel
+ */
+inline uint16_t widen(Channel c)
+{
+  return c * (65535 / CHANNEL_MAX);
+}
+
+/** @brief Narrow a 16-bit channel to a staging channel
+ *  @param[in] v 16-bit channel
+ *  @returns staging channel
+ */
+inline Channel narrow(uint16_t v)
+{
+  return (v * CHANNEL_MAX + 32767) / 65535;
+}
+
+/** @brief Downsample a linear RGBA buffer by half in each dimension
+ *
+ *  @details
+ *  Every quad is first averaged with uniform weights, which is exact for
+ *  opaque and fully transparent quads and is a tight loop the compiler can
+ *  vectorize. The color of the few quads with mixed alpha is then averaged
+ *  again, weighted by alpha.
+ *
+ *  @param[in]  src    Source pixels
+ *  @param[in]  width  Source width
+ *  @param[in]  height Source height
+ *  @param[out] dst    Destination pixels
+ */
+void downsample(const uint16_t *__restrict src, size_t width, size_t height,
+                uint16_t *__restrict dst)
+{
+  const size_t stride = width * 4;
+  const size_t half   = width / 2;
+
+  for(size_t y = 0; y < height / 2; ++y, dst += half * 4)
+  {
+    const uint16_t *row0 = src + 2*y * stride;
+    const uint16_t *row1 = row0 + stride;
+
+    // uniform weights
+    for(size_t x = 0; x < half; ++x)
+    {
+      for(size_t c = 0; c < 4; ++c)
+      {
+        dst[x*4 + c] = (row0[x*8 + c] + row0[x*8 + c+4]
+                      + row1[x*8 + c] + row1[x*8 + c+4] + 2u) >> 2;
+      }
+    }
+
+    // weight color by alpha so transparent pixels don't bleed in
+    for(size_t x = 0; x < half; ++x)
+    {
+      const uint32_t a0 = row0[x*8 + 3], a1 = row0[x*8 + 7],
+                     a2 = row1[x*8 + 3], a3 = row1[x*8 + 7];
+      const uint32_t a  = a0 + a1 + a2 + a3;
+
+      if(a == 4*65535 || a == 0)
+        continue;
+
+      for(size_t c = 0; c < 3; ++c)
+      {
+        uint64_t sum = static_cast<uint64_t>(row0[x*8 + c])   * a0
+                     + static_cast<uint64_t>(row0[x*8 + c+4]) * a1
+                     + static_cast<uint64_t>(row1[x*8 + c])   * a2
+                     + static_cast<uint64_t>(row1[x*8 + c+4]) * a3;
+
+        dst[x*4 + c] = (sum + a/2) / a;
+      }
+    }
+  }
+}
+
+}
+
+namespace mipmap
+{
+
+std::vector<Bitmap> box_linear(const Bitmap &base)
+{
+  const GammaTables &tables = gamma_tables();
+
+  std::vector<Bitmap> mipmaps;
+
+  size_t width  = base.width();
+  size_t height = base.height();
+
+  // convert the base level to 16-bit linear light
+  std::vector<uint16_t> level(width * height * 4);
+  const Pixel *p = base.data();
+  for(size_t i = 0; i < width * height; ++i)
+  {
+    level[i*4 + 0] = tables.to_linear[widen(p[i].r)];
+    level[i*4 + 1] = tables.to_linear[widen(p[i].g)];
+    level[i*4 + 2] = tables.to_linear[widen(p[i].b)];
+    level[i*4 + 3] = widen(p[i].a);
+  }
+
+  std::vector<uint16_t> next;
+
+  // mipmaps must have both dimensions >= 8
+  while(width > 8 && height > 8)
+  {
+    // stay in linear light between levels
+    next.resize((width/2) * (height/2) * 4);
+    downsample(level.data(), width, height, next.data());
+    level.swap(next);
+
+    width  = width / 2;
+    height = height / 2;
+
+    // convert back to sRGB for the level
+    Bitmap mipmap(width, height);
+    Pixel  *q = mipmap.data();
+    for(size_t i = 0; i < width * height; ++i)
+    {
+      q[i].r = narrow(tables.to_srgb[level[i*4 + 0]]);
+      q[i].g = narrow(tables.to_srgb[level[i*4 + 1]]);
+      q[i].b = narrow(tables.to_srgb[level[i*4 + 2]]);
+      q[i].a = narrow(level[i*4 + 3]);
+    }
+
+    mipmaps.emplace_back(std::move(mipmap));
+  }
+
+  return mipmaps;
+}
+
+}
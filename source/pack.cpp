@@ -0,0 +1,660 @@
+/*------------------------------------------------------------------------------
+ * Copyright (c) 2017
+ *     Michael Theall (mtheall)
+ *
+ * This file is part of tex3ds.
+ *
+ * tex3ds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * tex3ds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with tex3ds.  If not, see <http://www.gnu.org/licenses/>.
+ *----------------------------------------------------------------------------*/
+/** @file pack.cpp
+ *  @brief Tile packing kernels
+ */
+#include <cstring>
+#include "format.h"
+#include "pack.h"
+#include "quantum.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define PACK_X86
+#elif defined(__ARM_NEON) && defined(PACK_ENABLE_NEON)
+// the NEON kernels are opt-in until tests/pack_check has run on hardware
+#include <arm_neon.h>
+#define PACK_NEON
+#endif
+
+namespace
+{
+
+/** @brief Scalar reference kernels */
+const pack::Kernels scalar =
+{
+  "scalar",
+  format::encode_tile<format::RGB565>,
+  format::encode_tile<format::RGBA5551>,
+  format::encode_tile<format::RGBA4444>,
+  format::encode_tile<format::LA44>,
+  format::encode_tile<format::L4>,
+  format::encode_tile<format::A4>,
+};
+
+#ifdef PACK_X86
+/* The x86 kernels work on RGBA8 pixels in 32-bit lanes; a 16-bit staging
+ * channel is narrowed by keeping its high byte, which is exactly
+ * channel_to_bits<8>(). The 16-bit results are sign-extended before
+ * _mm_packs_epi32() so the signed saturation never triggers.
+ *
+ * Eight consecutive Morton indices cover a 4x2 block of the tile, in the
+ * order top[0..1], bottom[0..1], top[2..3], bottom[2..3].
+ */
+
+/** @brief Load four pixels as RGBA8
+ *  @param[in] p Pixels to load
+ *  @returns RGBA8 pixels
+ */
+__attribute__((target("sse2")))
+inline __m128i load4_sse2(const Pixel *p)
+{
+  if(CHANNEL_BITS == 8)
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+
+  __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+  __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p) + 1);
+
+  return _mm_packus_epi16(_mm_srli_epi16(lo, 8), _mm_srli_epi16(hi, 8));
+}
+
+/** @brief Pack two sets of 32-bit lanes holding 16-bit values
+ *  @param[in] lo First four values
+ *  @param[in] hi Last four values
+ *  @returns eight 16-bit values
+ */
+__attribute__((target("sse2")))
+inline __m128i pack16_sse2(__m128i lo, __m128i hi)
+{
+  lo = _mm_srai_epi32(_mm_slli_epi32(lo, 16), 16);
+  hi = _mm_srai_epi32(_mm_slli_epi32(hi, 16), 16);
+  return _mm_packs_epi32(lo, hi);
+}
+
+__attribute__((target("sse2")))
+inline __m128i rgb565_sse2(__m128i v)
+{
+  __m128i r = _mm_slli_epi32(_mm_and_si128(v, _mm_set1_epi32(0xF8)), 8);
+  __m128i g = _mm_and_si128(_mm_srli_epi32(v, 5),  _mm_set1_epi32(0x07E0));
+  __m128i b = _mm_and_si128(_mm_srli_epi32(v, 19), _mm_set1_epi32(0x001F));
+
+  return _mm_or_si128(_mm_or_si128(r, g), b);
+}
+
+__attribute__((target("sse2")))
+inline __m128i rgba5551_sse2(__m128i v)
+{
+  __m128i r = _mm_slli_epi32(_mm_and_si128(v, _mm_set1_epi32(0xF8)), 8);
+  __m128i g = _mm_and_si128(_mm_srli_epi32(v, 5),  _mm_set1_epi32(0x07C0));
+  __m128i b = _mm_and_si128(_mm_srli_epi32(v, 18), _mm_set1_epi32(0x003E));
+  __m128i a = _mm_srli_epi32(v, 31);
+
+  return _mm_or_si128(_mm_or_si128(r, g), _mm_or_si128(b, a));
+}
+
+__attribute__((target("sse2")))
+inline __m128i rgba4444_sse2(__m128i v)
+{
+  __m128i r = _mm_slli_epi32(_mm_and_si128(v, _mm_set1_epi32(0xF0)), 8);
+  __m128i g = _mm_and_si128(_mm_srli_epi32(v, 4),  _mm_set1_epi32(0x0F00));
+  __m128i b = _mm_and_si128(_mm_srli_epi32(v, 16), _mm_set1_epi32(0x00F0));
+  __m128i a = _mm_srli_epi32(v, 28);
+
+  return _mm_or_si128(_mm_or_si128(r, g), _mm_or_si128(b, a));
+}
+
+/** @brief Pack a tile into 16-bit values, eight pixels per iteration
+ *  @tparam     convert Lane conversion
+ *  @param[in]  p       Tile pixel data
+ *  @param[in]  stride  Pixel data stride
+ *  @param[out] out     Output buffer
+ */
+template<__m128i (*convert)(__m128i)>
+__attribute__((target("sse2")))
+void pack16_tile_sse2(const Pixel *p, size_t stride, uint8_t *out)
+{
+  for(size_t r = 0; r < 8; ++r, out += 16)
+  {
+    const Pixel *q = p + morton_offset(8*r, stride);
+
+    __m128i top    = load4_sse2(q);
+    __m128i bottom = load4_sse2(q + stride);
+
+    __m128i lo = convert(_mm_unpacklo_epi64(top, bottom));
+    __m128i hi = convert(_mm_unpackhi_epi64(top, bottom));
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out), pack16_sse2(lo, hi));
+  }
+}
+
+/** @brief Get the alpha nibbles of a Morton group
+ *  @param[in] p      Tile pixel data
+ *  @param[in] stride Pixel data stride
+ *  @param[in] r      Morton group (eight pixels)
+ *  @returns alpha nibble of each pixel as eight 16-bit values
+ */
+__attribute__((target("sse2")))
+inline __m128i alpha4_sse2(const Pixel *p, size_t stride, size_t r)
+{
+  const Pixel *q = p + morton_offset(8*r, stride);
+
+  __m128i top    = load4_sse2(q);
+  __m128i bottom = load4_sse2(q + stride);
+
+  __m128i lo = _mm_srli_epi32(_mm_unpacklo_epi64(top, bottom), 28);
+  __m128i hi = _mm_srli_epi32(_mm_unpackhi_epi64(top, bottom), 28);
+
+  return _mm_packs_epi32(lo, hi);
+}
+
+/** @brief Load an 8x8 tile of bytes in Morton order
+ *  @param[in]  in  Tile bytes, row-major
+ *  @param[out] out Four vectors of 16 bytes, in Morton order
+ */
+__attribute__((target("sse2")))
+inline void morton8x8_sse2(const uint8_t *in, __m128i *out)
+{
+  for(size_t h = 0; h < 2; ++h)
+  {
+    // four rows, two per vector
+    __m128i r01 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + 32*h));
+    __m128i r23 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + 32*h + 16));
+
+    // 2x2 blocks, left to right
+    __m128i a01 = _mm_unpacklo_epi16(r01, _mm_srli_si128(r01, 8));
+    __m128i a23 = _mm_unpacklo_epi16(r23, _mm_srli_si128(r23, 8));
+
+    // 4x4 blocks, left to right
+    out[2*h + 0] = _mm_unpacklo_epi64(a01, a23);
+    out[2*h + 1] = _mm_unpackhi_epi64(a01, a23);
+  }
+}
+
+/** @brief Merge the high nibbles of each pair of bytes
+ *  @param[in] v Bytes
+ *  @returns merged pairs as eight 16-bit values; first byte in the low nibble
+ */
+__attribute__((target("sse2")))
+inline __m128i l4_pairs_sse2(__m128i v)
+{
+  __m128i lo = _mm_and_si128(_mm_srli_epi16(v, 4), _mm_set1_epi16(0x000F));
+  __m128i hi = _mm_and_si128(_mm_srli_epi16(v, 8), _mm_set1_epi16(0x00F0));
+
+  return _mm_or_si128(lo, hi);
+}
+
+__attribute__((target("sse2")))
+void la44_sse2(const Pixel *p, size_t stride, uint8_t *out)
+{
+  uint8_t lum[64];
+  luminance_tile(p, stride, lum);
+
+  __m128i l[4];
+  morton8x8_sse2(lum, l);
+
+  for(size_t r = 0; r < 8; r += 2, out += 16)
+  {
+    __m128i a = _mm_packus_epi16(alpha4_sse2(p, stride, r),
+                                 alpha4_sse2(p, stride, r + 1));
+
+    // luminance in the upper nibble, alpha in the lower nibble
+    __m128i v = _mm_and_si128(l[r/2], _mm_set1_epi8(static_cast<char>(0xF0)));
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_or_si128(v, a));
+  }
+}
+
+__attribute__((target("sse2")))
+void l4_sse2(const Pixel *p, size_t stride, uint8_t *out)
+{
+  uint8_t lum[64];
+  luminance_tile(p, stride, lum);
+
+  __m128i l[4];
+  morton8x8_sse2(lum, l);
+
+  for(size_t i = 0; i < 4; i += 2, out += 16)
+  {
+    __m128i v = _mm_packus_epi16(l4_pairs_sse2(l[i]), l4_pairs_sse2(l[i + 1]));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out), v);
+  }
+}
+
+__attribute__((target("sse2")))
+void a4_sse2(const Pixel *p, size_t stride, uint8_t *out)
+{
+  for(size_t r = 0; r < 8; ++r, out += 4)
+  {
+    // one nibble per byte, then merge each pair into one byte
+    __m128i v = alpha4_sse2(p, stride, r);
+    v = _mm_packus_epi16(v, v);
+    v = _mm_and_si128(_mm_or_si128(v, _mm_srli_epi16(v, 4)),
+                      _mm_set1_epi16(0x00FF));
+    v = _mm_packus_epi16(v, v);
+
+    uint32_t row = _mm_cvtsi128_si32(v);
+    std::memcpy(out, &row, sizeof(row));
+  }
+}
+
+/** @brief SSE2 kernels */
+const pack::Kernels sse2 =
+{
+  "sse2",
+  pack16_tile_sse2<rgb565_sse2>,
+  pack16_tile_sse2<rgba5551_sse2>,
+  pack16_tile_sse2<rgba4444_sse2>,
+  la44_sse2,
+  l4_sse2,
+  a4_sse2,
+};
+
+/** @brief Load a 4x2 block as eight RGBA8 pixels in Morton order
+ *  @param[in] p      Top-left pixel of the block
+ *  @param[in] stride Pixel data stride
+ *  @returns RGBA8 pixels
+ */
+__attribute__((target("avx2")))
+inline __m256i load4x2_avx2(const Pixel *p, size_t stride)
+{
+  if(CHANNEL_BITS == 8)
+  {
+    __m128i top    = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    __m128i bottom = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + stride));
+
+    return _mm256_inserti128_si256(
+             _mm256_castsi128_si256(_mm_unpacklo_epi64(top, bottom)),
+             _mm_unpackhi_epi64(top, bottom), 1);
+  }
+
+  __m256i top    = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+  __m256i bottom = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + stride));
+
+  // packs work within 128-bit lanes, which is exactly the Morton order here
+  return _mm256_packus_epi16(_mm256_srli_epi16(top, 8),
+                             _mm256_srli_epi16(bottom, 8));
+}
+
+__attribute__((target("avx2")))
+inline __m256i rgb565_avx2(__m256i v)
+{
+  __m256i r = _mm256_slli_epi32(_mm256_and_si256(v, _mm256_set1_epi32(0xF8)), 8);
+  __m256i g = _mm256_and_si256(_mm256_srli_epi32(v, 5),  _mm256_set1_epi32(0x07E0));
+  __m256i b = _mm256_and_si256(_mm256_srli_epi32(v, 19), _mm256_set1_epi32(0x001F));
+
+  return _mm256_or_si256(_mm256_or_si256(r, g), b);
+}
+
+__attribute__((target("avx2")))
+inline __m256i rgba5551_avx2(__m256i v)
+{
+  __m256i r = _mm256_slli_epi32(_mm256_and_si256(v, _mm256_set1_epi32(0xF8)), 8);
+  __m256i g = _mm256_and_si256(_mm256_srli_epi32(v, 5),  _mm256_set1_epi32(0x07C0));
+  __m256i b = _mm256_and_si256(_mm256_srli_epi32(v, 18), _mm256_set1_epi32(0x003E));
+  __m256i a = _mm256_srli_epi32(v, 31);
+
+  return _mm256_or_si256(_mm256_or_si256(r, g), _mm256_or_si256(b, a));
+}
+
+__attribute__((target("avx2")))
+inline __m256i rgba4444_avx2(__m256i v)
+{
+  __m256i r = _mm256_slli_epi32(_mm256_and_si256(v, _mm256_set1_epi32(0xF0)), 8);
+  __m256i g = _mm256_and_si256(_mm256_srli_epi32(v, 4),  _mm256_set1_epi32(0x0F00));
+  __m256i b = _mm256_and_si256(_mm256_srli_epi32(v, 16), _mm256_set1_epi32(0x00F0));
+  __m256i a = _mm256_srli_epi32(v, 28);
+
+  return _mm256_or_si256(_mm256_or_si256(r, g), _mm256_or_si256(b, a));
+}
+
+/** @brief Pack a tile into 16-bit values, 16 pixels per iteration
+ *  @tparam     convert Lane conversion
+ *  @param[in]  p       Tile pixel data
+ *  @param[in]  stride  Pixel data stride
+ *  @param[out] out     Output buffer
+ */
+template<__m256i (*convert)(__m256i)>
+__attribute__((target("avx2")))
+void pack16_tile_avx2(const Pixel *p, size_t stride, uint8_t *out)
+{
+  for(size_t r = 0; r < 8; r += 2, out += 32)
+  {
+    // Morton groups r and r+1 are the two 4x2 blocks of a 4x4 block
+    const Pixel *q = p + morton_offset(8*r, stride);
+
+    __m256i lo = convert(load4x2_avx2(q, stride));
+    __m256i hi = convert(load4x2_avx2(q + 2*stride, stride));
+
+    lo = _mm256_srai_epi32(_mm256_slli_epi32(lo, 16), 16);
+    hi = _mm256_srai_epi32(_mm256_slli_epi32(hi, 16), 16);
+
+    __m256i v = _mm256_packs_epi32(lo, hi);
+    v = _mm256_permute4x64_epi64(v, _MM_SHUFFLE(3, 1, 2, 0));
+
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), v);
+  }
+}
+
+/** @brief Load an 8x8 tile of bytes in Morton order
+ *  @param[in]  in  Tile bytes, row-major
+ *  @param[out] out Two vectors of 32 bytes, in Morton order
+ */
+__attribute__((target("avx2")))
+inline void morton8x8_avx2(const uint8_t *in, __m256i *out)
+{
+  for(size_t h = 0; h < 2; ++h)
+  {
+    // four rows, two per 128-bit lane
+    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + 32*h));
+
+    // 2x2 blocks, left to right, within each lane
+    v = _mm256_unpacklo_epi16(v, _mm256_srli_si256(v, 8));
+
+    // 4x4 blocks, left to right
+    out[h] = _mm256_permute4x64_epi64(v, _MM_SHUFFLE(3, 1, 2, 0));
+  }
+}
+
+__attribute__((target("avx2")))
+void la44_avx2(const Pixel *p, size_t stride, uint8_t *out)
+{
+  uint8_t lum[64];
+  luminance_tile(p, stride, lum);
+
+  __m256i l[2];
+  morton8x8_avx2(lum, l);
+
+  for(size_t h = 0; h < 2; ++h, out += 32)
+  {
+    // alpha nibbles of Morton groups 4h to 4h+3
+    __m256i a[4];
+    for(size_t g = 0; g < 4; ++g)
+    {
+      const Pixel *q = p + morton_offset(8*(4*h + g), stride);
+      a[g] = _mm256_srli_epi32(load4x2_avx2(q, stride), 28);
+    }
+
+    __m256i v = _mm256_packus_epi16(_mm256_packs_epi32(a[0], a[1]),
+                                    _mm256_packs_epi32(a[2], a[3]));
+
+    // each lane holds four pixels of every group
+    v = _mm256_permutevar8x32_epi32(v, _mm256_setr_epi32(0, 4, 1, 5,
+                                                         2, 6, 3, 7));
+
+    // luminance in the upper nibble, alpha in the lower nibble
+    v = _mm256_or_si256(v, _mm256_and_si256(l[h],
+                             _mm256_set1_epi8(static_cast<char>(0xF0))));
+
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), v);
+  }
+}
+
+__attribute__((target("avx2")))
+void l4_avx2(const Pixel *p, size_t stride, uint8_t *out)
+{
+  uint8_t lum[64];
+  luminance_tile(p, stride, lum);
+
+  __m256i l[2];
+  morton8x8_avx2(lum, l);
+
+  // merge the high nibbles of each pair of bytes; first byte in the low nibble
+  for(size_t h = 0; h < 2; ++h)
+  {
+    __m256i lo = _mm256_and_si256(_mm256_srli_epi16(l[h], 4),
+                                  _mm256_set1_epi16(0x000F));
+    __m256i hi = _mm256_and_si256(_mm256_srli_epi16(l[h], 8),
+                                  _mm256_set1_epi16(0x00F0));
+    l[h] = _mm256_or_si256(lo, hi);
+  }
+
+  __m256i v = _mm256_packus_epi16(l[0], l[1]);
+  v = _mm256_permute4x64_epi64(v, _MM_SHUFFLE(3, 1, 2, 0));
+
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), v);
+}
+
+/** @brief AVX2 kernels; A4 output is too narrow to gain over SSE2 */
+const pack::Kernels avx2 =
+{
+  "avx2",
+  pack16_tile_avx2<rgb565_avx2>,
+  pack16_tile_avx2<rgba5551_avx2>,
+  pack16_tile_avx2<rgba4444_avx2>,
+  la44_avx2,
+  l4_avx2,
+  a4_sse2,
+};
+#endif
+
+#ifdef PACK_NEON
+/** @brief Load eight pixels, one 16-bit vector per channel
+ *
+ *  @details
+ *  8-bit channels are widened into the high byte, so the kernels only deal
+ *  with 16-bit channels.
+ *
+ *  @param[in] p Pixels to load
+ *  @returns channels
+ */
+inline uint16x8x4_t load8_neon(const Pixel *p)
+{
+  if(CHANNEL_BITS == 16)
+    return vld4q_u16(reinterpret_cast<const uint16_t*>(p));
+
+  uint8x8x4_t  v = vld4_u8(reinterpret_cast<const uint8_t*>(p));
+  uint16x8x4_t w;
+  w.val[0] = vshll_n_u8(v.val[0], 8);
+  w.val[1] = vshll_n_u8(v.val[1], 8);
+  w.val[2] = vshll_n_u8(v.val[2], 8);
+  w.val[3] = vshll_n_u8(v.val[3], 8);
+  return w;
+}
+
+inline uint16x8_t rgb565_neon(uint16x8x4_t v)
+{
+  uint16x8_t r = vandq_u16(v.val[0], vdupq_n_u16(0xF800));
+  uint16x8_t g = vandq_u16(vshrq_n_u16(v.val[1], 5), vdupq_n_u16(0x07E0));
+  uint16x8_t b = vshrq_n_u16(v.val[2], 11);
+
+  return vorrq_u16(vorrq_u16(r, g), b);
+}
+
+inline uint16x8_t rgba5551_neon(uint16x8x4_t v)
+{
+  uint16x8_t r = vandq_u16(v.val[0], vdupq_n_u16(0xF800));
+  uint16x8_t g = vandq_u16(vshrq_n_u16(v.val[1], 5),  vdupq_n_u16(0x07C0));
+  uint16x8_t b = vandq_u16(vshrq_n_u16(v.val[2], 10), vdupq_n_u16(0x003E));
+  uint16x8_t a = vshrq_n_u16(v.val[3], 15);
+
+  return vorrq_u16(vorrq_u16(r, g), vorrq_u16(b, a));
+}
+
+inline uint16x8_t rgba4444_neon(uint16x8x4_t v)
+{
+  uint16x8_t r = vandq_u16(v.val[0], vdupq_n_u16(0xF000));
+  uint16x8_t g = vandq_u16(vshrq_n_u16(v.val[1], 4), vdupq_n_u16(0x0F00));
+  uint16x8_t b = vandq_u16(vshrq_n_u16(v.val[2], 8), vdupq_n_u16(0x00F0));
+  uint16x8_t a = vshrq_n_u16(v.val[3], 12);
+
+  return vorrq_u16(vorrq_u16(r, g), vorrq_u16(b, a));
+}
+
+/** @brief Gather a 4x2 block in Morton order
+ *  @param[in]  p      Top-left pixel of the block
+ *  @param[in]  stride Pixel data stride
+ *  @param[out] out    Gathered pixels
+ */
+inline void gather4x2(const Pixel *p, size_t stride, Pixel *out)
+{
+  std::memcpy(out + 0, p,              2 * sizeof(Pixel));
+  std::memcpy(out + 2, p + stride,     2 * sizeof(Pixel));
+  std::memcpy(out + 4, p + 2,          2 * sizeof(Pixel));
+  std::memcpy(out + 6, p + stride + 2, 2 * sizeof(Pixel));
+}
+
+/** @brief Pack a tile into 16-bit values, eight pixels per iteration
+ *  @tparam     convert Row conversion
+ *  @param[in]  p       Tile pixel data
+ *  @param[in]  stride  Pixel data stride
+ *  @param[out] out     Output buffer
+ */
+template<uint16x8_t (*convert)(uint16x8x4_t)>
+void pack16_tile_neon(const Pixel *p, size_t stride, uint8_t *out)
+{
+  for(size_t r = 0; r < 8; ++r, out += 16)
+  {
+    Pixel block[8];
+    gather4x2(p + morton_offset(8*r, stride), stride, block);
+
+    // output is little-endian
+    uint8x16_t v = vreinterpretq_u8_u16(convert(load8_neon(block)));
+    vst1q_u8(out, v);
+  }
+}
+
+void a4_neon(const Pixel *p, size_t stride, uint8_t *out)
+{
+  for(size_t r = 0; r < 8; r += 2, out += 8)
+  {
+    Pixel block[16];
+    gather4x2(p + morton_offset(8*r, stride),     stride, block);
+    gather4x2(p + morton_offset(8*r + 8, stride), stride, block + 8);
+
+    // alpha nibble of each pixel, two Morton groups
+    uint8x8_t lo = vmovn_u16(vshrq_n_u16(load8_neon(block).val[3], 12));
+    uint8x8_t hi = vmovn_u16(vshrq_n_u16(load8_neon(block + 8).val[3], 12));
+
+    // merge each pair into one byte
+    uint16x8_t v = vreinterpretq_u16_u8(vcombine_u8(lo, hi));
+    v = vorrq_u16(v, vshrq_n_u16(v, 4));
+    vst1_u8(out, vmovn_u16(v));
+  }
+}
+
+/** @brief Load an 8x8 tile of bytes in Morton order
+ *  @param[in]  in  Tile bytes, row-major
+ *  @param[out] out Four vectors of 16 bytes, in Morton order
+ */
+inline void morton8x8_neon(const uint8_t *in, uint8x16_t *out)
+{
+  for(size_t h = 0; h < 2; ++h)
+  {
+    const uint8_t *rows = in + 32*h;
+
+    // 2x2 blocks, left to right
+    uint16x4x2_t a01 = vzip_u16(vreinterpret_u16_u8(vld1_u8(rows)),
+                                vreinterpret_u16_u8(vld1_u8(rows + 8)));
+    uint16x4x2_t a23 = vzip_u16(vreinterpret_u16_u8(vld1_u8(rows + 16)),
+                                vreinterpret_u16_u8(vld1_u8(rows + 24)));
+
+    // 4x4 blocks, left to right
+    out[2*h + 0] = vreinterpretq_u8_u16(vcombine_u16(a01.val[0], a23.val[0]));
+    out[2*h + 1] = vreinterpretq_u8_u16(vcombine_u16(a01.val[1], a23.val[1]));
+  }
+}
+
+void la44_neon(const Pixel *p, size_t stride, uint8_t *out)
+{
+  uint8_t lum[64];
+  luminance_tile(p, stride, lum);
+
+  uint8x16_t l[4];
+  morton8x8_neon(lum, l);
+
+  for(size_t r = 0; r < 8; r += 2, out += 16)
+  {
+    Pixel block[16];
+    gather4x2(p + morton_offset(8*r, stride),     stride, block);
+    gather4x2(p + morton_offset(8*r + 8, stride), stride, block + 8);
+
+    // 8-bit alpha of each pixel, two Morton groups
+    uint8x16_t a = vcombine_u8(vshrn_n_u16(load8_neon(block).val[3], 8),
+                               vshrn_n_u16(load8_neon(block + 8).val[3], 8));
+
+    // luminance in the upper nibble, alpha in the lower nibble
+    vst1q_u8(out, vsriq_n_u8(l[r/2], a, 4));
+  }
+}
+
+void l4_neon(const Pixel *p, size_t stride, uint8_t *out)
+{
+  uint8_t lum[64];
+  luminance_tile(p, stride, lum);
+
+  uint8x16_t l[4];
+  morton8x8_neon(lum, l);
+
+  for(size_t i = 0; i < 4; ++i, out += 8)
+  {
+    // second byte of each pair in the upper nibble, first in the lower
+    uint16x8_t v = vreinterpretq_u16_u8(l[i]);
+    vst1_u8(out, vsri_n_u8(vshrn_n_u16(v, 8), vmovn_u16(v), 4));
+  }
+}
+
+/** @brief NEON kernels */
+const pack::Kernels neon =
+{
+  "neon",
+  pack16_tile_neon<rgb565_neon>,
+  pack16_tile_neon<rgba5551_neon>,
+  pack16_tile_neon<rgba4444_neon>,
+  la44_neon,
+  l4_neon,
+  a4_neon,
+};
+#endif
+
+}
+
+namespace pack
+{
+
+const Kernels& kernels()
+{
+  static const Kernels &selected = *supported_kernels().front();
+  return selected;
+}
+
+const Kernels& scalar_kernels()
+{
+  return scalar;
+}
+
+std::vector<const Kernels*> supported_kernels()
+{
+  std::vector<const Kernels*> supported;
+
+#if defined(PACK_X86)
+  __builtin_cpu_init();
+  if(__builtin_cpu_supports("avx2"))
+    supported.push_back(&avx2);
+  if(__builtin_cpu_supports("sse2"))
+    supported.push_back(&sse2);
+#elif defined(PACK_NEON)
+  supported.push_back(&neon);
+#endif
+
+  supported.push_back(&scalar);
+  return supported;
+}
+
+}
@@ -0,0 +1,188 @@
+/*------------------------------------------------------------------------------
+ * Copyright (c) 2017
+ *     Michael Theall (mtheall)
+ *
+ * This file is part of tex3ds.
+ *
+ * tex3ds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * tex3ds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with tex3ds.  If not, see <http://www.gnu.org/licenses/>.
+ *----------------------------------------------------------------------------*/
+/** @file quantum.cpp
+ *  @brief Table-driven luminance
+ */
+#include <cstring>
+#include <limits>
+#include "quantum.h"
+
+namespace
+{
+
+// ITU Recommendation BT.709
+const double RED   = 0.212655; ///< Red weight
+const double GREEN = 0.715158; ///< Green weight
+const double BLUE  = 0.072187; ///< Blue weight
+
+/** @brief Number of buckets in the threshold search table */
+const size_t BUCKETS = 65536;
+
+/** @brief Luminance tables
+ *
+ *  @details
+ *  The 8-bit luminance of a pixel only depends on which pair of thresholds
+ *  its linear luminance falls between, so the sRGB encode is replaced by a
+ *  search over 256 thresholds. Each threshold is the smallest double for
+ *  which the gamma-corrected luminance quantizes to that value, found by
+ *  bisecting over the doubles themselves, so the result is bit-identical to
+ *  evaluating gamma() on every pixel.
+ */
+struct LuminanceTables
+{
+  double  linear[CHANNEL_MAX+1]; ///< Linear value of each channel value
+  double  threshold[257];        ///< Smallest linear luminance for each value
+  uint8_t bucket[BUCKETS+1];     ///< Luminance at the start of each bucket
+
+  /** @brief Constructor */
+  LuminanceTables()
+  {
+    for(size_t i = 0; i <= CHANNEL_MAX; ++i)
+      linear[i] = gamma_inverse(static_cast<double>(i) / CHANNEL_MAX);
+
+    threshold[0]   = -std::numeric_limits<double>::infinity();
+    threshold[256] = std::numeric_limits<double>::infinity();
+    for(unsigned k = 1; k < 256; ++k)
+      threshold[k] = find_threshold(k);
+
+    // buckets are narrower than the closest pair of thresholds, so at most
+    // one threshold lies inside any bucket
+    unsigned k = 0;
+    for(size_t i = 0; i <= BUCKETS; ++i)
+    {
+      while(threshold[k+1] <= static_cast<double>(i) / BUCKETS)
+        ++k;
+      bucket[i] = k;
+    }
+  }
+
+  /** @brief Quantize linear luminance the way luminance encoding always has
+   *  @param[in] y Linear luminance
+   *  @returns 8-bit luminance
+   */
+  static uint8_t quantize(double y)
+  {
+    double v = gamma(y);
+
+    Channel c = std::max(0.0, std::min(1.0, v)) * CHANNEL_MAX;
+    return channel_to_bits<8>(c);
+  }
+
+  /** @brief Find the smallest linear luminance that quantizes to a value
+   *  @param[in] k 8-bit luminance
+   *  @returns threshold
+   */
+  static double find_threshold(unsigned k)
+  {
+    // non-negative doubles order the same as their bit patterns; the upper
+    // bound is past 1 because gamma(1.0) rounds to just below 1
+    uint64_t lo = 0, hi;
+    double   two = 2.0;
+    std::memcpy(&hi, &two, sizeof(hi));
+
+    while(lo < hi)
+    {
+      uint64_t mid = lo + (hi - lo) / 2;
+      double   y;
+      std::memcpy(&y, &mid, sizeof(y));
+
+      if(quantize(y) >= k)
+        hi = mid;
+      else
+        lo = mid + 1;
+    }
+
+    double y;
+    std::memcpy(&y, &lo, sizeof(y));
+    return y;
+  }
+
+  /** @brief Get the bucket of a linear luminance
+   *
+   *  @details
+   *  Linear luminance is never negative and at most a rounding error above
+   *  1, so it is clamped after the conversion, in integers; a clamp of the
+   *  double keeps the compiler from vectorizing the luminance loop.
+   *
+   *  @param[in] y Linear luminance
+   *  @returns bucket index
+   */
+  static int32_t bucket_index(double y)
+  {
+    // scaling by a power of two is exact, so y is inside this bucket
+    int32_t i = y * BUCKETS;
+    return i < static_cast<int32_t>(BUCKETS) ? i : BUCKETS;
+  }
+
+  /** @brief Look up the 8-bit luminance of a linear luminance
+   *  @param[in] y Linear luminance
+   *  @param[in] i Bucket index of y
+   *  @returns 8-bit luminance
+   */
+  uint8_t lookup(double y, int32_t i) const
+  {
+    unsigned k = bucket[i];
+    if(y >= threshold[k+1])
+      ++k;
+
+    return k;
+  }
+};
+
+/** @brief Get the luminance tables
+ *  @returns luminance tables
+ */
+const LuminanceTables& luminance_tables()
+{
+  static const LuminanceTables tables;
+  return tables;
+}
+
+}
+
+void luminance_tile(const Pixel *p, size_t stride, uint8_t *out)
+{
+  const LuminanceTables &tables = luminance_tables();
+
+  // the table lookups are gathers, which only AVX2 could vectorize, so they
+  // are kept apart from the arithmetic to let it vectorize on its own
+  double r[64], g[64], b[64];
+  for(size_t j = 0; j < 8; ++j, p += stride)
+  {
+    for(size_t i = 0; i < 8; ++i)
+    {
+      r[j*8 + i] = tables.linear[p[i].r];
+      g[j*8 + i] = tables.linear[p[i].g];
+      b[j*8 + i] = tables.linear[p[i].b];
+    }
+  }
+
+  // linear luminance; same expression as the gamma-corrected formula
+  double  y[64];
+  int32_t index[64];
+  for(size_t i = 0; i < 64; ++i)
+  {
+    y[i]     = RED * r[i] + GREEN * g[i] + BLUE * b[i];
+    index[i] = LuminanceTables::bucket_index(y[i]);
+  }
+
+  for(size_t i = 0; i < 64; ++i)
+    out[i] = tables.lookup(y[i], index[i]);
+}
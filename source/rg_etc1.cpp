@@ -17,6 +17,16 @@
 #include <cstdint>
 #include <cstring>
 
+// Define RG_ETC1_NO_SIMD to always use the scalar selector kernels. The NEON kernels are opt-in with RG_ETC1_ENABLE_NEON
+// until tests/etc1_check has run on ARM hardware.
+#if !defined(RG_ETC1_NO_SIMD) && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define RG_ETC1_X86
+#elif !defined(RG_ETC1_NO_SIMD) && defined(RG_ETC1_ENABLE_NEON) && defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define RG_ETC1_NEON
+#endif
+
 #if defined(_WIN32) || defined(WIN32)
 #pragma warning (disable: 4201) //  nonstandard extension used : nameless struct/union
 #endif
@@ -367,8 +377,6 @@ namespace rg_etc1
       // 0   1   2   3   -4  -3  -2  -1
    };
 
-   static uint8_t g_quant5_tab[256+16];
-
    static const int g_etc1_inten_tables[cETC1IntenModifierValues][cETC1SelectorValues] =
    {
       { -8,  -2,   2,   8 }, { -17,  -5,  5,  17 }, { -29,  -9,   9,  29 }, {  -42, -13, 13,  42 },
@@ -378,8 +386,1249 @@ namespace rg_etc1
    static const uint8_t g_etc1_to_selector_index[cETC1SelectorValues] = { 2, 3, 1, 0 };
    static const uint8_t g_selector_index_to_etc1[cETC1SelectorValues] = { 3, 2, 0, 1 };
 
+   // Precomputed so processes start without building them. generate_etc1_tables() holds the loops that build them; make check
+   // compares the two, and "tests/etc1_check --print-tables" prints the source from g_quant5_tab to the end of g_etc1_inverse_lookup.
+   static const uint8_t g_quant5_tab[256+16] =
+   {
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08,
+      0x08, 0x08, 0x08, 0x08, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x18, 0x18, 0x18,
+      0x18, 0x18, 0x18, 0x18, 0x18, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x29, 0x29,
+      0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x39, 0x39,
+      0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x4A, 0x4A,
+      0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x5A,
+      0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x6B,
+      0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73,
+      0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
+      0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94,
+      0x94, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+      0xA5, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5,
+      0xB5, 0xB5, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6,
+      0xC6, 0xC6, 0xCE, 0xCE, 0xCE, 0xCE, 0xCE, 0xCE, 0xCE, 0xCE, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6,
+      0xD6, 0xD6, 0xDE, 0xDE, 0xDE, 0xDE, 0xDE, 0xDE, 0xDE, 0xDE, 0xDE, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7,
+      0xE7, 0xE7, 0xE7, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+      0xF7, 0xF7, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   };
+
    // Given an ETC1 diff/inten_table/selector, and an 8-bit desired color, this table encodes the best packed_color in the low byte, and the abs error in the high byte.
-   static uint16_t g_etc1_inverse_lookup[2*8*4][256];      // [diff/inten_table/selector][desired_color]
+   static const uint16_t g_etc1_inverse_lookup[2*8*4][256] =      // [diff/inten_table/selector][desired_color]
+   {
+      // diff 0, inten_table 0, selector 0
+      {
+         0x0000, 0x0100, 0x0200, 0x0300, 0x0400, 0x0401, 0x0301, 0x0201, 0x0101, 0x0001, 0x0101, 0x0201, 0x0301, 0x0401, 0x0501, 0x0601,
+         0x0701, 0x0801, 0x0802, 0x0702, 0x0602, 0x0502, 0x0402, 0x0302, 0x0202, 0x0102, 0x0002, 0x0102, 0x0202, 0x0302, 0x0402, 0x0502,
+         0x0602, 0x0702, 0x0802, 0x0803, 0x0703, 0x0603, 0x0503, 0x0403, 0x0303, 0x0203, 0x0103, 0x0003, 0x0103, 0x0203, 0x0303, 0x0403,
+         0x0503, 0x0603, 0x0703, 0x0803, 0x0804, 0x0704, 0x0604, 0x0504, 0x0404, 0x0304, 0x0204, 0x0104, 0x0004, 0x0104, 0x0204, 0x0304,
+         0x0404, 0x0504, 0x0604, 0x0704, 0x0804, 0x0805, 0x0705, 0x0605, 0x0505, 0x0405, 0x0305, 0x0205, 0x0105, 0x0005, 0x0105, 0x0205,
+         0x0305, 0x0405, 0x0505, 0x0605, 0x0705, 0x0805, 0x0806, 0x0706, 0x0606, 0x0506, 0x0406, 0x0306, 0x0206, 0x0106, 0x0006, 0x0106,
+         0x0206, 0x0306, 0x0406, 0x0506, 0x0606, 0x0706, 0x0806, 0x0807, 0x0707, 0x0607, 0x0507, 0x0407, 0x0307, 0x0207, 0x0107, 0x0007,
+         0x0107, 0x0207, 0x0307, 0x0407, 0x0507, 0x0607, 0x0707, 0x0807, 0x0808, 0x0708, 0x0608, 0x0508, 0x0408, 0x0308, 0x0208, 0x0108,
+         0x0008, 0x0108, 0x0208, 0x0308, 0x0408, 0x0508, 0x0608, 0x0708, 0x0808, 0x0809, 0x0709, 0x0609, 0x0509, 0x0409, 0x0309, 0x0209,
+         0x0109, 0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709, 0x0809, 0x080A, 0x070A, 0x060A, 0x050A, 0x040A, 0x030A,
+         0x020A, 0x010A, 0x000A, 0x010A, 0x020A, 0x030A, 0x040A, 0x050A, 0x060A, 0x070A, 0x080A, 0x080B, 0x070B, 0x060B, 0x050B, 0x040B,
+         0x030B, 0x020B, 0x010B, 0x000B, 0x010B, 0x020B, 0x030B, 0x040B, 0x050B, 0x060B, 0x070B, 0x080B, 0x080C, 0x070C, 0x060C, 0x050C,
+         0x040C, 0x030C, 0x020C, 0x010C, 0x000C, 0x010C, 0x020C, 0x030C, 0x040C, 0x050C, 0x060C, 0x070C, 0x080C, 0x080D, 0x070D, 0x060D,
+         0x050D, 0x040D, 0x030D, 0x020D, 0x010D, 0x000D, 0x010D, 0x020D, 0x030D, 0x040D, 0x050D, 0x060D, 0x070D, 0x080D, 0x080E, 0x070E,
+         0x060E, 0x050E, 0x040E, 0x030E, 0x020E, 0x010E, 0x000E, 0x010E, 0x020E, 0x030E, 0x040E, 0x050E, 0x060E, 0x070E, 0x080E, 0x080F,
+         0x070F, 0x060F, 0x050F, 0x040F, 0x030F, 0x020F, 0x010F, 0x000F, 0x010F, 0x020F, 0x030F, 0x040F, 0x050F, 0x060F, 0x070F, 0x080F,
+      },
+      // diff 1, inten_table 0, selector 0
+      {
+         0x0000, 0x0100, 0x0200, 0x0300, 0x0400, 0x0302, 0x0202, 0x0102, 0x0002, 0x0102, 0x0202, 0x0302, 0x0402, 0x0303, 0x0203, 0x0103,
+         0x0003, 0x0103, 0x0203, 0x0303, 0x0403, 0x0404, 0x0304, 0x0204, 0x0104, 0x0004, 0x0104, 0x0204, 0x0304, 0x0404, 0x0305, 0x0205,
+         0x0105, 0x0005, 0x0105, 0x0205, 0x0305, 0x0405, 0x0306, 0x0206, 0x0106, 0x0006, 0x0106, 0x0206, 0x0306, 0x0406, 0x0307, 0x0207,
+         0x0107, 0x0007, 0x0107, 0x0207, 0x0307, 0x0407, 0x0408, 0x0308, 0x0208, 0x0108, 0x0008, 0x0108, 0x0208, 0x0308, 0x0408, 0x0309,
+         0x0209, 0x0109, 0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x030A, 0x020A, 0x010A, 0x000A, 0x010A, 0x020A, 0x030A, 0x040A, 0x030B,
+         0x020B, 0x010B, 0x000B, 0x010B, 0x020B, 0x030B, 0x040B, 0x040C, 0x030C, 0x020C, 0x010C, 0x000C, 0x010C, 0x020C, 0x030C, 0x040C,
+         0x030D, 0x020D, 0x010D, 0x000D, 0x010D, 0x020D, 0x030D, 0x040D, 0x030E, 0x020E, 0x010E, 0x000E, 0x010E, 0x020E, 0x030E, 0x040E,
+         0x030F, 0x020F, 0x010F, 0x000F, 0x010F, 0x020F, 0x030F, 0x040F, 0x0410, 0x0310, 0x0210, 0x0110, 0x0010, 0x0110, 0x0210, 0x0310,
+         0x0410, 0x0311, 0x0211, 0x0111, 0x0011, 0x0111, 0x0211, 0x0311, 0x0411, 0x0312, 0x0212, 0x0112, 0x0012, 0x0112, 0x0212, 0x0312,
+         0x0412, 0x0313, 0x0213, 0x0113, 0x0013, 0x0113, 0x0213, 0x0313, 0x0413, 0x0414, 0x0314, 0x0214, 0x0114, 0x0014, 0x0114, 0x0214,
+         0x0314, 0x0414, 0x0315, 0x0215, 0x0115, 0x0015, 0x0115, 0x0215, 0x0315, 0x0415, 0x0316, 0x0216, 0x0116, 0x0016, 0x0116, 0x0216,
+         0x0316, 0x0416, 0x0317, 0x0217, 0x0117, 0x0017, 0x0117, 0x0217, 0x0317, 0x0417, 0x0418, 0x0318, 0x0218, 0x0118, 0x0018, 0x0118,
+         0x0218, 0x0318, 0x0418, 0x0319, 0x0219, 0x0119, 0x0019, 0x0119, 0x0219, 0x0319, 0x0419, 0x031A, 0x021A, 0x011A, 0x001A, 0x011A,
+         0x021A, 0x031A, 0x041A, 0x031B, 0x021B, 0x011B, 0x001B, 0x011B, 0x021B, 0x031B, 0x041B, 0x041C, 0x031C, 0x021C, 0x011C, 0x001C,
+         0x011C, 0x021C, 0x031C, 0x041C, 0x031D, 0x021D, 0x011D, 0x001D, 0x011D, 0x021D, 0x031D, 0x041D, 0x031E, 0x021E, 0x011E, 0x001E,
+         0x011E, 0x021E, 0x031E, 0x041E, 0x031F, 0x021F, 0x011F, 0x001F, 0x011F, 0x021F, 0x031F, 0x041F, 0x051F, 0x061F, 0x071F, 0x081F,
+      },
+      // diff 0, inten_table 1, selector 0
+      {
+         0x0000, 0x0100, 0x0200, 0x0300, 0x0400, 0x0500, 0x0600, 0x0700, 0x0800, 0x0802, 0x0702, 0x0602, 0x0502, 0x0402, 0x0302, 0x0202,
+         0x0102, 0x0002, 0x0102, 0x0202, 0x0302, 0x0402, 0x0502, 0x0602, 0x0702, 0x0802, 0x0803, 0x0703, 0x0603, 0x0503, 0x0403, 0x0303,
+         0x0203, 0x0103, 0x0003, 0x0103, 0x0203, 0x0303, 0x0403, 0x0503, 0x0603, 0x0703, 0x0803, 0x0804, 0x0704, 0x0604, 0x0504, 0x0404,
+         0x0304, 0x0204, 0x0104, 0x0004, 0x0104, 0x0204, 0x0304, 0x0404, 0x0504, 0x0604, 0x0704, 0x0804, 0x0805, 0x0705, 0x0605, 0x0505,
+         0x0405, 0x0305, 0x0205, 0x0105, 0x0005, 0x0105, 0x0205, 0x0305, 0x0405, 0x0505, 0x0605, 0x0705, 0x0805, 0x0806, 0x0706, 0x0606,
+         0x0506, 0x0406, 0x0306, 0x0206, 0x0106, 0x0006, 0x0106, 0x0206, 0x0306, 0x0406, 0x0506, 0x0606, 0x0706, 0x0806, 0x0807, 0x0707,
+         0x0607, 0x0507, 0x0407, 0x0307, 0x0207, 0x0107, 0x0007, 0x0107, 0x0207, 0x0307, 0x0407, 0x0507, 0x0607, 0x0707, 0x0807, 0x0808,
+         0x0708, 0x0608, 0x0508, 0x0408, 0x0308, 0x0208, 0x0108, 0x0008, 0x0108, 0x0208, 0x0308, 0x0408, 0x0508, 0x0608, 0x0708, 0x0808,
+         0x0809, 0x0709, 0x0609, 0x0509, 0x0409, 0x0309, 0x0209, 0x0109, 0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709,
+         0x0809, 0x080A, 0x070A, 0x060A, 0x050A, 0x040A, 0x030A, 0x020A, 0x010A, 0x000A, 0x010A, 0x020A, 0x030A, 0x040A, 0x050A, 0x060A,
+         0x070A, 0x080A, 0x080B, 0x070B, 0x060B, 0x050B, 0x040B, 0x030B, 0x020B, 0x010B, 0x000B, 0x010B, 0x020B, 0x030B, 0x040B, 0x050B,
+         0x060B, 0x070B, 0x080B, 0x080C, 0x070C, 0x060C, 0x050C, 0x040C, 0x030C, 0x020C, 0x010C, 0x000C, 0x010C, 0x020C, 0x030C, 0x040C,
+         0x050C, 0x060C, 0x070C, 0x080C, 0x080D, 0x070D, 0x060D, 0x050D, 0x040D, 0x030D, 0x020D, 0x010D, 0x000D, 0x010D, 0x020D, 0x030D,
+         0x040D, 0x050D, 0x060D, 0x070D, 0x080D, 0x080E, 0x070E, 0x060E, 0x050E, 0x040E, 0x030E, 0x020E, 0x010E, 0x000E, 0x010E, 0x020E,
+         0x030E, 0x040E, 0x050E, 0x060E, 0x070E, 0x080E, 0x080F, 0x070F, 0x060F, 0x050F, 0x040F, 0x030F, 0x020F, 0x010F, 0x000F, 0x010F,
+         0x020F, 0x030F, 0x040F, 0x050F, 0x060F, 0x070F, 0x080F, 0x090F, 0x0A0F, 0x0B0F, 0x0C0F, 0x0D0F, 0x0E0F, 0x0F0F, 0x100F, 0x110F,
+      },
+      // diff 1, inten_table 1, selector 0
+      {
+         0x0000, 0x0100, 0x0200, 0x0300, 0x0303, 0x0203, 0x0103, 0x0003, 0x0103, 0x0203, 0x0303, 0x0403, 0x0404, 0x0304, 0x0204, 0x0104,
+         0x0004, 0x0104, 0x0204, 0x0304, 0x0404, 0x0305, 0x0205, 0x0105, 0x0005, 0x0105, 0x0205, 0x0305, 0x0405, 0x0306, 0x0206, 0x0106,
+         0x0006, 0x0106, 0x0206, 0x0306, 0x0406, 0x0307, 0x0207, 0x0107, 0x0007, 0x0107, 0x0207, 0x0307, 0x0407, 0x0408, 0x0308, 0x0208,
+         0x0108, 0x0008, 0x0108, 0x0208, 0x0308, 0x0408, 0x0309, 0x0209, 0x0109, 0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x030A, 0x020A,
+         0x010A, 0x000A, 0x010A, 0x020A, 0x030A, 0x040A, 0x030B, 0x020B, 0x010B, 0x000B, 0x010B, 0x020B, 0x030B, 0x040B, 0x040C, 0x030C,
+         0x020C, 0x010C, 0x000C, 0x010C, 0x020C, 0x030C, 0x040C, 0x030D, 0x020D, 0x010D, 0x000D, 0x010D, 0x020D, 0x030D, 0x040D, 0x030E,
+         0x020E, 0x010E, 0x000E, 0x010E, 0x020E, 0x030E, 0x040E, 0x030F, 0x020F, 0x010F, 0x000F, 0x010F, 0x020F, 0x030F, 0x040F, 0x0410,
+         0x0310, 0x0210, 0x0110, 0x0010, 0x0110, 0x0210, 0x0310, 0x0410, 0x0311, 0x0211, 0x0111, 0x0011, 0x0111, 0x0211, 0x0311, 0x0411,
+         0x0312, 0x0212, 0x0112, 0x0012, 0x0112, 0x0212, 0x0312, 0x0412, 0x0313, 0x0213, 0x0113, 0x0013, 0x0113, 0x0213, 0x0313, 0x0413,
+         0x0414, 0x0314, 0x0214, 0x0114, 0x0014, 0x0114, 0x0214, 0x0314, 0x0414, 0x0315, 0x0215, 0x0115, 0x0015, 0x0115, 0x0215, 0x0315,
+         0x0415, 0x0316, 0x0216, 0x0116, 0x0016, 0x0116, 0x0216, 0x0316, 0x0416, 0x0317, 0x0217, 0x0117, 0x0017, 0x0117, 0x0217, 0x0317,
+         0x0417, 0x0418, 0x0318, 0x0218, 0x0118, 0x0018, 0x0118, 0x0218, 0x0318, 0x0418, 0x0319, 0x0219, 0x0119, 0x0019, 0x0119, 0x0219,
+         0x0319, 0x0419, 0x031A, 0x021A, 0x011A, 0x001A, 0x011A, 0x021A, 0x031A, 0x041A, 0x031B, 0x021B, 0x011B, 0x001B, 0x011B, 0x021B,
+         0x031B, 0x041B, 0x041C, 0x031C, 0x021C, 0x011C, 0x001C, 0x011C, 0x021C, 0x031C, 0x041C, 0x031D, 0x021D, 0x011D, 0x001D, 0x011D,
+         0x021D, 0x031D, 0x041D, 0x031E, 0x021E, 0x011E, 0x001E, 0x011E, 0x021E, 0x031E, 0x041E, 0x031F, 0x021F, 0x011F, 0x001F, 0x011F,
+         0x021F, 0x031F, 0x041F, 0x051F, 0x061F, 0x071F, 0x081F, 0x091F, 0x0A1F, 0x0B1F, 0x0C1F, 0x0D1F, 0x0E1F, 0x0F1F, 0x101F, 0x111F,
+      },
+      // diff 0, inten_table 2, selector 0
+      {
+         0x0000, 0x0100, 0x0200, 0x0202, 0x0102, 0x0002, 0x0102, 0x0202, 0x0302, 0x0402, 0x0502, 0x0602, 0x0702, 0x0802, 0x0803, 0x0703,
+         0x0603, 0x0503, 0x0403, 0x0303, 0x0203, 0x0103, 0x0003, 0x0103, 0x0203, 0x0303, 0x0403, 0x0503, 0x0603, 0x0703, 0x0803, 0x0804,
+         0x0704, 0x0604, 0x0504, 0x0404, 0x0304, 0x0204, 0x0104, 0x0004, 0x0104, 0x0204, 0x0304, 0x0404, 0x0504, 0x0604, 0x0704, 0x0804,
+         0x0805, 0x0705, 0x0605, 0x0505, 0x0405, 0x0305, 0x0205, 0x0105, 0x0005, 0x0105, 0x0205, 0x0305, 0x0405, 0x0505, 0x0605, 0x0705,
+         0x0805, 0x0806, 0x0706, 0x0606, 0x0506, 0x0406, 0x0306, 0x0206, 0x0106, 0x0006, 0x0106, 0x0206, 0x0306, 0x0406, 0x0506, 0x0606,
+         0x0706, 0x0806, 0x0807, 0x0707, 0x0607, 0x0507, 0x0407, 0x0307, 0x0207, 0x0107, 0x0007, 0x0107, 0x0207, 0x0307, 0x0407, 0x0507,
+         0x0607, 0x0707, 0x0807, 0x0808, 0x0708, 0x0608, 0x0508, 0x0408, 0x0308, 0x0208, 0x0108, 0x0008, 0x0108, 0x0208, 0x0308, 0x0408,
+         0x0508, 0x0608, 0x0708, 0x0808, 0x0809, 0x0709, 0x0609, 0x0509, 0x0409, 0x0309, 0x0209, 0x0109, 0x0009, 0x0109, 0x0209, 0x0309,
+         0x0409, 0x0509, 0x0609, 0x0709, 0x0809, 0x080A, 0x070A, 0x060A, 0x050A, 0x040A, 0x030A, 0x020A, 0x010A, 0x000A, 0x010A, 0x020A,
+         0x030A, 0x040A, 0x050A, 0x060A, 0x070A, 0x080A, 0x080B, 0x070B, 0x060B, 0x050B, 0x040B, 0x030B, 0x020B, 0x010B, 0x000B, 0x010B,
+         0x020B, 0x030B, 0x040B, 0x050B, 0x060B, 0x070B, 0x080B, 0x080C, 0x070C, 0x060C, 0x050C, 0x040C, 0x030C, 0x020C, 0x010C, 0x000C,
+         0x010C, 0x020C, 0x030C, 0x040C, 0x050C, 0x060C, 0x070C, 0x080C, 0x080D, 0x070D, 0x060D, 0x050D, 0x040D, 0x030D, 0x020D, 0x010D,
+         0x000D, 0x010D, 0x020D, 0x030D, 0x040D, 0x050D, 0x060D, 0x070D, 0x080D, 0x080E, 0x070E, 0x060E, 0x050E, 0x040E, 0x030E, 0x020E,
+         0x010E, 0x000E, 0x010E, 0x020E, 0x030E, 0x040E, 0x050E, 0x060E, 0x070E, 0x080E, 0x080F, 0x070F, 0x060F, 0x050F, 0x040F, 0x030F,
+         0x020F, 0x010F, 0x000F, 0x010F, 0x020F, 0x030F, 0x040F, 0x050F, 0x060F, 0x070F, 0x080F, 0x090F, 0x0A0F, 0x0B0F, 0x0C0F, 0x0D0F,
+         0x0E0F, 0x0F0F, 0x100F, 0x110F, 0x120F, 0x130F, 0x140F, 0x150F, 0x160F, 0x170F, 0x180F, 0x190F, 0x1A0F, 0x1B0F, 0x1C0F, 0x1D0F,
+      },
+      // diff 1, inten_table 2, selector 0
+      {
+         0x0000, 0x0100, 0x0200, 0x0104, 0x0004, 0x0104, 0x0204, 0x0304, 0x0404, 0x0305, 0x0205, 0x0105, 0x0005, 0x0105, 0x0205, 0x0305,
+         0x0405, 0x0306, 0x0206, 0x0106, 0x0006, 0x0106, 0x0206, 0x0306, 0x0406, 0x0307, 0x0207, 0x0107, 0x0007, 0x0107, 0x0207, 0x0307,
+         0x0407, 0x0408, 0x0308, 0x0208, 0x0108, 0x0008, 0x0108, 0x0208, 0x0308, 0x0408, 0x0309, 0x0209, 0x0109, 0x0009, 0x0109, 0x0209,
+         0x0309, 0x0409, 0x030A, 0x020A, 0x010A, 0x000A, 0x010A, 0x020A, 0x030A, 0x040A, 0x030B, 0x020B, 0x010B, 0x000B, 0x010B, 0x020B,
+         0x030B, 0x040B, 0x040C, 0x030C, 0x020C, 0x010C, 0x000C, 0x010C, 0x020C, 0x030C, 0x040C, 0x030D, 0x020D, 0x010D, 0x000D, 0x010D,
+         0x020D, 0x030D, 0x040D, 0x030E, 0x020E, 0x010E, 0x000E, 0x010E, 0x020E, 0x030E, 0x040E, 0x030F, 0x020F, 0x010F, 0x000F, 0x010F,
+         0x020F, 0x030F, 0x040F, 0x0410, 0x0310, 0x0210, 0x0110, 0x0010, 0x0110, 0x0210, 0x0310, 0x0410, 0x0311, 0x0211, 0x0111, 0x0011,
+         0x0111, 0x0211, 0x0311, 0x0411, 0x0312, 0x0212, 0x0112, 0x0012, 0x0112, 0x0212, 0x0312, 0x0412, 0x0313, 0x0213, 0x0113, 0x0013,
+         0x0113, 0x0213, 0x0313, 0x0413, 0x0414, 0x0314, 0x0214, 0x0114, 0x0014, 0x0114, 0x0214, 0x0314, 0x0414, 0x0315, 0x0215, 0x0115,
+         0x0015, 0x0115, 0x0215, 0x0315, 0x0415, 0x0316, 0x0216, 0x0116, 0x0016, 0x0116, 0x0216, 0x0316, 0x0416, 0x0317, 0x0217, 0x0117,
+         0x0017, 0x0117, 0x0217, 0x0317, 0x0417, 0x0418, 0x0318, 0x0218, 0x0118, 0x0018, 0x0118, 0x0218, 0x0318, 0x0418, 0x0319, 0x0219,
+         0x0119, 0x0019, 0x0119, 0x0219, 0x0319, 0x0419, 0x031A, 0x021A, 0x011A, 0x001A, 0x011A, 0x021A, 0x031A, 0x041A, 0x031B, 0x021B,
+         0x011B, 0x001B, 0x011B, 0x021B, 0x031B, 0x041B, 0x041C, 0x031C, 0x021C, 0x011C, 0x001C, 0x011C, 0x021C, 0x031C, 0x041C, 0x031D,
+         0x021D, 0x011D, 0x001D, 0x011D, 0x021D, 0x031D, 0x041D, 0x031E, 0x021E, 0x011E, 0x001E, 0x011E, 0x021E, 0x031E, 0x041E, 0x031F,
+         0x021F, 0x011F, 0x001F, 0x011F, 0x021F, 0x031F, 0x041F, 0x051F, 0x061F, 0x071F, 0x081F, 0x091F, 0x0A1F, 0x0B1F, 0x0C1F, 0x0D1F,
+         0x0E1F, 0x0F1F, 0x101F, 0x111F, 0x121F, 0x131F, 0x141F, 0x151F, 0x161F, 0x171F, 0x181F, 0x191F, 0x1A1F, 0x1B1F, 0x1C1F, 0x1D1F,
+      },
+      // diff 0, inten_table 3, selector 0
+      {
+         0x0000, 0x0100, 0x0200, 0x0300, 0x0400, 0x0403, 0x0303, 0x0203, 0x0103, 0x0003, 0x0103, 0x0203, 0x0303, 0x0403, 0x0503, 0x0603,
+         0x0703, 0x0803, 0x0804, 0x0704, 0x0604, 0x0504, 0x0404, 0x0304, 0x0204, 0x0104, 0x0004, 0x0104, 0x0204, 0x0304, 0x0404, 0x0504,
+         0x0604, 0x0704, 0x0804, 0x0805, 0x0705, 0x0605, 0x0505, 0x0405, 0x0305, 0x0205, 0x0105, 0x0005, 0x0105, 0x0205, 0x0305, 0x0405,
+         0x0505, 0x0605, 0x0705, 0x0805, 0x0806, 0x0706, 0x0606, 0x0506, 0x0406, 0x0306, 0x0206, 0x0106, 0x0006, 0x0106, 0x0206, 0x0306,
+         0x0406, 0x0506, 0x0606, 0x0706, 0x0806, 0x0807, 0x0707, 0x0607, 0x0507, 0x0407, 0x0307, 0x0207, 0x0107, 0x0007, 0x0107, 0x0207,
+         0x0307, 0x0407, 0x0507, 0x0607, 0x0707, 0x0807, 0x0808, 0x0708, 0x0608, 0x0508, 0x0408, 0x0308, 0x0208, 0x0108, 0x0008, 0x0108,
+         0x0208, 0x0308, 0x0408, 0x0508, 0x0608, 0x0708, 0x0808, 0x0809, 0x0709, 0x0609, 0x0509, 0x0409, 0x0309, 0x0209, 0x0109, 0x0009,
+         0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709, 0x0809, 0x080A, 0x070A, 0x060A, 0x050A, 0x040A, 0x030A, 0x020A, 0x010A,
+         0x000A, 0x010A, 0x020A, 0x030A, 0x040A, 0x050A, 0x060A, 0x070A, 0x080A, 0x080B, 0x070B, 0x060B, 0x050B, 0x040B, 0x030B, 0x020B,
+         0x010B, 0x000B, 0x010B, 0x020B, 0x030B, 0x040B, 0x050B, 0x060B, 0x070B, 0x080B, 0x080C, 0x070C, 0x060C, 0x050C, 0x040C, 0x030C,
+         0x020C, 0x010C, 0x000C, 0x010C, 0x020C, 0x030C, 0x040C, 0x050C, 0x060C, 0x070C, 0x080C, 0x080D, 0x070D, 0x060D, 0x050D, 0x040D,
+         0x030D, 0x020D, 0x010D, 0x000D, 0x010D, 0x020D, 0x030D, 0x040D, 0x050D, 0x060D, 0x070D, 0x080D, 0x080E, 0x070E, 0x060E, 0x050E,
+         0x040E, 0x030E, 0x020E, 0x010E, 0x000E, 0x010E, 0x020E, 0x030E, 0x040E, 0x050E, 0x060E, 0x070E, 0x080E, 0x080F, 0x070F, 0x060F,
+         0x050F, 0x040F, 0x030F, 0x020F, 0x010F, 0x000F, 0x010F, 0x020F, 0x030F, 0x040F, 0x050F, 0x060F, 0x070F, 0x080F, 0x090F, 0x0A0F,
+         0x0B0F, 0x0C0F, 0x0D0F, 0x0E0F, 0x0F0F, 0x100F, 0x110F, 0x120F, 0x130F, 0x140F, 0x150F, 0x160F, 0x170F, 0x180F, 0x190F, 0x1A0F,
+         0x1B0F, 0x1C0F, 0x1D0F, 0x1E0F, 0x1F0F, 0x200F, 0x210F, 0x220F, 0x230F, 0x240F, 0x250F, 0x260F, 0x270F, 0x280F, 0x290F, 0x2A0F,
+      },
+      // diff 1, inten_table 3, selector 0
+      {
+         0x0000, 0x0100, 0x0200, 0x0300, 0x0306, 0x0206, 0x0106, 0x0006, 0x0106, 0x0206, 0x0306, 0x0406, 0x0307, 0x0207, 0x0107, 0x0007,
+         0x0107, 0x0207, 0x0307, 0x0407, 0x0408, 0x0308, 0x0208, 0x0108, 0x0008, 0x0108, 0x0208, 0x0308, 0x0408, 0x0309, 0x0209, 0x0109,
+         0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x030A, 0x020A, 0x010A, 0x000A, 0x010A, 0x020A, 0x030A, 0x040A, 0x030B, 0x020B, 0x010B,
+         0x000B, 0x010B, 0x020B, 0x030B, 0x040B, 0x040C, 0x030C, 0x020C, 0x010C, 0x000C, 0x010C, 0x020C, 0x030C, 0x040C, 0x030D, 0x020D,
+         0x010D, 0x000D, 0x010D, 0x020D, 0x030D, 0x040D, 0x030E, 0x020E, 0x010E, 0x000E, 0x010E, 0x020E, 0x030E, 0x040E, 0x030F, 0x020F,
+         0x010F, 0x000F, 0x010F, 0x020F, 0x030F, 0x040F, 0x0410, 0x0310, 0x0210, 0x0110, 0x0010, 0x0110, 0x0210, 0x0310, 0x0410, 0x0311,
+         0x0211, 0x0111, 0x0011, 0x0111, 0x0211, 0x0311, 0x0411, 0x0312, 0x0212, 0x0112, 0x0012, 0x0112, 0x0212, 0x0312, 0x0412, 0x0313,
+         0x0213, 0x0113, 0x0013, 0x0113, 0x0213, 0x0313, 0x0413, 0x0414, 0x0314, 0x0214, 0x0114, 0x0014, 0x0114, 0x0214, 0x0314, 0x0414,
+         0x0315, 0x0215, 0x0115, 0x0015, 0x0115, 0x0215, 0x0315, 0x0415, 0x0316, 0x0216, 0x0116, 0x0016, 0x0116, 0x0216, 0x0316, 0x0416,
+         0x0317, 0x0217, 0x0117, 0x0017, 0x0117, 0x0217, 0x0317, 0x0417, 0x0418, 0x0318, 0x0218, 0x0118, 0x0018, 0x0118, 0x0218, 0x0318,
+         0x0418, 0x0319, 0x0219, 0x0119, 0x0019, 0x0119, 0x0219, 0x0319, 0x0419, 0x031A, 0x021A, 0x011A, 0x001A, 0x011A, 0x021A, 0x031A,
+         0x041A, 0x031B, 0x021B, 0x011B, 0x001B, 0x011B, 0x021B, 0x031B, 0x041B, 0x041C, 0x031C, 0x021C, 0x011C, 0x001C, 0x011C, 0x021C,
+         0x031C, 0x041C, 0x031D, 0x021D, 0x011D, 0x001D, 0x011D, 0x021D, 0x031D, 0x041D, 0x031E, 0x021E, 0x011E, 0x001E, 0x011E, 0x021E,
+         0x031E, 0x041E, 0x031F, 0x021F, 0x011F, 0x001F, 0x011F, 0x021F, 0x031F, 0x041F, 0x051F, 0x061F, 0x071F, 0x081F, 0x091F, 0x0A1F,
+         0x0B1F, 0x0C1F, 0x0D1F, 0x0E1F, 0x0F1F, 0x101F, 0x111F, 0x121F, 0x131F, 0x141F, 0x151F, 0x161F, 0x171F, 0x181F, 0x191F, 0x1A1F,
+         0x1B1F, 0x1C1F, 0x1D1F, 0x1E1F, 0x1F1F, 0x201F, 0x211F, 0x221F, 0x231F, 0x241F, 0x251F, 0x261F, 0x271F, 0x281F, 0x291F, 0x2A1F,
+      },
+      // diff 0, inten_table 4, selector 0
+      {
+         0x0000, 0x0100, 0x0200, 0x0300, 0x0400, 0x0304, 0x0204, 0x0104, 0x0004, 0x0104, 0x0204, 0x0304, 0x0404, 0x0504, 0x0604, 0x0704,
+         0x0804, 0x0805, 0x0705, 0x0605, 0x0505, 0x0405, 0x0305, 0x0205, 0x0105, 0x0005, 0x0105, 0x0205, 0x0305, 0x0405, 0x0505, 0x0605,
+         0x0705, 0x0805, 0x0806, 0x0706, 0x0606, 0x0506, 0x0406, 0x0306, 0x0206, 0x0106, 0x0006, 0x0106, 0x0206, 0x0306, 0x0406, 0x0506,
+         0x0606, 0x0706, 0x0806, 0x0807, 0x0707, 0x0607, 0x0507, 0x0407, 0x0307, 0x0207, 0x0107, 0x0007, 0x0107, 0x0207, 0x0307, 0x0407,
+         0x0507, 0x0607, 0x0707, 0x0807, 0x0808, 0x0708, 0x0608, 0x0508, 0x0408, 0x0308, 0x0208, 0x0108, 0x0008, 0x0108, 0x0208, 0x0308,
+         0x0408, 0x0508, 0x0608, 0x0708, 0x0808, 0x0809, 0x0709, 0x0609, 0x0509, 0x0409, 0x0309, 0x0209, 0x0109, 0x0009, 0x0109, 0x0209,
+         0x0309, 0x0409, 0x0509, 0x0609, 0x0709, 0x0809, 0x080A, 0x070A, 0x060A, 0x050A, 0x040A, 0x030A, 0x020A, 0x010A, 0x000A, 0x010A,
+         0x020A, 0x030A, 0x040A, 0x050A, 0x060A, 0x070A, 0x080A, 0x080B, 0x070B, 0x060B, 0x050B, 0x040B, 0x030B, 0x020B, 0x010B, 0x000B,
+         0x010B, 0x020B, 0x030B, 0x040B, 0x050B, 0x060B, 0x070B, 0x080B, 0x080C, 0x070C, 0x060C, 0x050C, 0x040C, 0x030C, 0x020C, 0x010C,
+         0x000C, 0x010C, 0x020C, 0x030C, 0x040C, 0x050C, 0x060C, 0x070C, 0x080C, 0x080D, 0x070D, 0x060D, 0x050D, 0x040D, 0x030D, 0x020D,
+         0x010D, 0x000D, 0x010D, 0x020D, 0x030D, 0x040D, 0x050D, 0x060D, 0x070D, 0x080D, 0x080E, 0x070E, 0x060E, 0x050E, 0x040E, 0x030E,
+         0x020E, 0x010E, 0x000E, 0x010E, 0x020E, 0x030E, 0x040E, 0x050E, 0x060E, 0x070E, 0x080E, 0x080F, 0x070F, 0x060F, 0x050F, 0x040F,
+         0x030F, 0x020F, 0x010F, 0x000F, 0x010F, 0x020F, 0x030F, 0x040F, 0x050F, 0x060F, 0x070F, 0x080F, 0x090F, 0x0A0F, 0x0B0F, 0x0C0F,
+         0x0D0F, 0x0E0F, 0x0F0F, 0x100F, 0x110F, 0x120F, 0x130F, 0x140F, 0x150F, 0x160F, 0x170F, 0x180F, 0x190F, 0x1A0F, 0x1B0F, 0x1C0F,
+         0x1D0F, 0x1E0F, 0x1F0F, 0x200F, 0x210F, 0x220F, 0x230F, 0x240F, 0x250F, 0x260F, 0x270F, 0x280F, 0x290F, 0x2A0F, 0x2B0F, 0x2C0F,
+         0x2D0F, 0x2E0F, 0x2F0F, 0x300F, 0x310F, 0x320F, 0x330F, 0x340F, 0x350F, 0x360F, 0x370F, 0x380F, 0x390F, 0x3A0F, 0x3B0F, 0x3C0F,
+      },
+      // diff 1, inten_table 4, selector 0
+      {
+         0x0000, 0x0100, 0x0200, 0x0300, 0x0208, 0x0108, 0x0008, 0x0108, 0x0208, 0x0308, 0x0408, 0x0309, 0x0209, 0x0109, 0x0009, 0x0109,
+         0x0209, 0x0309, 0x0409, 0x030A, 0x020A, 0x010A, 0x000A, 0x010A, 0x020A, 0x030A, 0x040A, 0x030B, 0x020B, 0x010B, 0x000B, 0x010B,
+         0x020B, 0x030B, 0x040B, 0x040C, 0x030C, 0x020C, 0x010C, 0x000C, 0x010C, 0x020C, 0x030C, 0x040C, 0x030D, 0x020D, 0x010D, 0x000D,
+         0x010D, 0x020D, 0x030D, 0x040D, 0x030E, 0x020E, 0x010E, 0x000E, 0x010E, 0x020E, 0x030E, 0x040E, 0x030F, 0x020F, 0x010F, 0x000F,
+         0x010F, 0x020F, 0x030F, 0x040F, 0x0410, 0x0310, 0x0210, 0x0110, 0x0010, 0x0110, 0x0210, 0x0310, 0x0410, 0x0311, 0x0211, 0x0111,
+         0x0011, 0x0111, 0x0211, 0x0311, 0x0411, 0x0312, 0x0212, 0x0112, 0x0012, 0x0112, 0x0212, 0x0312, 0x0412, 0x0313, 0x0213, 0x0113,
+         0x0013, 0x0113, 0x0213, 0x0313, 0x0413, 0x0414, 0x0314, 0x0214, 0x0114, 0x0014, 0x0114, 0x0214, 0x0314, 0x0414, 0x0315, 0x0215,
+         0x0115, 0x0015, 0x0115, 0x0215, 0x0315, 0x0415, 0x0316, 0x0216, 0x0116, 0x0016, 0x0116, 0x0216, 0x0316, 0x0416, 0x0317, 0x0217,
+         0x0117, 0x0017, 0x0117, 0x0217, 0x0317, 0x0417, 0x0418, 0x0318, 0x0218, 0x0118, 0x0018, 0x0118, 0x0218, 0x0318, 0x0418, 0x0319,
+         0x0219, 0x0119, 0x0019, 0x0119, 0x0219, 0x0319, 0x0419, 0x031A, 0x021A, 0x011A, 0x001A, 0x011A, 0x021A, 0x031A, 0x041A, 0x031B,
+         0x021B, 0x011B, 0x001B, 0x011B, 0x021B, 0x031B, 0x041B, 0x041C, 0x031C, 0x021C, 0x011C, 0x001C, 0x011C, 0x021C, 0x031C, 0x041C,
+         0x031D, 0x021D, 0x011D, 0x001D, 0x011D, 0x021D, 0x031D, 0x041D, 0x031E, 0x021E, 0x011E, 0x001E, 0x011E, 0x021E, 0x031E, 0x041E,
+         0x031F, 0x021F, 0x011F, 0x001F, 0x011F, 0x021F, 0x031F, 0x041F, 0x051F, 0x061F, 0x071F, 0x081F, 0x091F, 0x0A1F, 0x0B1F, 0x0C1F,
+         0x0D1F, 0x0E1F, 0x0F1F, 0x101F, 0x111F, 0x121F, 0x131F, 0x141F, 0x151F, 0x161F, 0x171F, 0x181F, 0x191F, 0x1A1F, 0x1B1F, 0x1C1F,
+         0x1D1F, 0x1E1F, 0x1F1F, 0x201F, 0x211F, 0x221F, 0x231F, 0x241F, 0x251F, 0x261F, 0x271F, 0x281F, 0x291F, 0x2A1F, 0x2B1F, 0x2C1F,
+         0x2D1F, 0x2E1F, 0x2F1F, 0x301F, 0x311F, 0x321F, 0x331F, 0x341F, 0x351F, 0x361F, 0x371F, 0x381F, 0x391F, 0x3A1F, 0x3B1F, 0x3C1F,
+      },
+      // diff 0, inten_table 5, selector 0
+      {
+         0x0000, 0x0100, 0x0200, 0x0205, 0x0105, 0x0005, 0x0105, 0x0205, 0x0305, 0x0405, 0x0505, 0x0605, 0x0705, 0x0805, 0x0806, 0x0706,
+         0x0606, 0x0506, 0x0406, 0x0306, 0x0206, 0x0106, 0x0006, 0x0106, 0x0206, 0x0306, 0x0406, 0x0506, 0x0606, 0x0706, 0x0806, 0x0807,
+         0x0707, 0x0607, 0x0507, 0x0407, 0x0307, 0x0207, 0x0107, 0x0007, 0x0107, 0x0207, 0x0307, 0x0407, 0x0507, 0x0607, 0x0707, 0x0807,
+         0x0808, 0x0708, 0x0608, 0x0508, 0x0408, 0x0308, 0x0208, 0x0108, 0x0008, 0x0108, 0x0208, 0x0308, 0x0408, 0x0508, 0x0608, 0x0708,
+         0x0808, 0x0809, 0x0709, 0x0609, 0x0509, 0x0409, 0x0309, 0x0209, 0x0109, 0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609,
+         0x0709, 0x0809, 0x080A, 0x070A, 0x060A, 0x050A, 0x040A, 0x030A, 0x020A, 0x010A, 0x000A, 0x010A, 0x020A, 0x030A, 0x040A, 0x050A,
+         0x060A, 0x070A, 0x080A, 0x080B, 0x070B, 0x060B, 0x050B, 0x040B, 0x030B, 0x020B, 0x010B, 0x000B, 0x010B, 0x020B, 0x030B, 0x040B,
+         0x050B, 0x060B, 0x070B, 0x080B, 0x080C, 0x070C, 0x060C, 0x050C, 0x040C, 0x030C, 0x020C, 0x010C, 0x000C, 0x010C, 0x020C, 0x030C,
+         0x040C, 0x050C, 0x060C, 0x070C, 0x080C, 0x080D, 0x070D, 0x060D, 0x050D, 0x040D, 0x030D, 0x020D, 0x010D, 0x000D, 0x010D, 0x020D,
+         0x030D, 0x040D, 0x050D, 0x060D, 0x070D, 0x080D, 0x080E, 0x070E, 0x060E, 0x050E, 0x040E, 0x030E, 0x020E, 0x010E, 0x000E, 0x010E,
+         0x020E, 0x030E, 0x040E, 0x050E, 0x060E, 0x070E, 0x080E, 0x080F, 0x070F, 0x060F, 0x050F, 0x040F, 0x030F, 0x020F, 0x010F, 0x000F,
+         0x010F, 0x020F, 0x030F, 0x040F, 0x050F, 0x060F, 0x070F, 0x080F, 0x090F, 0x0A0F, 0x0B0F, 0x0C0F, 0x0D0F, 0x0E0F, 0x0F0F, 0x100F,
+         0x110F, 0x120F, 0x130F, 0x140F, 0x150F, 0x160F, 0x170F, 0x180F, 0x190F, 0x1A0F, 0x1B0F, 0x1C0F, 0x1D0F, 0x1E0F, 0x1F0F, 0x200F,
+         0x210F, 0x220F, 0x230F, 0x240F, 0x250F, 0x260F, 0x270F, 0x280F, 0x290F, 0x2A0F, 0x2B0F, 0x2C0F, 0x2D0F, 0x2E0F, 0x2F0F, 0x300F,
+         0x310F, 0x320F, 0x330F, 0x340F, 0x350F, 0x360F, 0x370F, 0x380F, 0x390F, 0x3A0F, 0x3B0F, 0x3C0F, 0x3D0F, 0x3E0F, 0x3F0F, 0x400F,
+         0x410F, 0x420F, 0x430F, 0x440F, 0x450F, 0x460F, 0x470F, 0x480F, 0x490F, 0x4A0F, 0x4B0F, 0x4C0F, 0x4D0F, 0x4E0F, 0x4F0F, 0x500F,
+      },
+      // diff 1, inten_table 5, selector 0
+      {
+         0x0000, 0x0100, 0x000A, 0x010A, 0x020A, 0x030A, 0x040A, 0x030B, 0x020B, 0x010B, 0x000B, 0x010B, 0x020B, 0x030B, 0x040B, 0x040C,
+         0x030C, 0x020C, 0x010C, 0x000C, 0x010C, 0x020C, 0x030C, 0x040C, 0x030D, 0x020D, 0x010D, 0x000D, 0x010D, 0x020D, 0x030D, 0x040D,
+         0x030E, 0x020E, 0x010E, 0x000E, 0x010E, 0x020E, 0x030E, 0x040E, 0x030F, 0x020F, 0x010F, 0x000F, 0x010F, 0x020F, 0x030F, 0x040F,
+         0x0410, 0x0310, 0x0210, 0x0110, 0x0010, 0x0110, 0x0210, 0x0310, 0x0410, 0x0311, 0x0211, 0x0111, 0x0011, 0x0111, 0x0211, 0x0311,
+         0x0411, 0x0312, 0x0212, 0x0112, 0x0012, 0x0112, 0x0212, 0x0312, 0x0412, 0x0313, 0x0213, 0x0113, 0x0013, 0x0113, 0x0213, 0x0313,
+         0x0413, 0x0414, 0x0314, 0x0214, 0x0114, 0x0014, 0x0114, 0x0214, 0x0314, 0x0414, 0x0315, 0x0215, 0x0115, 0x0015, 0x0115, 0x0215,
+         0x0315, 0x0415, 0x0316, 0x0216, 0x0116, 0x0016, 0x0116, 0x0216, 0x0316, 0x0416, 0x0317, 0x0217, 0x0117, 0x0017, 0x0117, 0x0217,
+         0x0317, 0x0417, 0x0418, 0x0318, 0x0218, 0x0118, 0x0018, 0x0118, 0x0218, 0x0318, 0x0418, 0x0319, 0x0219, 0x0119, 0x0019, 0x0119,
+         0x0219, 0x0319, 0x0419, 0x031A, 0x021A, 0x011A, 0x001A, 0x011A, 0x021A, 0x031A, 0x041A, 0x031B, 0x021B, 0x011B, 0x001B, 0x011B,
+         0x021B, 0x031B, 0x041B, 0x041C, 0x031C, 0x021C, 0x011C, 0x001C, 0x011C, 0x021C, 0x031C, 0x041C, 0x031D, 0x021D, 0x011D, 0x001D,
+         0x011D, 0x021D, 0x031D, 0x041D, 0x031E, 0x021E, 0x011E, 0x001E, 0x011E, 0x021E, 0x031E, 0x041E, 0x031F, 0x021F, 0x011F, 0x001F,
+         0x011F, 0x021F, 0x031F, 0x041F, 0x051F, 0x061F, 0x071F, 0x081F, 0x091F, 0x0A1F, 0x0B1F, 0x0C1F, 0x0D1F, 0x0E1F, 0x0F1F, 0x101F,
+         0x111F, 0x121F, 0x131F, 0x141F, 0x151F, 0x161F, 0x171F, 0x181F, 0x191F, 0x1A1F, 0x1B1F, 0x1C1F, 0x1D1F, 0x1E1F, 0x1F1F, 0x201F,
+         0x211F, 0x221F, 0x231F, 0x241F, 0x251F, 0x261F, 0x271F, 0x281F, 0x291F, 0x2A1F, 0x2B1F, 0x2C1F, 0x2D1F, 0x2E1F, 0x2F1F, 0x301F,
+         0x311F, 0x321F, 0x331F, 0x341F, 0x351F, 0x361F, 0x371F, 0x381F, 0x391F, 0x3A1F, 0x3B1F, 0x3C1F, 0x3D1F, 0x3E1F, 0x3F1F, 0x401F,
+         0x411F, 0x421F, 0x431F, 0x441F, 0x451F, 0x461F, 0x471F, 0x481F, 0x491F, 0x4A1F, 0x4B1F, 0x4C1F, 0x4D1F, 0x4E1F, 0x4F1F, 0x501F,
+      },
+      // diff 0, inten_table 6, selector 0
+      {
+         0x0000, 0x0100, 0x0200, 0x0300, 0x0400, 0x0500, 0x0600, 0x0607, 0x0507, 0x0407, 0x0307, 0x0207, 0x0107, 0x0007, 0x0107, 0x0207,
+         0x0307, 0x0407, 0x0507, 0x0607, 0x0707, 0x0807, 0x0808, 0x0708, 0x0608, 0x0508, 0x0408, 0x0308, 0x0208, 0x0108, 0x0008, 0x0108,
+         0x0208, 0x0308, 0x0408, 0x0508, 0x0608, 0x0708, 0x0808, 0x0809, 0x0709, 0x0609, 0x0509, 0x0409, 0x0309, 0x0209, 0x0109, 0x0009,
+         0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709, 0x0809, 0x080A, 0x070A, 0x060A, 0x050A, 0x040A, 0x030A, 0x020A, 0x010A,
+         0x000A, 0x010A, 0x020A, 0x030A, 0x040A, 0x050A, 0x060A, 0x070A, 0x080A, 0x080B, 0x070B, 0x060B, 0x050B, 0x040B, 0x030B, 0x020B,
+         0x010B, 0x000B, 0x010B, 0x020B, 0x030B, 0x040B, 0x050B, 0x060B, 0x070B, 0x080B, 0x080C, 0x070C, 0x060C, 0x050C, 0x040C, 0x030C,
+         0x020C, 0x010C, 0x000C, 0x010C, 0x020C, 0x030C, 0x040C, 0x050C, 0x060C, 0x070C, 0x080C, 0x080D, 0x070D, 0x060D, 0x050D, 0x040D,
+         0x030D, 0x020D, 0x010D, 0x000D, 0x010D, 0x020D, 0x030D, 0x040D, 0x050D, 0x060D, 0x070D, 0x080D, 0x080E, 0x070E, 0x060E, 0x050E,
+         0x040E, 0x030E, 0x020E, 0x010E, 0x000E, 0x010E, 0x020E, 0x030E, 0x040E, 0x050E, 0x060E, 0x070E, 0x080E, 0x080F, 0x070F, 0x060F,
+         0x050F, 0x040F, 0x030F, 0x020F, 0x010F, 0x000F, 0x010F, 0x020F, 0x030F, 0x040F, 0x050F, 0x060F, 0x070F, 0x080F, 0x090F, 0x0A0F,
+         0x0B0F, 0x0C0F, 0x0D0F, 0x0E0F, 0x0F0F, 0x100F, 0x110F, 0x120F, 0x130F, 0x140F, 0x150F, 0x160F, 0x170F, 0x180F, 0x190F, 0x1A0F,
+         0x1B0F, 0x1C0F, 0x1D0F, 0x1E0F, 0x1F0F, 0x200F, 0x210F, 0x220F, 0x230F, 0x240F, 0x250F, 0x260F, 0x270F, 0x280F, 0x290F, 0x2A0F,
+         0x2B0F, 0x2C0F, 0x2D0F, 0x2E0F, 0x2F0F, 0x300F, 0x310F, 0x320F, 0x330F, 0x340F, 0x350F, 0x360F, 0x370F, 0x380F, 0x390F, 0x3A0F,
+         0x3B0F, 0x3C0F, 0x3D0F, 0x3E0F, 0x3F0F, 0x400F, 0x410F, 0x420F, 0x430F, 0x440F, 0x450F, 0x460F, 0x470F, 0x480F, 0x490F, 0x4A0F,
+         0x4B0F, 0x4C0F, 0x4D0F, 0x4E0F, 0x4F0F, 0x500F, 0x510F, 0x520F, 0x530F, 0x540F, 0x550F, 0x560F, 0x570F, 0x580F, 0x590F, 0x5A0F,
+         0x5B0F, 0x5C0F, 0x5D0F, 0x5E0F, 0x5F0F, 0x600F, 0x610F, 0x620F, 0x630F, 0x640F, 0x650F, 0x660F, 0x670F, 0x680F, 0x690F, 0x6A0F,
+      },
+      // diff 1, inten_table 6, selector 0
+      {
+         0x0000, 0x000D, 0x010D, 0x020D, 0x030D, 0x040D, 0x030E, 0x020E, 0x010E, 0x000E, 0x010E, 0x020E, 0x030E, 0x040E, 0x030F, 0x020F,
+         0x010F, 0x000F, 0x010F, 0x020F, 0x030F, 0x040F, 0x0410, 0x0310, 0x0210, 0x0110, 0x0010, 0x0110, 0x0210, 0x0310, 0x0410, 0x0311,
+         0x0211, 0x0111, 0x0011, 0x0111, 0x0211, 0x0311, 0x0411, 0x0312, 0x0212, 0x0112, 0x0012, 0x0112, 0x0212, 0x0312, 0x0412, 0x0313,
+         0x0213, 0x0113, 0x0013, 0x0113, 0x0213, 0x0313, 0x0413, 0x0414, 0x0314, 0x0214, 0x0114, 0x0014, 0x0114, 0x0214, 0x0314, 0x0414,
+         0x0315, 0x0215, 0x0115, 0x0015, 0x0115, 0x0215, 0x0315, 0x0415, 0x0316, 0x0216, 0x0116, 0x0016, 0x0116, 0x0216, 0x0316, 0x0416,
+         0x0317, 0x0217, 0x0117, 0x0017, 0x0117, 0x0217, 0x0317, 0x0417, 0x0418, 0x0318, 0x0218, 0x0118, 0x0018, 0x0118, 0x0218, 0x0318,
+         0x0418, 0x0319, 0x0219, 0x0119, 0x0019, 0x0119, 0x0219, 0x0319, 0x0419, 0x031A, 0x021A, 0x011A, 0x001A, 0x011A, 0x021A, 0x031A,
+         0x041A, 0x031B, 0x021B, 0x011B, 0x001B, 0x011B, 0x021B, 0x031B, 0x041B, 0x041C, 0x031C, 0x021C, 0x011C, 0x001C, 0x011C, 0x021C,
+         0x031C, 0x041C, 0x031D, 0x021D, 0x011D, 0x001D, 0x011D, 0x021D, 0x031D, 0x041D, 0x031E, 0x021E, 0x011E, 0x001E, 0x011E, 0x021E,
+         0x031E, 0x041E, 0x031F, 0x021F, 0x011F, 0x001F, 0x011F, 0x021F, 0x031F, 0x041F, 0x051F, 0x061F, 0x071F, 0x081F, 0x091F, 0x0A1F,
+         0x0B1F, 0x0C1F, 0x0D1F, 0x0E1F, 0x0F1F, 0x101F, 0x111F, 0x121F, 0x131F, 0x141F, 0x151F, 0x161F, 0x171F, 0x181F, 0x191F, 0x1A1F,
+         0x1B1F, 0x1C1F, 0x1D1F, 0x1E1F, 0x1F1F, 0x201F, 0x211F, 0x221F, 0x231F, 0x241F, 0x251F, 0x261F, 0x271F, 0x281F, 0x291F, 0x2A1F,
+         0x2B1F, 0x2C1F, 0x2D1F, 0x2E1F, 0x2F1F, 0x301F, 0x311F, 0x321F, 0x331F, 0x341F, 0x351F, 0x361F, 0x371F, 0x381F, 0x391F, 0x3A1F,
+         0x3B1F, 0x3C1F, 0x3D1F, 0x3E1F, 0x3F1F, 0x401F, 0x411F, 0x421F, 0x431F, 0x441F, 0x451F, 0x461F, 0x471F, 0x481F, 0x491F, 0x4A1F,
+         0x4B1F, 0x4C1F, 0x4D1F, 0x4E1F, 0x4F1F, 0x501F, 0x511F, 0x521F, 0x531F, 0x541F, 0x551F, 0x561F, 0x571F, 0x581F, 0x591F, 0x5A1F,
+         0x5B1F, 0x5C1F, 0x5D1F, 0x5E1F, 0x5F1F, 0x601F, 0x611F, 0x621F, 0x631F, 0x641F, 0x651F, 0x661F, 0x671F, 0x681F, 0x691F, 0x6A1F,
+      },
+      // diff 0, inten_table 7, selector 0
+      {
+         0x0000, 0x0100, 0x0200, 0x010B, 0x000B, 0x010B, 0x020B, 0x030B, 0x040B, 0x050B, 0x060B, 0x070B, 0x080B, 0x080C, 0x070C, 0x060C,
+         0x050C, 0x040C, 0x030C, 0x020C, 0x010C, 0x000C, 0x010C, 0x020C, 0x030C, 0x040C, 0x050C, 0x060C, 0x070C, 0x080C, 0x080D, 0x070D,
+         0x060D, 0x050D, 0x040D, 0x030D, 0x020D, 0x010D, 0x000D, 0x010D, 0x020D, 0x030D, 0x040D, 0x050D, 0x060D, 0x070D, 0x080D, 0x080E,
+         0x070E, 0x060E, 0x050E, 0x040E, 0x030E, 0x020E, 0x010E, 0x000E, 0x010E, 0x020E, 0x030E, 0x040E, 0x050E, 0x060E, 0x070E, 0x080E,
+         0x080F, 0x070F, 0x060F, 0x050F, 0x040F, 0x030F, 0x020F, 0x010F, 0x000F, 0x010F, 0x020F, 0x030F, 0x040F, 0x050F, 0x060F, 0x070F,
+         0x080F, 0x090F, 0x0A0F, 0x0B0F, 0x0C0F, 0x0D0F, 0x0E0F, 0x0F0F, 0x100F, 0x110F, 0x120F, 0x130F, 0x140F, 0x150F, 0x160F, 0x170F,
+         0x180F, 0x190F, 0x1A0F, 0x1B0F, 0x1C0F, 0x1D0F, 0x1E0F, 0x1F0F, 0x200F, 0x210F, 0x220F, 0x230F, 0x240F, 0x250F, 0x260F, 0x270F,
+         0x280F, 0x290F, 0x2A0F, 0x2B0F, 0x2C0F, 0x2D0F, 0x2E0F, 0x2F0F, 0x300F, 0x310F, 0x320F, 0x330F, 0x340F, 0x350F, 0x360F, 0x370F,
+         0x380F, 0x390F, 0x3A0F, 0x3B0F, 0x3C0F, 0x3D0F, 0x3E0F, 0x3F0F, 0x400F, 0x410F, 0x420F, 0x430F, 0x440F, 0x450F, 0x460F, 0x470F,
+         0x480F, 0x490F, 0x4A0F, 0x4B0F, 0x4C0F, 0x4D0F, 0x4E0F, 0x4F0F, 0x500F, 0x510F, 0x520F, 0x530F, 0x540F, 0x550F, 0x560F, 0x570F,
+         0x580F, 0x590F, 0x5A0F, 0x5B0F, 0x5C0F, 0x5D0F, 0x5E0F, 0x5F0F, 0x600F, 0x610F, 0x620F, 0x630F, 0x640F, 0x650F, 0x660F, 0x670F,
+         0x680F, 0x690F, 0x6A0F, 0x6B0F, 0x6C0F, 0x6D0F, 0x6E0F, 0x6F0F, 0x700F, 0x710F, 0x720F, 0x730F, 0x740F, 0x750F, 0x760F, 0x770F,
+         0x780F, 0x790F, 0x7A0F, 0x7B0F, 0x7C0F, 0x7D0F, 0x7E0F, 0x7F0F, 0x800F, 0x810F, 0x820F, 0x830F, 0x840F, 0x850F, 0x860F, 0x870F,
+         0x880F, 0x890F, 0x8A0F, 0x8B0F, 0x8C0F, 0x8D0F, 0x8E0F, 0x8F0F, 0x900F, 0x910F, 0x920F, 0x930F, 0x940F, 0x950F, 0x960F, 0x970F,
+         0x980F, 0x990F, 0x9A0F, 0x9B0F, 0x9C0F, 0x9D0F, 0x9E0F, 0x9F0F, 0xA00F, 0xA10F, 0xA20F, 0xA30F, 0xA40F, 0xA50F, 0xA60F, 0xA70F,
+         0xA80F, 0xA90F, 0xAA0F, 0xAB0F, 0xAC0F, 0xAD0F, 0xAE0F, 0xAF0F, 0xB00F, 0xB10F, 0xB20F, 0xB30F, 0xB40F, 0xB50F, 0xB60F, 0xB70F,
+      },
+      // diff 1, inten_table 7, selector 0
+      {
+         0x0000, 0x0100, 0x0200, 0x0300, 0x0217, 0x0117, 0x0017, 0x0117, 0x0217, 0x0317, 0x0417, 0x0418, 0x0318, 0x0218, 0x0118, 0x0018,
+         0x0118, 0x0218, 0x0318, 0x0418, 0x0319, 0x0219, 0x0119, 0x0019, 0x0119, 0x0219, 0x0319, 0x0419, 0x031A, 0x021A, 0x011A, 0x001A,
+         0x011A, 0x021A, 0x031A, 0x041A, 0x031B, 0x021B, 0x011B, 0x001B, 0x011B, 0x021B, 0x031B, 0x041B, 0x041C, 0x031C, 0x021C, 0x011C,
+         0x001C, 0x011C, 0x021C, 0x031C, 0x041C, 0x031D, 0x021D, 0x011D, 0x001D, 0x011D, 0x021D, 0x031D, 0x041D, 0x031E, 0x021E, 0x011E,
+         0x001E, 0x011E, 0x021E, 0x031E, 0x041E, 0x031F, 0x021F, 0x011F, 0x001F, 0x011F, 0x021F, 0x031F, 0x041F, 0x051F, 0x061F, 0x071F,
+         0x081F, 0x091F, 0x0A1F, 0x0B1F, 0x0C1F, 0x0D1F, 0x0E1F, 0x0F1F, 0x101F, 0x111F, 0x121F, 0x131F, 0x141F, 0x151F, 0x161F, 0x171F,
+         0x181F, 0x191F, 0x1A1F, 0x1B1F, 0x1C1F, 0x1D1F, 0x1E1F, 0x1F1F, 0x201F, 0x211F, 0x221F, 0x231F, 0x241F, 0x251F, 0x261F, 0x271F,
+         0x281F, 0x291F, 0x2A1F, 0x2B1F, 0x2C1F, 0x2D1F, 0x2E1F, 0x2F1F, 0x301F, 0x311F, 0x321F, 0x331F, 0x341F, 0x351F, 0x361F, 0x371F,
+         0x381F, 0x391F, 0x3A1F, 0x3B1F, 0x3C1F, 0x3D1F, 0x3E1F, 0x3F1F, 0x401F, 0x411F, 0x421F, 0x431F, 0x441F, 0x451F, 0x461F, 0x471F,
+         0x481F, 0x491F, 0x4A1F, 0x4B1F, 0x4C1F, 0x4D1F, 0x4E1F, 0x4F1F, 0x501F, 0x511F, 0x521F, 0x531F, 0x541F, 0x551F, 0x561F, 0x571F,
+         0x581F, 0x591F, 0x5A1F, 0x5B1F, 0x5C1F, 0x5D1F, 0x5E1F, 0x5F1F, 0x601F, 0x611F, 0x621F, 0x631F, 0x641F, 0x651F, 0x661F, 0x671F,
+         0x681F, 0x691F, 0x6A1F, 0x6B1F, 0x6C1F, 0x6D1F, 0x6E1F, 0x6F1F, 0x701F, 0x711F, 0x721F, 0x731F, 0x741F, 0x751F, 0x761F, 0x771F,
+         0x781F, 0x791F, 0x7A1F, 0x7B1F, 0x7C1F, 0x7D1F, 0x7E1F, 0x7F1F, 0x801F, 0x811F, 0x821F, 0x831F, 0x841F, 0x851F, 0x861F, 0x871F,
+         0x881F, 0x891F, 0x8A1F, 0x8B1F, 0x8C1F, 0x8D1F, 0x8E1F, 0x8F1F, 0x901F, 0x911F, 0x921F, 0x931F, 0x941F, 0x951F, 0x961F, 0x971F,
+         0x981F, 0x991F, 0x9A1F, 0x9B1F, 0x9C1F, 0x9D1F, 0x9E1F, 0x9F1F, 0xA01F, 0xA11F, 0xA21F, 0xA31F, 0xA41F, 0xA51F, 0xA61F, 0xA71F,
+         0xA81F, 0xA91F, 0xAA1F, 0xAB1F, 0xAC1F, 0xAD1F, 0xAE1F, 0xAF1F, 0xB01F, 0xB11F, 0xB21F, 0xB31F, 0xB41F, 0xB51F, 0xB61F, 0xB71F,
+      },
+      // diff 0, inten_table 0, selector 1
+      {
+         0x0000, 0x0100, 0x0200, 0x0300, 0x0400, 0x0500, 0x0600, 0x0700, 0x0701, 0x0601, 0x0501, 0x0401, 0x0301, 0x0201, 0x0101, 0x0001,
+         0x0101, 0x0201, 0x0301, 0x0401, 0x0501, 0x0601, 0x0701, 0x0801, 0x0802, 0x0702, 0x0602, 0x0502, 0x0402, 0x0302, 0x0202, 0x0102,
+         0x0002, 0x0102, 0x0202, 0x0302, 0x0402, 0x0502, 0x0602, 0x0702, 0x0802, 0x0803, 0x0703, 0x0603, 0x0503, 0x0403, 0x0303, 0x0203,
+         0x0103, 0x0003, 0x0103, 0x0203, 0x0303, 0x0403, 0x0503, 0x0603, 0x0703, 0x0803, 0x0804, 0x0704, 0x0604, 0x0504, 0x0404, 0x0304,
+         0x0204, 0x0104, 0x0004, 0x0104, 0x0204, 0x0304, 0x0404, 0x0504, 0x0604, 0x0704, 0x0804, 0x0805, 0x0705, 0x0605, 0x0505, 0x0405,
+         0x0305, 0x0205, 0x0105, 0x0005, 0x0105, 0x0205, 0x0305, 0x0405, 0x0505, 0x0605, 0x0705, 0x0805, 0x0806, 0x0706, 0x0606, 0x0506,
+         0x0406, 0x0306, 0x0206, 0x0106, 0x0006, 0x0106, 0x0206, 0x0306, 0x0406, 0x0506, 0x0606, 0x0706, 0x0806, 0x0807, 0x0707, 0x0607,
+         0x0507, 0x0407, 0x0307, 0x0207, 0x0107, 0x0007, 0x0107, 0x0207, 0x0307, 0x0407, 0x0507, 0x0607, 0x0707, 0x0807, 0x0808, 0x0708,
+         0x0608, 0x0508, 0x0408, 0x0308, 0x0208, 0x0108, 0x0008, 0x0108, 0x0208, 0x0308, 0x0408, 0x0508, 0x0608, 0x0708, 0x0808, 0x0809,
+         0x0709, 0x0609, 0x0509, 0x0409, 0x0309, 0x0209, 0x0109, 0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709, 0x0809,
+         0x080A, 0x070A, 0x060A, 0x050A, 0x040A, 0x030A, 0x020A, 0x010A, 0x000A, 0x010A, 0x020A, 0x030A, 0x040A, 0x050A, 0x060A, 0x070A,
+         0x080A, 0x080B, 0x070B, 0x060B, 0x050B, 0x040B, 0x030B, 0x020B, 0x010B, 0x000B, 0x010B, 0x020B, 0x030B, 0x040B, 0x050B, 0x060B,
+         0x070B, 0x080B, 0x080C, 0x070C, 0x060C, 0x050C, 0x040C, 0x030C, 0x020C, 0x010C, 0x000C, 0x010C, 0x020C, 0x030C, 0x040C, 0x050C,
+         0x060C, 0x070C, 0x080C, 0x080D, 0x070D, 0x060D, 0x050D, 0x040D, 0x030D, 0x020D, 0x010D, 0x000D, 0x010D, 0x020D, 0x030D, 0x040D,
+         0x050D, 0x060D, 0x070D, 0x080D, 0x080E, 0x070E, 0x060E, 0x050E, 0x040E, 0x030E, 0x020E, 0x010E, 0x000E, 0x010E, 0x020E, 0x030E,
+         0x040E, 0x050E, 0x060E, 0x070E, 0x080E, 0x080F, 0x070F, 0x060F, 0x050F, 0x040F, 0x030F, 0x020F, 0x010F, 0x000F, 0x010F, 0x020F,
+      },
+      // diff 1, inten_table 0, selector 1
+      {
+         0x0000, 0x0100, 0x0200, 0x0300, 0x0201, 0x0101, 0x0001, 0x0101, 0x0201, 0x0301, 0x0401, 0x0302, 0x0202, 0x0102, 0x0002, 0x0102,
+         0x0202, 0x0302, 0x0402, 0x0303, 0x0203, 0x0103, 0x0003, 0x0103, 0x0203, 0x0303, 0x0403, 0x0404, 0x0304, 0x0204, 0x0104, 0x0004,
+         0x0104, 0x0204, 0x0304, 0x0404, 0x0305, 0x0205, 0x0105, 0x0005, 0x0105, 0x0205, 0x0305, 0x0405, 0x0306, 0x0206, 0x0106, 0x0006,
+         0x0106, 0x0206, 0x0306, 0x0406, 0x0307, 0x0207, 0x0107, 0x0007, 0x0107, 0x0207, 0x0307, 0x0407, 0x0408, 0x0308, 0x0208, 0x0108,
+         0x0008, 0x0108, 0x0208, 0x0308, 0x0408, 0x0309, 0x0209, 0x0109, 0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x030A, 0x020A, 0x010A,
+         0x000A, 0x010A, 0x020A, 0x030A, 0x040A, 0x030B, 0x020B, 0x010B, 0x000B, 0x010B, 0x020B, 0x030B, 0x040B, 0x040C, 0x030C, 0x020C,
+         0x010C, 0x000C, 0x010C, 0x020C, 0x030C, 0x040C, 0x030D, 0x020D, 0x010D, 0x000D, 0x010D, 0x020D, 0x030D, 0x040D, 0x030E, 0x020E,
+         0x010E, 0x000E, 0x010E, 0x020E, 0x030E, 0x040E, 0x030F, 0x020F, 0x010F, 0x000F, 0x010F, 0x020F, 0x030F, 0x040F, 0x0410, 0x0310,
+         0x0210, 0x0110, 0x0010, 0x0110, 0x0210, 0x0310, 0x0410, 0x0311, 0x0211, 0x0111, 0x0011, 0x0111, 0x0211, 0x0311, 0x0411, 0x0312,
+         0x0212, 0x0112, 0x0012, 0x0112, 0x0212, 0x0312, 0x0412, 0x0313, 0x0213, 0x0113, 0x0013, 0x0113, 0x0213, 0x0313, 0x0413, 0x0414,
+         0x0314, 0x0214, 0x0114, 0x0014, 0x0114, 0x0214, 0x0314, 0x0414, 0x0315, 0x0215, 0x0115, 0x0015, 0x0115, 0x0215, 0x0315, 0x0415,
+         0x0316, 0x0216, 0x0116, 0x0016, 0x0116, 0x0216, 0x0316, 0x0416, 0x0317, 0x0217, 0x0117, 0x0017, 0x0117, 0x0217, 0x0317, 0x0417,
+         0x0418, 0x0318, 0x0218, 0x0118, 0x0018, 0x0118, 0x0218, 0x0318, 0x0418, 0x0319, 0x0219, 0x0119, 0x0019, 0x0119, 0x0219, 0x0319,
+         0x0419, 0x031A, 0x021A, 0x011A, 0x001A, 0x011A, 0x021A, 0x031A, 0x041A, 0x031B, 0x021B, 0x011B, 0x001B, 0x011B, 0x021B, 0x031B,
+         0x041B, 0x041C, 0x031C, 0x021C, 0x011C, 0x001C, 0x011C, 0x021C, 0x031C, 0x041C, 0x031D, 0x021D, 0x011D, 0x001D, 0x011D, 0x021D,
+         0x031D, 0x041D, 0x031E, 0x021E, 0x011E, 0x001E, 0x011E, 0x021E, 0x031E, 0x041E, 0x031F, 0x021F, 0x011F, 0x001F, 0x011F, 0x021F,
+      },
+      // diff 0, inten_table 1, selector 1
+      {
+         0x0000, 0x0100, 0x0200, 0x0300, 0x0400, 0x0500, 0x0600, 0x0501, 0x0401, 0x0301, 0x0201, 0x0101, 0x0001, 0x0101, 0x0201, 0x0301,
+         0x0401, 0x0501, 0x0601, 0x0701, 0x0801, 0x0802, 0x0702, 0x0602, 0x0502, 0x0402, 0x0302, 0x0202, 0x0102, 0x0002, 0x0102, 0x0202,
+         0x0302, 0x0402, 0x0502, 0x0602, 0x0702, 0x0802, 0x0803, 0x0703, 0x0603, 0x0503, 0x0403, 0x0303, 0x0203, 0x0103, 0x0003, 0x0103,
+         0x0203, 0x0303, 0x0403, 0x0503, 0x0603, 0x0703, 0x0803, 0x0804, 0x0704, 0x0604, 0x0504, 0x0404, 0x0304, 0x0204, 0x0104, 0x0004,
+         0x0104, 0x0204, 0x0304, 0x0404, 0x0504, 0x0604, 0x0704, 0x0804, 0x0805, 0x0705, 0x0605, 0x0505, 0x0405, 0x0305, 0x0205, 0x0105,
+         0x0005, 0x0105, 0x0205, 0x0305, 0x0405, 0x0505, 0x0605, 0x0705, 0x0805, 0x0806, 0x0706, 0x0606, 0x0506, 0x0406, 0x0306, 0x0206,
+         0x0106, 0x0006, 0x0106, 0x0206, 0x0306, 0x0406, 0x0506, 0x0606, 0x0706, 0x0806, 0x0807, 0x0707, 0x0607, 0x0507, 0x0407, 0x0307,
+         0x0207, 0x0107, 0x0007, 0x0107, 0x0207, 0x0307, 0x0407, 0x0507, 0x0607, 0x0707, 0x0807, 0x0808, 0x0708, 0x0608, 0x0508, 0x0408,
+         0x0308, 0x0208, 0x0108, 0x0008, 0x0108, 0x0208, 0x0308, 0x0408, 0x0508, 0x0608, 0x0708, 0x0808, 0x0809, 0x0709, 0x0609, 0x0509,
+         0x0409, 0x0309, 0x0209, 0x0109, 0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709, 0x0809, 0x080A, 0x070A, 0x060A,
+         0x050A, 0x040A, 0x030A, 0x020A, 0x010A, 0x000A, 0x010A, 0x020A, 0x030A, 0x040A, 0x050A, 0x060A, 0x070A, 0x080A, 0x080B, 0x070B,
+         0x060B, 0x050B, 0x040B, 0x030B, 0x020B, 0x010B, 0x000B, 0x010B, 0x020B, 0x030B, 0x040B, 0x050B, 0x060B, 0x070B, 0x080B, 0x080C,
+         0x070C, 0x060C, 0x050C, 0x040C, 0x030C, 0x020C, 0x010C, 0x000C, 0x010C, 0x020C, 0x030C, 0x040C, 0x050C, 0x060C, 0x070C, 0x080C,
+         0x080D, 0x070D, 0x060D, 0x050D, 0x040D, 0x030D, 0x020D, 0x010D, 0x000D, 0x010D, 0x020D, 0x030D, 0x040D, 0x050D, 0x060D, 0x070D,
+         0x080D, 0x080E, 0x070E, 0x060E, 0x050E, 0x040E, 0x030E, 0x020E, 0x010E, 0x000E, 0x010E, 0x020E, 0x030E, 0x040E, 0x050E, 0x060E,
+         0x070E, 0x080E, 0x080F, 0x070F, 0x060F, 0x050F, 0x040F, 0x030F, 0x020F, 0x010F, 0x000F, 0x010F, 0x020F, 0x030F, 0x040F, 0x050F,
+      },
+      // diff 1, inten_table 1, selector 1
+      {
+         0x0000, 0x0100, 0x0101, 0x0001, 0x0101, 0x0201, 0x0301, 0x0401, 0x0302, 0x0202, 0x0102, 0x0002, 0x0102, 0x0202, 0x0302, 0x0402,
+         0x0303, 0x0203, 0x0103, 0x0003, 0x0103, 0x0203, 0x0303, 0x0403, 0x0404, 0x0304, 0x0204, 0x0104, 0x0004, 0x0104, 0x0204, 0x0304,
+         0x0404, 0x0305, 0x0205, 0x0105, 0x0005, 0x0105, 0x0205, 0x0305, 0x0405, 0x0306, 0x0206, 0x0106, 0x0006, 0x0106, 0x0206, 0x0306,
+         0x0406, 0x0307, 0x0207, 0x0107, 0x0007, 0x0107, 0x0207, 0x0307, 0x0407, 0x0408, 0x0308, 0x0208, 0x0108, 0x0008, 0x0108, 0x0208,
+         0x0308, 0x0408, 0x0309, 0x0209, 0x0109, 0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x030A, 0x020A, 0x010A, 0x000A, 0x010A, 0x020A,
+         0x030A, 0x040A, 0x030B, 0x020B, 0x010B, 0x000B, 0x010B, 0x020B, 0x030B, 0x040B, 0x040C, 0x030C, 0x020C, 0x010C, 0x000C, 0x010C,
+         0x020C, 0x030C, 0x040C, 0x030D, 0x020D, 0x010D, 0x000D, 0x010D, 0x020D, 0x030D, 0x040D, 0x030E, 0x020E, 0x010E, 0x000E, 0x010E,
+         0x020E, 0x030E, 0x040E, 0x030F, 0x020F, 0x010F, 0x000F, 0x010F, 0x020F, 0x030F, 0x040F, 0x0410, 0x0310, 0x0210, 0x0110, 0x0010,
+         0x0110, 0x0210, 0x0310, 0x0410, 0x0311, 0x0211, 0x0111, 0x0011, 0x0111, 0x0211, 0x0311, 0x0411, 0x0312, 0x0212, 0x0112, 0x0012,
+         0x0112, 0x0212, 0x0312, 0x0412, 0x0313, 0x0213, 0x0113, 0x0013, 0x0113, 0x0213, 0x0313, 0x0413, 0x0414, 0x0314, 0x0214, 0x0114,
+         0x0014, 0x0114, 0x0214, 0x0314, 0x0414, 0x0315, 0x0215, 0x0115, 0x0015, 0x0115, 0x0215, 0x0315, 0x0415, 0x0316, 0x0216, 0x0116,
+         0x0016, 0x0116, 0x0216, 0x0316, 0x0416, 0x0317, 0x0217, 0x0117, 0x0017, 0x0117, 0x0217, 0x0317, 0x0417, 0x0418, 0x0318, 0x0218,
+         0x0118, 0x0018, 0x0118, 0x0218, 0x0318, 0x0418, 0x0319, 0x0219, 0x0119, 0x0019, 0x0119, 0x0219, 0x0319, 0x0419, 0x031A, 0x021A,
+         0x011A, 0x001A, 0x011A, 0x021A, 0x031A, 0x041A, 0x031B, 0x021B, 0x011B, 0x001B, 0x011B, 0x021B, 0x031B, 0x041B, 0x041C, 0x031C,
+         0x021C, 0x011C, 0x001C, 0x011C, 0x021C, 0x031C, 0x041C, 0x031D, 0x021D, 0x011D, 0x001D, 0x011D, 0x021D, 0x031D, 0x041D, 0x031E,
+         0x021E, 0x011E, 0x001E, 0x011E, 0x021E, 0x031E, 0x041E, 0x031F, 0x021F, 0x011F, 0x001F, 0x011F, 0x021F, 0x031F, 0x041F, 0x051F,
+      },
+      // diff 0, inten_table 2, selector 1
+      {
+         0x0000, 0x0100, 0x0200, 0x0300, 0x0400, 0x0301, 0x0201, 0x0101, 0x0001, 0x0101, 0x0201, 0x0301, 0x0401, 0x0501, 0x0601, 0x0701,
+         0x0801, 0x0802, 0x0702, 0x0602, 0x0502, 0x0402, 0x0302, 0x0202, 0x0102, 0x0002, 0x0102, 0x0202, 0x0302, 0x0402, 0x0502, 0x0602,
+         0x0702, 0x0802, 0x0803, 0x0703, 0x0603, 0x0503, 0x0403, 0x0303, 0x0203, 0x0103, 0x0003, 0x0103, 0x0203, 0x0303, 0x0403, 0x0503,
+         0x0603, 0x0703, 0x0803, 0x0804, 0x0704, 0x0604, 0x0504, 0x0404, 0x0304, 0x0204, 0x0104, 0x0004, 0x0104, 0x0204, 0x0304, 0x0404,
+         0x0504, 0x0604, 0x0704, 0x0804, 0x0805, 0x0705, 0x0605, 0x0505, 0x0405, 0x0305, 0x0205, 0x0105, 0x0005, 0x0105, 0x0205, 0x0305,
+         0x0405, 0x0505, 0x0605, 0x0705, 0x0805, 0x0806, 0x0706, 0x0606, 0x0506, 0x0406, 0x0306, 0x0206, 0x0106, 0x0006, 0x0106, 0x0206,
+         0x0306, 0x0406, 0x0506, 0x0606, 0x0706, 0x0806, 0x0807, 0x0707, 0x0607, 0x0507, 0x0407, 0x0307, 0x0207, 0x0107, 0x0007, 0x0107,
+         0x0207, 0x0307, 0x0407, 0x0507, 0x0607, 0x0707, 0x0807, 0x0808, 0x0708, 0x0608, 0x0508, 0x0408, 0x0308, 0x0208, 0x0108, 0x0008,
+         0x0108, 0x0208, 0x0308, 0x0408, 0x0508, 0x0608, 0x0708, 0x0808, 0x0809, 0x0709, 0x0609, 0x0509, 0x0409, 0x0309, 0x0209, 0x0109,
+         0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709, 0x0809, 0x080A, 0x070A, 0x060A, 0x050A, 0x040A, 0x030A, 0x020A,
+         0x010A, 0x000A, 0x010A, 0x020A, 0x030A, 0x040A, 0x050A, 0x060A, 0x070A, 0x080A, 0x080B, 0x070B, 0x060B, 0x050B, 0x040B, 0x030B,
+         0x020B, 0x010B, 0x000B, 0x010B, 0x020B, 0x030B, 0x040B, 0x050B, 0x060B, 0x070B, 0x080B, 0x080C, 0x070C, 0x060C, 0x050C, 0x040C,
+         0x030C, 0x020C, 0x010C, 0x000C, 0x010C, 0x020C, 0x030C, 0x040C, 0x050C, 0x060C, 0x070C, 0x080C, 0x080D, 0x070D, 0x060D, 0x050D,
+         0x040D, 0x030D, 0x020D, 0x010D, 0x000D, 0x010D, 0x020D, 0x030D, 0x040D, 0x050D, 0x060D, 0x070D, 0x080D, 0x080E, 0x070E, 0x060E,
+         0x050E, 0x040E, 0x030E, 0x020E, 0x010E, 0x000E, 0x010E, 0x020E, 0x030E, 0x040E, 0x050E, 0x060E, 0x070E, 0x080E, 0x080F, 0x070F,
+         0x060F, 0x050F, 0x040F, 0x030F, 0x020F, 0x010F, 0x000F, 0x010F, 0x020F, 0x030F, 0x040F, 0x050F, 0x060F, 0x070F, 0x080F, 0x090F,
+      },
+      // diff 1, inten_table 2, selector 1
+      {
+         0x0000, 0x0100, 0x0200, 0x0300, 0x0302, 0x0202, 0x0102, 0x0002, 0x0102, 0x0202, 0x0302, 0x0402, 0x0303, 0x0203, 0x0103, 0x0003,
+         0x0103, 0x0203, 0x0303, 0x0403, 0x0404, 0x0304, 0x0204, 0x0104, 0x0004, 0x0104, 0x0204, 0x0304, 0x0404, 0x0305, 0x0205, 0x0105,
+         0x0005, 0x0105, 0x0205, 0x0305, 0x0405, 0x0306, 0x0206, 0x0106, 0x0006, 0x0106, 0x0206, 0x0306, 0x0406, 0x0307, 0x0207, 0x0107,
+         0x0007, 0x0107, 0x0207, 0x0307, 0x0407, 0x0408, 0x0308, 0x0208, 0x0108, 0x0008, 0x0108, 0x0208, 0x0308, 0x0408, 0x0309, 0x0209,
+         0x0109, 0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x030A, 0x020A, 0x010A, 0x000A, 0x010A, 0x020A, 0x030A, 0x040A, 0x030B, 0x020B,
+         0x010B, 0x000B, 0x010B, 0x020B, 0x030B, 0x040B, 0x040C, 0x030C, 0x020C, 0x010C, 0x000C, 0x010C, 0x020C, 0x030C, 0x040C, 0x030D,
+         0x020D, 0x010D, 0x000D, 0x010D, 0x020D, 0x030D, 0x040D, 0x030E, 0x020E, 0x010E, 0x000E, 0x010E, 0x020E, 0x030E, 0x040E, 0x030F,
+         0x020F, 0x010F, 0x000F, 0x010F, 0x020F, 0x030F, 0x040F, 0x0410, 0x0310, 0x0210, 0x0110, 0x0010, 0x0110, 0x0210, 0x0310, 0x0410,
+         0x0311, 0x0211, 0x0111, 0x0011, 0x0111, 0x0211, 0x0311, 0x0411, 0x0312, 0x0212, 0x0112, 0x0012, 0x0112, 0x0212, 0x0312, 0x0412,
+         0x0313, 0x0213, 0x0113, 0x0013, 0x0113, 0x0213, 0x0313, 0x0413, 0x0414, 0x0314, 0x0214, 0x0114, 0x0014, 0x0114, 0x0214, 0x0314,
+         0x0414, 0x0315, 0x0215, 0x0115, 0x0015, 0x0115, 0x0215, 0x0315, 0x0415, 0x0316, 0x0216, 0x0116, 0x0016, 0x0116, 0x0216, 0x0316,
+         0x0416, 0x0317, 0x0217, 0x0117, 0x0017, 0x0117, 0x0217, 0x0317, 0x0417, 0x0418, 0x0318, 0x0218, 0x0118, 0x0018, 0x0118, 0x0218,
+         0x0318, 0x0418, 0x0319, 0x0219, 0x0119, 0x0019, 0x0119, 0x0219, 0x0319, 0x0419, 0x031A, 0x021A, 0x011A, 0x001A, 0x011A, 0x021A,
+         0x031A, 0x041A, 0x031B, 0x021B, 0x011B, 0x001B, 0x011B, 0x021B, 0x031B, 0x041B, 0x041C, 0x031C, 0x021C, 0x011C, 0x001C, 0x011C,
+         0x021C, 0x031C, 0x041C, 0x031D, 0x021D, 0x011D, 0x001D, 0x011D, 0x021D, 0x031D, 0x041D, 0x031E, 0x021E, 0x011E, 0x001E, 0x011E,
+         0x021E, 0x031E, 0x041E, 0x031F, 0x021F, 0x011F, 0x001F, 0x011F, 0x021F, 0x031F, 0x041F, 0x051F, 0x061F, 0x071F, 0x081F, 0x091F,
+      },
+      // diff 0, inten_table 3, selector 1
+      {
+         0x0000, 0x0100, 0x0200, 0x0101, 0x0001, 0x0101, 0x0201, 0x0301, 0x0401, 0x0501, 0x0601, 0x0701, 0x0801, 0x0802, 0x0702, 0x0602,
+         0x0502, 0x0402, 0x0302, 0x0202, 0x0102, 0x0002, 0x0102, 0x0202, 0x0302, 0x0402, 0x0502, 0x0602, 0x0702, 0x0802, 0x0803, 0x0703,
+         0x0603, 0x0503, 0x0403, 0x0303, 0x0203, 0x0103, 0x0003, 0x0103, 0x0203, 0x0303, 0x0403, 0x0503, 0x0603, 0x0703, 0x0803, 0x0804,
+         0x0704, 0x0604, 0x0504, 0x0404, 0x0304, 0x0204, 0x0104, 0x0004, 0x0104, 0x0204, 0x0304, 0x0404, 0x0504, 0x0604, 0x0704, 0x0804,
+         0x0805, 0x0705, 0x0605, 0x0505, 0x0405, 0x0305, 0x0205, 0x0105, 0x0005, 0x0105, 0x0205, 0x0305, 0x0405, 0x0505, 0x0605, 0x0705,
+         0x0805, 0x0806, 0x0706, 0x0606, 0x0506, 0x0406, 0x0306, 0x0206, 0x0106, 0x0006, 0x0106, 0x0206, 0x0306, 0x0406, 0x0506, 0x0606,
+         0x0706, 0x0806, 0x0807, 0x0707, 0x0607, 0x0507, 0x0407, 0x0307, 0x0207, 0x0107, 0x0007, 0x0107, 0x0207, 0x0307, 0x0407, 0x0507,
+         0x0607, 0x0707, 0x0807, 0x0808, 0x0708, 0x0608, 0x0508, 0x0408, 0x0308, 0x0208, 0x0108, 0x0008, 0x0108, 0x0208, 0x0308, 0x0408,
+         0x0508, 0x0608, 0x0708, 0x0808, 0x0809, 0x0709, 0x0609, 0x0509, 0x0409, 0x0309, 0x0209, 0x0109, 0x0009, 0x0109, 0x0209, 0x0309,
+         0x0409, 0x0509, 0x0609, 0x0709, 0x0809, 0x080A, 0x070A, 0x060A, 0x050A, 0x040A, 0x030A, 0x020A, 0x010A, 0x000A, 0x010A, 0x020A,
+         0x030A, 0x040A, 0x050A, 0x060A, 0x070A, 0x080A, 0x080B, 0x070B, 0x060B, 0x050B, 0x040B, 0x030B, 0x020B, 0x010B, 0x000B, 0x010B,
+         0x020B, 0x030B, 0x040B, 0x050B, 0x060B, 0x070B, 0x080B, 0x080C, 0x070C, 0x060C, 0x050C, 0x040C, 0x030C, 0x020C, 0x010C, 0x000C,
+         0x010C, 0x020C, 0x030C, 0x040C, 0x050C, 0x060C, 0x070C, 0x080C, 0x080D, 0x070D, 0x060D, 0x050D, 0x040D, 0x030D, 0x020D, 0x010D,
+         0x000D, 0x010D, 0x020D, 0x030D, 0x040D, 0x050D, 0x060D, 0x070D, 0x080D, 0x080E, 0x070E, 0x060E, 0x050E, 0x040E, 0x030E, 0x020E,
+         0x010E, 0x000E, 0x010E, 0x020E, 0x030E, 0x040E, 0x050E, 0x060E, 0x070E, 0x080E, 0x080F, 0x070F, 0x060F, 0x050F, 0x040F, 0x030F,
+         0x020F, 0x010F, 0x000F, 0x010F, 0x020F, 0x030F, 0x040F, 0x050F, 0x060F, 0x070F, 0x080F, 0x090F, 0x0A0F, 0x0B0F, 0x0C0F, 0x0D0F,
+      },
+      // diff 1, inten_table 3, selector 1
+      {
+         0x0000, 0x0100, 0x0102, 0x0002, 0x0102, 0x0202, 0x0302, 0x0402, 0x0303, 0x0203, 0x0103, 0x0003, 0x0103, 0x0203, 0x0303, 0x0403,
+         0x0404, 0x0304, 0x0204, 0x0104, 0x0004, 0x0104, 0x0204, 0x0304, 0x0404, 0x0305, 0x0205, 0x0105, 0x0005, 0x0105, 0x0205, 0x0305,
+         0x0405, 0x0306, 0x0206, 0x0106, 0x0006, 0x0106, 0x0206, 0x0306, 0x0406, 0x0307, 0x0207, 0x0107, 0x0007, 0x0107, 0x0207, 0x0307,
+         0x0407, 0x0408, 0x0308, 0x0208, 0x0108, 0x0008, 0x0108, 0x0208, 0x0308, 0x0408, 0x0309, 0x0209, 0x0109, 0x0009, 0x0109, 0x0209,
+         0x0309, 0x0409, 0x030A, 0x020A, 0x010A, 0x000A, 0x010A, 0x020A, 0x030A, 0x040A, 0x030B, 0x020B, 0x010B, 0x000B, 0x010B, 0x020B,
+         0x030B, 0x040B, 0x040C, 0x030C, 0x020C, 0x010C, 0x000C, 0x010C, 0x020C, 0x030C, 0x040C, 0x030D, 0x020D, 0x010D, 0x000D, 0x010D,
+         0x020D, 0x030D, 0x040D, 0x030E, 0x020E, 0x010E, 0x000E, 0x010E, 0x020E, 0x030E, 0x040E, 0x030F, 0x020F, 0x010F, 0x000F, 0x010F,
+         0x020F, 0x030F, 0x040F, 0x0410, 0x0310, 0x0210, 0x0110, 0x0010, 0x0110, 0x0210, 0x0310, 0x0410, 0x0311, 0x0211, 0x0111, 0x0011,
+         0x0111, 0x0211, 0x0311, 0x0411, 0x0312, 0x0212, 0x0112, 0x0012, 0x0112, 0x0212, 0x0312, 0x0412, 0x0313, 0x0213, 0x0113, 0x0013,
+         0x0113, 0x0213, 0x0313, 0x0413, 0x0414, 0x0314, 0x0214, 0x0114, 0x0014, 0x0114, 0x0214, 0x0314, 0x0414, 0x0315, 0x0215, 0x0115,
+         0x0015, 0x0115, 0x0215, 0x0315, 0x0415, 0x0316, 0x0216, 0x0116, 0x0016, 0x0116, 0x0216, 0x0316, 0x0416, 0x0317, 0x0217, 0x0117,
+         0x0017, 0x0117, 0x0217, 0x0317, 0x0417, 0x0418, 0x0318, 0x0218, 0x0118, 0x0018, 0x0118, 0x0218, 0x0318, 0x0418, 0x0319, 0x0219,
+         0x0119, 0x0019, 0x0119, 0x0219, 0x0319, 0x0419, 0x031A, 0x021A, 0x011A, 0x001A, 0x011A, 0x021A, 0x031A, 0x041A, 0x031B, 0x021B,
+         0x011B, 0x001B, 0x011B, 0x021B, 0x031B, 0x041B, 0x041C, 0x031C, 0x021C, 0x011C, 0x001C, 0x011C, 0x021C, 0x031C, 0x041C, 0x031D,
+         0x021D, 0x011D, 0x001D, 0x011D, 0x021D, 0x031D, 0x041D, 0x031E, 0x021E, 0x011E, 0x001E, 0x011E, 0x021E, 0x031E, 0x041E, 0x031F,
+         0x021F, 0x011F, 0x001F, 0x011F, 0x021F, 0x031F, 0x041F, 0x051F, 0x061F, 0x071F, 0x081F, 0x091F, 0x0A1F, 0x0B1F, 0x0C1F, 0x0D1F,
+      },
+      // diff 0, inten_table 4, selector 1
+      {
+         0x0000, 0x0100, 0x0200, 0x0300, 0x0400, 0x0500, 0x0600, 0x0700, 0x0800, 0x0702, 0x0602, 0x0502, 0x0402, 0x0302, 0x0202, 0x0102,
+         0x0002, 0x0102, 0x0202, 0x0302, 0x0402, 0x0502, 0x0602, 0x0702, 0x0802, 0x0803, 0x0703, 0x0603, 0x0503, 0x0403, 0x0303, 0x0203,
+         0x0103, 0x0003, 0x0103, 0x0203, 0x0303, 0x0403, 0x0503, 0x0603, 0x0703, 0x0803, 0x0804, 0x0704, 0x0604, 0x0504, 0x0404, 0x0304,
+         0x0204, 0x0104, 0x0004, 0x0104, 0x0204, 0x0304, 0x0404, 0x0504, 0x0604, 0x0704, 0x0804, 0x0805, 0x0705, 0x0605, 0x0505, 0x0405,
+         0x0305, 0x0205, 0x0105, 0x0005, 0x0105, 0x0205, 0x0305, 0x0405, 0x0505, 0x0605, 0x0705, 0x0805, 0x0806, 0x0706, 0x0606, 0x0506,
+         0x0406, 0x0306, 0x0206, 0x0106, 0x0006, 0x0106, 0x0206, 0x0306, 0x0406, 0x0506, 0x0606, 0x0706, 0x0806, 0x0807, 0x0707, 0x0607,
+         0x0507, 0x0407, 0x0307, 0x0207, 0x0107, 0x0007, 0x0107, 0x0207, 0x0307, 0x0407, 0x0507, 0x0607, 0x0707, 0x0807, 0x0808, 0x0708,
+         0x0608, 0x0508, 0x0408, 0x0308, 0x0208, 0x0108, 0x0008, 0x0108, 0x0208, 0x0308, 0x0408, 0x0508, 0x0608, 0x0708, 0x0808, 0x0809,
+         0x0709, 0x0609, 0x0509, 0x0409, 0x0309, 0x0209, 0x0109, 0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709, 0x0809,
+         0x080A, 0x070A, 0x060A, 0x050A, 0x040A, 0x030A, 0x020A, 0x010A, 0x000A, 0x010A, 0x020A, 0x030A, 0x040A, 0x050A, 0x060A, 0x070A,
+         0x080A, 0x080B, 0x070B, 0x060B, 0x050B, 0x040B, 0x030B, 0x020B, 0x010B, 0x000B, 0x010B, 0x020B, 0x030B, 0x040B, 0x050B, 0x060B,
+         0x070B, 0x080B, 0x080C, 0x070C, 0x060C, 0x050C, 0x040C, 0x030C, 0x020C, 0x010C, 0x000C, 0x010C, 0x020C, 0x030C, 0x040C, 0x050C,
+         0x060C, 0x070C, 0x080C, 0x080D, 0x070D, 0x060D, 0x050D, 0x040D, 0x030D, 0x020D, 0x010D, 0x000D, 0x010D, 0x020D, 0x030D, 0x040D,
+         0x050D, 0x060D, 0x070D, 0x080D, 0x080E, 0x070E, 0x060E, 0x050E, 0x040E, 0x030E, 0x020E, 0x010E, 0x000E, 0x010E, 0x020E, 0x030E,
+         0x040E, 0x050E, 0x060E, 0x070E, 0x080E, 0x080F, 0x070F, 0x060F, 0x050F, 0x040F, 0x030F, 0x020F, 0x010F, 0x000F, 0x010F, 0x020F,
+         0x030F, 0x040F, 0x050F, 0x060F, 0x070F, 0x080F, 0x090F, 0x0A0F, 0x0B0F, 0x0C0F, 0x0D0F, 0x0E0F, 0x0F0F, 0x100F, 0x110F, 0x120F,
+      },
+      // diff 1, inten_table 4, selector 1
+      {
+         0x0000, 0x0100, 0x0200, 0x0300, 0x0203, 0x0103, 0x0003, 0x0103, 0x0203, 0x0303, 0x0403, 0x0404, 0x0304, 0x0204, 0x0104, 0x0004,
+         0x0104, 0x0204, 0x0304, 0x0404, 0x0305, 0x0205, 0x0105, 0x0005, 0x0105, 0x0205, 0x0305, 0x0405, 0x0306, 0x0206, 0x0106, 0x0006,
+         0x0106, 0x0206, 0x0306, 0x0406, 0x0307, 0x0207, 0x0107, 0x0007, 0x0107, 0x0207, 0x0307, 0x0407, 0x0408, 0x0308, 0x0208, 0x0108,
+         0x0008, 0x0108, 0x0208, 0x0308, 0x0408, 0x0309, 0x0209, 0x0109, 0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x030A, 0x020A, 0x010A,
+         0x000A, 0x010A, 0x020A, 0x030A, 0x040A, 0x030B, 0x020B, 0x010B, 0x000B, 0x010B, 0x020B, 0x030B, 0x040B, 0x040C, 0x030C, 0x020C,
+         0x010C, 0x000C, 0x010C, 0x020C, 0x030C, 0x040C, 0x030D, 0x020D, 0x010D, 0x000D, 0x010D, 0x020D, 0x030D, 0x040D, 0x030E, 0x020E,
+         0x010E, 0x000E, 0x010E, 0x020E, 0x030E, 0x040E, 0x030F, 0x020F, 0x010F, 0x000F, 0x010F, 0x020F, 0x030F, 0x040F, 0x0410, 0x0310,
+         0x0210, 0x0110, 0x0010, 0x0110, 0x0210, 0x0310, 0x0410, 0x0311, 0x0211, 0x0111, 0x0011, 0x0111, 0x0211, 0x0311, 0x0411, 0x0312,
+         0x0212, 0x0112, 0x0012, 0x0112, 0x0212, 0x0312, 0x0412, 0x0313, 0x0213, 0x0113, 0x0013, 0x0113, 0x0213, 0x0313, 0x0413, 0x0414,
+         0x0314, 0x0214, 0x0114, 0x0014, 0x0114, 0x0214, 0x0314, 0x0414, 0x0315, 0x0215, 0x0115, 0x0015, 0x0115, 0x0215, 0x0315, 0x0415,
+         0x0316, 0x0216, 0x0116, 0x0016, 0x0116, 0x0216, 0x0316, 0x0416, 0x0317, 0x0217, 0x0117, 0x0017, 0x0117, 0x0217, 0x0317, 0x0417,
+         0x0418, 0x0318, 0x0218, 0x0118, 0x0018, 0x0118, 0x0218, 0x0318, 0x0418, 0x0319, 0x0219, 0x0119, 0x0019, 0x0119, 0x0219, 0x0319,
+         0x0419, 0x031A, 0x021A, 0x011A, 0x001A, 0x011A, 0x021A, 0x031A, 0x041A, 0x031B, 0x021B, 0x011B, 0x001B, 0x011B, 0x021B, 0x031B,
+         0x041B, 0x041C, 0x031C, 0x021C, 0x011C, 0x001C, 0x011C, 0x021C, 0x031C, 0x041C, 0x031D, 0x021D, 0x011D, 0x001D, 0x011D, 0x021D,
+         0x031D, 0x041D, 0x031E, 0x021E, 0x011E, 0x001E, 0x011E, 0x021E, 0x031E, 0x041E, 0x031F, 0x021F, 0x011F, 0x001F, 0x011F, 0x021F,
+         0x031F, 0x041F, 0x051F, 0x061F, 0x071F, 0x081F, 0x091F, 0x0A1F, 0x0B1F, 0x0C1F, 0x0D1F, 0x0E1F, 0x0F1F, 0x101F, 0x111F, 0x121F,
+      },
+      // diff 0, inten_table 5, selector 1
+      {
+         0x0000, 0x0100, 0x0200, 0x0300, 0x0400, 0x0500, 0x0402, 0x0302, 0x0202, 0x0102, 0x0002, 0x0102, 0x0202, 0x0302, 0x0402, 0x0502,
+         0x0602, 0x0702, 0x0802, 0x0803, 0x0703, 0x0603, 0x0503, 0x0403, 0x0303, 0x0203, 0x0103, 0x0003, 0x0103, 0x0203, 0x0303, 0x0403,
+         0x0503, 0x0603, 0x0703, 0x0803, 0x0804, 0x0704, 0x0604, 0x0504, 0x0404, 0x0304, 0x0204, 0x0104, 0x0004, 0x0104, 0x0204, 0x0304,
+         0x0404, 0x0504, 0x0604, 0x0704, 0x0804, 0x0805, 0x0705, 0x0605, 0x0505, 0x0405, 0x0305, 0x0205, 0x0105, 0x0005, 0x0105, 0x0205,
+         0x0305, 0x0405, 0x0505, 0x0605, 0x0705, 0x0805, 0x0806, 0x0706, 0x0606, 0x0506, 0x0406, 0x0306, 0x0206, 0x0106, 0x0006, 0x0106,
+         0x0206, 0x0306, 0x0406, 0x0506, 0x0606, 0x0706, 0x0806, 0x0807, 0x0707, 0x0607, 0x0507, 0x0407, 0x0307, 0x0207, 0x0107, 0x0007,
+         0x0107, 0x0207, 0x0307, 0x0407, 0x0507, 0x0607, 0x0707, 0x0807, 0x0808, 0x0708, 0x0608, 0x0508, 0x0408, 0x0308, 0x0208, 0x0108,
+         0x0008, 0x0108, 0x0208, 0x0308, 0x0408, 0x0508, 0x0608, 0x0708, 0x0808, 0x0809, 0x0709, 0x0609, 0x0509, 0x0409, 0x0309, 0x0209,
+         0x0109, 0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709, 0x0809, 0x080A, 0x070A, 0x060A, 0x050A, 0x040A, 0x030A,
+         0x020A, 0x010A, 0x000A, 0x010A, 0x020A, 0x030A, 0x040A, 0x050A, 0x060A, 0x070A, 0x080A, 0x080B, 0x070B, 0x060B, 0x050B, 0x040B,
+         0x030B, 0x020B, 0x010B, 0x000B, 0x010B, 0x020B, 0x030B, 0x040B, 0x050B, 0x060B, 0x070B, 0x080B, 0x080C, 0x070C, 0x060C, 0x050C,
+         0x040C, 0x030C, 0x020C, 0x010C, 0x000C, 0x010C, 0x020C, 0x030C, 0x040C, 0x050C, 0x060C, 0x070C, 0x080C, 0x080D, 0x070D, 0x060D,
+         0x050D, 0x040D, 0x030D, 0x020D, 0x010D, 0x000D, 0x010D, 0x020D, 0x030D, 0x040D, 0x050D, 0x060D, 0x070D, 0x080D, 0x080E, 0x070E,
+         0x060E, 0x050E, 0x040E, 0x030E, 0x020E, 0x010E, 0x000E, 0x010E, 0x020E, 0x030E, 0x040E, 0x050E, 0x060E, 0x070E, 0x080E, 0x080F,
+         0x070F, 0x060F, 0x050F, 0x040F, 0x030F, 0x020F, 0x010F, 0x000F, 0x010F, 0x020F, 0x030F, 0x040F, 0x050F, 0x060F, 0x070F, 0x080F,
+         0x090F, 0x0A0F, 0x0B0F, 0x0C0F, 0x0D0F, 0x0E0F, 0x0F0F, 0x100F, 0x110F, 0x120F, 0x130F, 0x140F, 0x150F, 0x160F, 0x170F, 0x180F,
+      },
+      // diff 1, inten_table 5, selector 1
+      {
+         0x0000, 0x0100, 0x0200, 0x0300, 0x0400, 0x0404, 0x0304, 0x0204, 0x0104, 0x0004, 0x0104, 0x0204, 0x0304, 0x0404, 0x0305, 0x0205,
+         0x0105, 0x0005, 0x0105, 0x0205, 0x0305, 0x0405, 0x0306, 0x0206, 0x0106, 0x0006, 0x0106, 0x0206, 0x0306, 0x0406, 0x0307, 0x0207,
+         0x0107, 0x0007, 0x0107, 0x0207, 0x0307, 0x0407, 0x0408, 0x0308, 0x0208, 0x0108, 0x0008, 0x0108, 0x0208, 0x0308, 0x0408, 0x0309,
+         0x0209, 0x0109, 0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x030A, 0x020A, 0x010A, 0x000A, 0x010A, 0x020A, 0x030A, 0x040A, 0x030B,
+         0x020B, 0x010B, 0x000B, 0x010B, 0x020B, 0x030B, 0x040B, 0x040C, 0x030C, 0x020C, 0x010C, 0x000C, 0x010C, 0x020C, 0x030C, 0x040C,
+         0x030D, 0x020D, 0x010D, 0x000D, 0x010D, 0x020D, 0x030D, 0x040D, 0x030E, 0x020E, 0x010E, 0x000E, 0x010E, 0x020E, 0x030E, 0x040E,
+         0x030F, 0x020F, 0x010F, 0x000F, 0x010F, 0x020F, 0x030F, 0x040F, 0x0410, 0x0310, 0x0210, 0x0110, 0x0010, 0x0110, 0x0210, 0x0310,
+         0x0410, 0x0311, 0x0211, 0x0111, 0x0011, 0x0111, 0x0211, 0x0311, 0x0411, 0x0312, 0x0212, 0x0112, 0x0012, 0x0112, 0x0212, 0x0312,
+         0x0412, 0x0313, 0x0213, 0x0113, 0x0013, 0x0113, 0x0213, 0x0313, 0x0413, 0x0414, 0x0314, 0x0214, 0x0114, 0x0014, 0x0114, 0x0214,
+         0x0314, 0x0414, 0x0315, 0x0215, 0x0115, 0x0015, 0x0115, 0x0215, 0x0315, 0x0415, 0x0316, 0x0216, 0x0116, 0x0016, 0x0116, 0x0216,
+         0x0316, 0x0416, 0x0317, 0x0217, 0x0117, 0x0017, 0x0117, 0x0217, 0x0317, 0x0417, 0x0418, 0x0318, 0x0218, 0x0118, 0x0018, 0x0118,
+         0x0218, 0x0318, 0x0418, 0x0319, 0x0219, 0x0119, 0x0019, 0x0119, 0x0219, 0x0319, 0x0419, 0x031A, 0x021A, 0x011A, 0x001A, 0x011A,
+         0x021A, 0x031A, 0x041A, 0x031B, 0x021B, 0x011B, 0x001B, 0x011B, 0x021B, 0x031B, 0x041B, 0x041C, 0x031C, 0x021C, 0x011C, 0x001C,
+         0x011C, 0x021C, 0x031C, 0x041C, 0x031D, 0x021D, 0x011D, 0x001D, 0x011D, 0x021D, 0x031D, 0x041D, 0x031E, 0x021E, 0x011E, 0x001E,
+         0x011E, 0x021E, 0x031E, 0x041E, 0x031F, 0x021F, 0x011F, 0x001F, 0x011F, 0x021F, 0x031F, 0x041F, 0x051F, 0x061F, 0x071F, 0x081F,
+         0x091F, 0x0A1F, 0x0B1F, 0x0C1F, 0x0D1F, 0x0E1F, 0x0F1F, 0x101F, 0x111F, 0x121F, 0x131F, 0x141F, 0x151F, 0x161F, 0x171F, 0x181F,
+      },
+      // diff 0, inten_table 6, selector 1
+      {
+         0x0000, 0x0002, 0x0102, 0x0202, 0x0302, 0x0402, 0x0502, 0x0602, 0x0702, 0x0802, 0x0803, 0x0703, 0x0603, 0x0503, 0x0403, 0x0303,
+         0x0203, 0x0103, 0x0003, 0x0103, 0x0203, 0x0303, 0x0403, 0x0503, 0x0603, 0x0703, 0x0803, 0x0804, 0x0704, 0x0604, 0x0504, 0x0404,
+         0x0304, 0x0204, 0x0104, 0x0004, 0x0104, 0x0204, 0x0304, 0x0404, 0x0504, 0x0604, 0x0704, 0x0804, 0x0805, 0x0705, 0x0605, 0x0505,
+         0x0405, 0x0305, 0x0205, 0x0105, 0x0005, 0x0105, 0x0205, 0x0305, 0x0405, 0x0505, 0x0605, 0x0705, 0x0805, 0x0806, 0x0706, 0x0606,
+         0x0506, 0x0406, 0x0306, 0x0206, 0x0106, 0x0006, 0x0106, 0x0206, 0x0306, 0x0406, 0x0506, 0x0606, 0x0706, 0x0806, 0x0807, 0x0707,
+         0x0607, 0x0507, 0x0407, 0x0307, 0x0207, 0x0107, 0x0007, 0x0107, 0x0207, 0x0307, 0x0407, 0x0507, 0x0607, 0x0707, 0x0807, 0x0808,
+         0x0708, 0x0608, 0x0508, 0x0408, 0x0308, 0x0208, 0x0108, 0x0008, 0x0108, 0x0208, 0x0308, 0x0408, 0x0508, 0x0608, 0x0708, 0x0808,
+         0x0809, 0x0709, 0x0609, 0x0509, 0x0409, 0x0309, 0x0209, 0x0109, 0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709,
+         0x0809, 0x080A, 0x070A, 0x060A, 0x050A, 0x040A, 0x030A, 0x020A, 0x010A, 0x000A, 0x010A, 0x020A, 0x030A, 0x040A, 0x050A, 0x060A,
+         0x070A, 0x080A, 0x080B, 0x070B, 0x060B, 0x050B, 0x040B, 0x030B, 0x020B, 0x010B, 0x000B, 0x010B, 0x020B, 0x030B, 0x040B, 0x050B,
+         0x060B, 0x070B, 0x080B, 0x080C, 0x070C, 0x060C, 0x050C, 0x040C, 0x030C, 0x020C, 0x010C, 0x000C, 0x010C, 0x020C, 0x030C, 0x040C,
+         0x050C, 0x060C, 0x070C, 0x080C, 0x080D, 0x070D, 0x060D, 0x050D, 0x040D, 0x030D, 0x020D, 0x010D, 0x000D, 0x010D, 0x020D, 0x030D,
+         0x040D, 0x050D, 0x060D, 0x070D, 0x080D, 0x080E, 0x070E, 0x060E, 0x050E, 0x040E, 0x030E, 0x020E, 0x010E, 0x000E, 0x010E, 0x020E,
+         0x030E, 0x040E, 0x050E, 0x060E, 0x070E, 0x080E, 0x080F, 0x070F, 0x060F, 0x050F, 0x040F, 0x030F, 0x020F, 0x010F, 0x000F, 0x010F,
+         0x020F, 0x030F, 0x040F, 0x050F, 0x060F, 0x070F, 0x080F, 0x090F, 0x0A0F, 0x0B0F, 0x0C0F, 0x0D0F, 0x0E0F, 0x0F0F, 0x100F, 0x110F,
+         0x120F, 0x130F, 0x140F, 0x150F, 0x160F, 0x170F, 0x180F, 0x190F, 0x1A0F, 0x1B0F, 0x1C0F, 0x1D0F, 0x1E0F, 0x1F0F, 0x200F, 0x210F,
+      },
+      // diff 1, inten_table 6, selector 1
+      {
+         0x0000, 0x0100, 0x0200, 0x0300, 0x0400, 0x0305, 0x0205, 0x0105, 0x0005, 0x0105, 0x0205, 0x0305, 0x0405, 0x0306, 0x0206, 0x0106,
+         0x0006, 0x0106, 0x0206, 0x0306, 0x0406, 0x0307, 0x0207, 0x0107, 0x0007, 0x0107, 0x0207, 0x0307, 0x0407, 0x0408, 0x0308, 0x0208,
+         0x0108, 0x0008, 0x0108, 0x0208, 0x0308, 0x0408, 0x0309, 0x0209, 0x0109, 0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x030A, 0x020A,
+         0x010A, 0x000A, 0x010A, 0x020A, 0x030A, 0x040A, 0x030B, 0x020B, 0x010B, 0x000B, 0x010B, 0x020B, 0x030B, 0x040B, 0x040C, 0x030C,
+         0x020C, 0x010C, 0x000C, 0x010C, 0x020C, 0x030C, 0x040C, 0x030D, 0x020D, 0x010D, 0x000D, 0x010D, 0x020D, 0x030D, 0x040D, 0x030E,
+         0x020E, 0x010E, 0x000E, 0x010E, 0x020E, 0x030E, 0x040E, 0x030F, 0x020F, 0x010F, 0x000F, 0x010F, 0x020F, 0x030F, 0x040F, 0x0410,
+         0x0310, 0x0210, 0x0110, 0x0010, 0x0110, 0x0210, 0x0310, 0x0410, 0x0311, 0x0211, 0x0111, 0x0011, 0x0111, 0x0211, 0x0311, 0x0411,
+         0x0312, 0x0212, 0x0112, 0x0012, 0x0112, 0x0212, 0x0312, 0x0412, 0x0313, 0x0213, 0x0113, 0x0013, 0x0113, 0x0213, 0x0313, 0x0413,
+         0x0414, 0x0314, 0x0214, 0x0114, 0x0014, 0x0114, 0x0214, 0x0314, 0x0414, 0x0315, 0x0215, 0x0115, 0x0015, 0x0115, 0x0215, 0x0315,
+         0x0415, 0x0316, 0x0216, 0x0116, 0x0016, 0x0116, 0x0216, 0x0316, 0x0416, 0x0317, 0x0217, 0x0117, 0x0017, 0x0117, 0x0217, 0x0317,
+         0x0417, 0x0418, 0x0318, 0x0218, 0x0118, 0x0018, 0x0118, 0x0218, 0x0318, 0x0418, 0x0319, 0x0219, 0x0119, 0x0019, 0x0119, 0x0219,
+         0x0319, 0x0419, 0x031A, 0x021A, 0x011A, 0x001A, 0x011A, 0x021A, 0x031A, 0x041A, 0x031B, 0x021B, 0x011B, 0x001B, 0x011B, 0x021B,
+         0x031B, 0x041B, 0x041C, 0x031C, 0x021C, 0x011C, 0x001C, 0x011C, 0x021C, 0x031C, 0x041C, 0x031D, 0x021D, 0x011D, 0x001D, 0x011D,
+         0x021D, 0x031D, 0x041D, 0x031E, 0x021E, 0x011E, 0x001E, 0x011E, 0x021E, 0x031E, 0x041E, 0x031F, 0x021F, 0x011F, 0x001F, 0x011F,
+         0x021F, 0x031F, 0x041F, 0x051F, 0x061F, 0x071F, 0x081F, 0x091F, 0x0A1F, 0x0B1F, 0x0C1F, 0x0D1F, 0x0E1F, 0x0F1F, 0x101F, 0x111F,
+         0x121F, 0x131F, 0x141F, 0x151F, 0x161F, 0x171F, 0x181F, 0x191F, 0x1A1F, 0x1B1F, 0x1C1F, 0x1D1F, 0x1E1F, 0x1F1F, 0x201F, 0x211F,
+      },
+      // diff 0, inten_table 7, selector 1
+      {
+         0x0000, 0x0100, 0x0200, 0x0103, 0x0003, 0x0103, 0x0203, 0x0303, 0x0403, 0x0503, 0x0603, 0x0703, 0x0803, 0x0804, 0x0704, 0x0604,
+         0x0504, 0x0404, 0x0304, 0x0204, 0x0104, 0x0004, 0x0104, 0x0204, 0x0304, 0x0404, 0x0504, 0x0604, 0x0704, 0x0804, 0x0805, 0x0705,
+         0x0605, 0x0505, 0x0405, 0x0305, 0x0205, 0x0105, 0x0005, 0x0105, 0x0205, 0x0305, 0x0405, 0x0505, 0x0605, 0x0705, 0x0805, 0x0806,
+         0x0706, 0x0606, 0x0506, 0x0406, 0x0306, 0x0206, 0x0106, 0x0006, 0x0106, 0x0206, 0x0306, 0x0406, 0x0506, 0x0606, 0x0706, 0x0806,
+         0x0807, 0x0707, 0x0607, 0x0507, 0x0407, 0x0307, 0x0207, 0x0107, 0x0007, 0x0107, 0x0207, 0x0307, 0x0407, 0x0507, 0x0607, 0x0707,
+         0x0807, 0x0808, 0x0708, 0x0608, 0x0508, 0x0408, 0x0308, 0x0208, 0x0108, 0x0008, 0x0108, 0x0208, 0x0308, 0x0408, 0x0508, 0x0608,
+         0x0708, 0x0808, 0x0809, 0x0709, 0x0609, 0x0509, 0x0409, 0x0309, 0x0209, 0x0109, 0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509,
+         0x0609, 0x0709, 0x0809, 0x080A, 0x070A, 0x060A, 0x050A, 0x040A, 0x030A, 0x020A, 0x010A, 0x000A, 0x010A, 0x020A, 0x030A, 0x040A,
+         0x050A, 0x060A, 0x070A, 0x080A, 0x080B, 0x070B, 0x060B, 0x050B, 0x040B, 0x030B, 0x020B, 0x010B, 0x000B, 0x010B, 0x020B, 0x030B,
+         0x040B, 0x050B, 0x060B, 0x070B, 0x080B, 0x080C, 0x070C, 0x060C, 0x050C, 0x040C, 0x030C, 0x020C, 0x010C, 0x000C, 0x010C, 0x020C,
+         0x030C, 0x040C, 0x050C, 0x060C, 0x070C, 0x080C, 0x080D, 0x070D, 0x060D, 0x050D, 0x040D, 0x030D, 0x020D, 0x010D, 0x000D, 0x010D,
+         0x020D, 0x030D, 0x040D, 0x050D, 0x060D, 0x070D, 0x080D, 0x080E, 0x070E, 0x060E, 0x050E, 0x040E, 0x030E, 0x020E, 0x010E, 0x000E,
+         0x010E, 0x020E, 0x030E, 0x040E, 0x050E, 0x060E, 0x070E, 0x080E, 0x080F, 0x070F, 0x060F, 0x050F, 0x040F, 0x030F, 0x020F, 0x010F,
+         0x000F, 0x010F, 0x020F, 0x030F, 0x040F, 0x050F, 0x060F, 0x070F, 0x080F, 0x090F, 0x0A0F, 0x0B0F, 0x0C0F, 0x0D0F, 0x0E0F, 0x0F0F,
+         0x100F, 0x110F, 0x120F, 0x130F, 0x140F, 0x150F, 0x160F, 0x170F, 0x180F, 0x190F, 0x1A0F, 0x1B0F, 0x1C0F, 0x1D0F, 0x1E0F, 0x1F0F,
+         0x200F, 0x210F, 0x220F, 0x230F, 0x240F, 0x250F, 0x260F, 0x270F, 0x280F, 0x290F, 0x2A0F, 0x2B0F, 0x2C0F, 0x2D0F, 0x2E0F, 0x2F0F,
+      },
+      // diff 1, inten_table 7, selector 1
+      {
+         0x0000, 0x0100, 0x0006, 0x0106, 0x0206, 0x0306, 0x0406, 0x0307, 0x0207, 0x0107, 0x0007, 0x0107, 0x0207, 0x0307, 0x0407, 0x0408,
+         0x0308, 0x0208, 0x0108, 0x0008, 0x0108, 0x0208, 0x0308, 0x0408, 0x0309, 0x0209, 0x0109, 0x0009, 0x0109, 0x0209, 0x0309, 0x0409,
+         0x030A, 0x020A, 0x010A, 0x000A, 0x010A, 0x020A, 0x030A, 0x040A, 0x030B, 0x020B, 0x010B, 0x000B, 0x010B, 0x020B, 0x030B, 0x040B,
+         0x040C, 0x030C, 0x020C, 0x010C, 0x000C, 0x010C, 0x020C, 0x030C, 0x040C, 0x030D, 0x020D, 0x010D, 0x000D, 0x010D, 0x020D, 0x030D,
+         0x040D, 0x030E, 0x020E, 0x010E, 0x000E, 0x010E, 0x020E, 0x030E, 0x040E, 0x030F, 0x020F, 0x010F, 0x000F, 0x010F, 0x020F, 0x030F,
+         0x040F, 0x0410, 0x0310, 0x0210, 0x0110, 0x0010, 0x0110, 0x0210, 0x0310, 0x0410, 0x0311, 0x0211, 0x0111, 0x0011, 0x0111, 0x0211,
+         0x0311, 0x0411, 0x0312, 0x0212, 0x0112, 0x0012, 0x0112, 0x0212, 0x0312, 0x0412, 0x0313, 0x0213, 0x0113, 0x0013, 0x0113, 0x0213,
+         0x0313, 0x0413, 0x0414, 0x0314, 0x0214, 0x0114, 0x0014, 0x0114, 0x0214, 0x0314, 0x0414, 0x0315, 0x0215, 0x0115, 0x0015, 0x0115,
+         0x0215, 0x0315, 0x0415, 0x0316, 0x0216, 0x0116, 0x0016, 0x0116, 0x0216, 0x0316, 0x0416, 0x0317, 0x0217, 0x0117, 0x0017, 0x0117,
+         0x0217, 0x0317, 0x0417, 0x0418, 0x0318, 0x0218, 0x0118, 0x0018, 0x0118, 0x0218, 0x0318, 0x0418, 0x0319, 0x0219, 0x0119, 0x0019,
+         0x0119, 0x0219, 0x0319, 0x0419, 0x031A, 0x021A, 0x011A, 0x001A, 0x011A, 0x021A, 0x031A, 0x041A, 0x031B, 0x021B, 0x011B, 0x001B,
+         0x011B, 0x021B, 0x031B, 0x041B, 0x041C, 0x031C, 0x021C, 0x011C, 0x001C, 0x011C, 0x021C, 0x031C, 0x041C, 0x031D, 0x021D, 0x011D,
+         0x001D, 0x011D, 0x021D, 0x031D, 0x041D, 0x031E, 0x021E, 0x011E, 0x001E, 0x011E, 0x021E, 0x031E, 0x041E, 0x031F, 0x021F, 0x011F,
+         0x001F, 0x011F, 0x021F, 0x031F, 0x041F, 0x051F, 0x061F, 0x071F, 0x081F, 0x091F, 0x0A1F, 0x0B1F, 0x0C1F, 0x0D1F, 0x0E1F, 0x0F1F,
+         0x101F, 0x111F, 0x121F, 0x131F, 0x141F, 0x151F, 0x161F, 0x171F, 0x181F, 0x191F, 0x1A1F, 0x1B1F, 0x1C1F, 0x1D1F, 0x1E1F, 0x1F1F,
+         0x201F, 0x211F, 0x221F, 0x231F, 0x241F, 0x251F, 0x261F, 0x271F, 0x281F, 0x291F, 0x2A1F, 0x2B1F, 0x2C1F, 0x2D1F, 0x2E1F, 0x2F1F,
+      },
+      // diff 0, inten_table 0, selector 2
+      {
+         0x0200, 0x0100, 0x0000, 0x0100, 0x0200, 0x0300, 0x0400, 0x0500, 0x0600, 0x0700, 0x0800, 0x0801, 0x0701, 0x0601, 0x0501, 0x0401,
+         0x0301, 0x0201, 0x0101, 0x0001, 0x0101, 0x0201, 0x0301, 0x0401, 0x0501, 0x0601, 0x0701, 0x0801, 0x0802, 0x0702, 0x0602, 0x0502,
+         0x0402, 0x0302, 0x0202, 0x0102, 0x0002, 0x0102, 0x0202, 0x0302, 0x0402, 0x0502, 0x0602, 0x0702, 0x0802, 0x0803, 0x0703, 0x0603,
+         0x0503, 0x0403, 0x0303, 0x0203, 0x0103, 0x0003, 0x0103, 0x0203, 0x0303, 0x0403, 0x0503, 0x0603, 0x0703, 0x0803, 0x0804, 0x0704,
+         0x0604, 0x0504, 0x0404, 0x0304, 0x0204, 0x0104, 0x0004, 0x0104, 0x0204, 0x0304, 0x0404, 0x0504, 0x0604, 0x0704, 0x0804, 0x0805,
+         0x0705, 0x0605, 0x0505, 0x0405, 0x0305, 0x0205, 0x0105, 0x0005, 0x0105, 0x0205, 0x0305, 0x0405, 0x0505, 0x0605, 0x0705, 0x0805,
+         0x0806, 0x0706, 0x0606, 0x0506, 0x0406, 0x0306, 0x0206, 0x0106, 0x0006, 0x0106, 0x0206, 0x0306, 0x0406, 0x0506, 0x0606, 0x0706,
+         0x0806, 0x0807, 0x0707, 0x0607, 0x0507, 0x0407, 0x0307, 0x0207, 0x0107, 0x0007, 0x0107, 0x0207, 0x0307, 0x0407, 0x0507, 0x0607,
+         0x0707, 0x0807, 0x0808, 0x0708, 0x0608, 0x0508, 0x0408, 0x0308, 0x0208, 0x0108, 0x0008, 0x0108, 0x0208, 0x0308, 0x0408, 0x0508,
+         0x0608, 0x0708, 0x0808, 0x0809, 0x0709, 0x0609, 0x0509, 0x0409, 0x0309, 0x0209, 0x0109, 0x0009, 0x0109, 0x0209, 0x0309, 0x0409,
+         0x0509, 0x0609, 0x0709, 0x0809, 0x080A, 0x070A, 0x060A, 0x050A, 0x040A, 0x030A, 0x020A, 0x010A, 0x000A, 0x010A, 0x020A, 0x030A,
+         0x040A, 0x050A, 0x060A, 0x070A, 0x080A, 0x080B, 0x070B, 0x060B, 0x050B, 0x040B, 0x030B, 0x020B, 0x010B, 0x000B, 0x010B, 0x020B,
+         0x030B, 0x040B, 0x050B, 0x060B, 0x070B, 0x080B, 0x080C, 0x070C, 0x060C, 0x050C, 0x040C, 0x030C, 0x020C, 0x010C, 0x000C, 0x010C,
+         0x020C, 0x030C, 0x040C, 0x050C, 0x060C, 0x070C, 0x080C, 0x080D, 0x070D, 0x060D, 0x050D, 0x040D, 0x030D, 0x020D, 0x010D, 0x000D,
+         0x010D, 0x020D, 0x030D, 0x040D, 0x050D, 0x060D, 0x070D, 0x080D, 0x080E, 0x070E, 0x060E, 0x050E, 0x040E, 0x030E, 0x020E, 0x010E,
+         0x000E, 0x010E, 0x020E, 0x030E, 0x040E, 0x050E, 0x060E, 0x070E, 0x070F, 0x060F, 0x050F, 0x040F, 0x030F, 0x020F, 0x010F, 0x000F,
+      },
+      // diff 1, inten_table 0, selector 2
+      {
+         0x0200, 0x0100, 0x0000, 0x0100, 0x0200, 0x0300, 0x0400, 0x0301, 0x0201, 0x0101, 0x0001, 0x0101, 0x0201, 0x0301, 0x0401, 0x0302,
+         0x0202, 0x0102, 0x0002, 0x0102, 0x0202, 0x0302, 0x0402, 0x0303, 0x0203, 0x0103, 0x0003, 0x0103, 0x0203, 0x0303, 0x0403, 0x0404,
+         0x0304, 0x0204, 0x0104, 0x0004, 0x0104, 0x0204, 0x0304, 0x0404, 0x0305, 0x0205, 0x0105, 0x0005, 0x0105, 0x0205, 0x0305, 0x0405,
+         0x0306, 0x0206, 0x0106, 0x0006, 0x0106, 0x0206, 0x0306, 0x0406, 0x0307, 0x0207, 0x0107, 0x0007, 0x0107, 0x0207, 0x0307, 0x0407,
+         0x0408, 0x0308, 0x0208, 0x0108, 0x0008, 0x0108, 0x0208, 0x0308, 0x0408, 0x0309, 0x0209, 0x0109, 0x0009, 0x0109, 0x0209, 0x0309,
+         0x0409, 0x030A, 0x020A, 0x010A, 0x000A, 0x010A, 0x020A, 0x030A, 0x040A, 0x030B, 0x020B, 0x010B, 0x000B, 0x010B, 0x020B, 0x030B,
+         0x040B, 0x040C, 0x030C, 0x020C, 0x010C, 0x000C, 0x010C, 0x020C, 0x030C, 0x040C, 0x030D, 0x020D, 0x010D, 0x000D, 0x010D, 0x020D,
+         0x030D, 0x040D, 0x030E, 0x020E, 0x010E, 0x000E, 0x010E, 0x020E, 0x030E, 0x040E, 0x030F, 0x020F, 0x010F, 0x000F, 0x010F, 0x020F,
+         0x030F, 0x040F, 0x0410, 0x0310, 0x0210, 0x0110, 0x0010, 0x0110, 0x0210, 0x0310, 0x0410, 0x0311, 0x0211, 0x0111, 0x0011, 0x0111,
+         0x0211, 0x0311, 0x0411, 0x0312, 0x0212, 0x0112, 0x0012, 0x0112, 0x0212, 0x0312, 0x0412, 0x0313, 0x0213, 0x0113, 0x0013, 0x0113,
+         0x0213, 0x0313, 0x0413, 0x0414, 0x0314, 0x0214, 0x0114, 0x0014, 0x0114, 0x0214, 0x0314, 0x0414, 0x0315, 0x0215, 0x0115, 0x0015,
+         0x0115, 0x0215, 0x0315, 0x0415, 0x0316, 0x0216, 0x0116, 0x0016, 0x0116, 0x0216, 0x0316, 0x0416, 0x0317, 0x0217, 0x0117, 0x0017,
+         0x0117, 0x0217, 0x0317, 0x0417, 0x0418, 0x0318, 0x0218, 0x0118, 0x0018, 0x0118, 0x0218, 0x0318, 0x0418, 0x0319, 0x0219, 0x0119,
+         0x0019, 0x0119, 0x0219, 0x0319, 0x0419, 0x031A, 0x021A, 0x011A, 0x001A, 0x011A, 0x021A, 0x031A, 0x041A, 0x031B, 0x021B, 0x011B,
+         0x001B, 0x011B, 0x021B, 0x031B, 0x041B, 0x041C, 0x031C, 0x021C, 0x011C, 0x001C, 0x011C, 0x021C, 0x031C, 0x041C, 0x031D, 0x021D,
+         0x011D, 0x001D, 0x011D, 0x021D, 0x031D, 0x041D, 0x031E, 0x021E, 0x011E, 0x001E, 0x011E, 0x021E, 0x031E, 0x021F, 0x011F, 0x001F,
+      },
+      // diff 0, inten_table 1, selector 2
+      {
+         0x0500, 0x0400, 0x0300, 0x0200, 0x0100, 0x0000, 0x0100, 0x0200, 0x0300, 0x0400, 0x0500, 0x0600, 0x0700, 0x0800, 0x0801, 0x0701,
+         0x0601, 0x0501, 0x0401, 0x0301, 0x0201, 0x0101, 0x0001, 0x0101, 0x0201, 0x0301, 0x0401, 0x0501, 0x0601, 0x0701, 0x0801, 0x0802,
+         0x0702, 0x0602, 0x0502, 0x0402, 0x0302, 0x0202, 0x0102, 0x0002, 0x0102, 0x0202, 0x0302, 0x0402, 0x0502, 0x0602, 0x0702, 0x0802,
+         0x0803, 0x0703, 0x0603, 0x0503, 0x0403, 0x0303, 0x0203, 0x0103, 0x0003, 0x0103, 0x0203, 0x0303, 0x0403, 0x0503, 0x0603, 0x0703,
+         0x0803, 0x0804, 0x0704, 0x0604, 0x0504, 0x0404, 0x0304, 0x0204, 0x0104, 0x0004, 0x0104, 0x0204, 0x0304, 0x0404, 0x0504, 0x0604,
+         0x0704, 0x0804, 0x0805, 0x0705, 0x0605, 0x0505, 0x0405, 0x0305, 0x0205, 0x0105, 0x0005, 0x0105, 0x0205, 0x0305, 0x0405, 0x0505,
+         0x0605, 0x0705, 0x0805, 0x0806, 0x0706, 0x0606, 0x0506, 0x0406, 0x0306, 0x0206, 0x0106, 0x0006, 0x0106, 0x0206, 0x0306, 0x0406,
+         0x0506, 0x0606, 0x0706, 0x0806, 0x0807, 0x0707, 0x0607, 0x0507, 0x0407, 0x0307, 0x0207, 0x0107, 0x0007, 0x0107, 0x0207, 0x0307,
+         0x0407, 0x0507, 0x0607, 0x0707, 0x0807, 0x0808, 0x0708, 0x0608, 0x0508, 0x0408, 0x0308, 0x0208, 0x0108, 0x0008, 0x0108, 0x0208,
+         0x0308, 0x0408, 0x0508, 0x0608, 0x0708, 0x0808, 0x0809, 0x0709, 0x0609, 0x0509, 0x0409, 0x0309, 0x0209, 0x0109, 0x0009, 0x0109,
+         0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709, 0x0809, 0x080A, 0x070A, 0x060A, 0x050A, 0x040A, 0x030A, 0x020A, 0x010A, 0x000A,
+         0x010A, 0x020A, 0x030A, 0x040A, 0x050A, 0x060A, 0x070A, 0x080A, 0x080B, 0x070B, 0x060B, 0x050B, 0x040B, 0x030B, 0x020B, 0x010B,
+         0x000B, 0x010B, 0x020B, 0x030B, 0x040B, 0x050B, 0x060B, 0x070B, 0x080B, 0x080C, 0x070C, 0x060C, 0x050C, 0x040C, 0x030C, 0x020C,
+         0x010C, 0x000C, 0x010C, 0x020C, 0x030C, 0x040C, 0x050C, 0x060C, 0x070C, 0x080C, 0x080D, 0x070D, 0x060D, 0x050D, 0x040D, 0x030D,
+         0x020D, 0x010D, 0x000D, 0x010D, 0x020D, 0x030D, 0x040D, 0x050D, 0x060D, 0x070D, 0x080D, 0x080E, 0x070E, 0x060E, 0x050E, 0x040E,
+         0x030E, 0x020E, 0x010E, 0x000E, 0x010E, 0x020E, 0x030E, 0x040E, 0x050E, 0x060E, 0x050F, 0x040F, 0x030F, 0x020F, 0x010F, 0x000F,
+      },
+      // diff 1, inten_table 1, selector 2
+      {
+         0x0500, 0x0400, 0x0300, 0x0200, 0x0100, 0x0000, 0x0100, 0x0200, 0x0300, 0x0400, 0x0301, 0x0201, 0x0101, 0x0001, 0x0101, 0x0201,
+         0x0301, 0x0401, 0x0302, 0x0202, 0x0102, 0x0002, 0x0102, 0x0202, 0x0302, 0x0402, 0x0303, 0x0203, 0x0103, 0x0003, 0x0103, 0x0203,
+         0x0303, 0x0403, 0x0404, 0x0304, 0x0204, 0x0104, 0x0004, 0x0104, 0x0204, 0x0304, 0x0404, 0x0305, 0x0205, 0x0105, 0x0005, 0x0105,
+         0x0205, 0x0305, 0x0405, 0x0306, 0x0206, 0x0106, 0x0006, 0x0106, 0x0206, 0x0306, 0x0406, 0x0307, 0x0207, 0x0107, 0x0007, 0x0107,
+         0x0207, 0x0307, 0x0407, 0x0408, 0x0308, 0x0208, 0x0108, 0x0008, 0x0108, 0x0208, 0x0308, 0x0408, 0x0309, 0x0209, 0x0109, 0x0009,
+         0x0109, 0x0209, 0x0309, 0x0409, 0x030A, 0x020A, 0x010A, 0x000A, 0x010A, 0x020A, 0x030A, 0x040A, 0x030B, 0x020B, 0x010B, 0x000B,
+         0x010B, 0x020B, 0x030B, 0x040B, 0x040C, 0x030C, 0x020C, 0x010C, 0x000C, 0x010C, 0x020C, 0x030C, 0x040C, 0x030D, 0x020D, 0x010D,
+         0x000D, 0x010D, 0x020D, 0x030D, 0x040D, 0x030E, 0x020E, 0x010E, 0x000E, 0x010E, 0x020E, 0x030E, 0x040E, 0x030F, 0x020F, 0x010F,
+         0x000F, 0x010F, 0x020F, 0x030F, 0x040F, 0x0410, 0x0310, 0x0210, 0x0110, 0x0010, 0x0110, 0x0210, 0x0310, 0x0410, 0x0311, 0x0211,
+         0x0111, 0x0011, 0x0111, 0x0211, 0x0311, 0x0411, 0x0312, 0x0212, 0x0112, 0x0012, 0x0112, 0x0212, 0x0312, 0x0412, 0x0313, 0x0213,
+         0x0113, 0x0013, 0x0113, 0x0213, 0x0313, 0x0413, 0x0414, 0x0314, 0x0214, 0x0114, 0x0014, 0x0114, 0x0214, 0x0314, 0x0414, 0x0315,
+         0x0215, 0x0115, 0x0015, 0x0115, 0x0215, 0x0315, 0x0415, 0x0316, 0x0216, 0x0116, 0x0016, 0x0116, 0x0216, 0x0316, 0x0416, 0x0317,
+         0x0217, 0x0117, 0x0017, 0x0117, 0x0217, 0x0317, 0x0417, 0x0418, 0x0318, 0x0218, 0x0118, 0x0018, 0x0118, 0x0218, 0x0318, 0x0418,
+         0x0319, 0x0219, 0x0119, 0x0019, 0x0119, 0x0219, 0x0319, 0x0419, 0x031A, 0x021A, 0x011A, 0x001A, 0x011A, 0x021A, 0x031A, 0x041A,
+         0x031B, 0x021B, 0x011B, 0x001B, 0x011B, 0x021B, 0x031B, 0x041B, 0x041C, 0x031C, 0x021C, 0x011C, 0x001C, 0x011C, 0x021C, 0x031C,
+         0x041C, 0x031D, 0x021D, 0x011D, 0x001D, 0x011D, 0x021D, 0x031D, 0x041D, 0x031E, 0x021E, 0x011E, 0x001E, 0x011E, 0x011F, 0x001F,
+      },
+      // diff 0, inten_table 2, selector 2
+      {
+         0x0900, 0x0800, 0x0700, 0x0600, 0x0500, 0x0400, 0x0300, 0x0200, 0x0100, 0x0000, 0x0100, 0x0200, 0x0300, 0x0400, 0x0500, 0x0600,
+         0x0700, 0x0800, 0x0801, 0x0701, 0x0601, 0x0501, 0x0401, 0x0301, 0x0201, 0x0101, 0x0001, 0x0101, 0x0201, 0x0301, 0x0401, 0x0501,
+         0x0601, 0x0701, 0x0801, 0x0802, 0x0702, 0x0602, 0x0502, 0x0402, 0x0302, 0x0202, 0x0102, 0x0002, 0x0102, 0x0202, 0x0302, 0x0402,
+         0x0502, 0x0602, 0x0702, 0x0802, 0x0803, 0x0703, 0x0603, 0x0503, 0x0403, 0x0303, 0x0203, 0x0103, 0x0003, 0x0103, 0x0203, 0x0303,
+         0x0403, 0x0503, 0x0603, 0x0703, 0x0803, 0x0804, 0x0704, 0x0604, 0x0504, 0x0404, 0x0304, 0x0204, 0x0104, 0x0004, 0x0104, 0x0204,
+         0x0304, 0x0404, 0x0504, 0x0604, 0x0704, 0x0804, 0x0805, 0x0705, 0x0605, 0x0505, 0x0405, 0x0305, 0x0205, 0x0105, 0x0005, 0x0105,
+         0x0205, 0x0305, 0x0405, 0x0505, 0x0605, 0x0705, 0x0805, 0x0806, 0x0706, 0x0606, 0x0506, 0x0406, 0x0306, 0x0206, 0x0106, 0x0006,
+         0x0106, 0x0206, 0x0306, 0x0406, 0x0506, 0x0606, 0x0706, 0x0806, 0x0807, 0x0707, 0x0607, 0x0507, 0x0407, 0x0307, 0x0207, 0x0107,
+         0x0007, 0x0107, 0x0207, 0x0307, 0x0407, 0x0507, 0x0607, 0x0707, 0x0807, 0x0808, 0x0708, 0x0608, 0x0508, 0x0408, 0x0308, 0x0208,
+         0x0108, 0x0008, 0x0108, 0x0208, 0x0308, 0x0408, 0x0508, 0x0608, 0x0708, 0x0808, 0x0809, 0x0709, 0x0609, 0x0509, 0x0409, 0x0309,
+         0x0209, 0x0109, 0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709, 0x0809, 0x080A, 0x070A, 0x060A, 0x050A, 0x040A,
+         0x030A, 0x020A, 0x010A, 0x000A, 0x010A, 0x020A, 0x030A, 0x040A, 0x050A, 0x060A, 0x070A, 0x080A, 0x080B, 0x070B, 0x060B, 0x050B,
+         0x040B, 0x030B, 0x020B, 0x010B, 0x000B, 0x010B, 0x020B, 0x030B, 0x040B, 0x050B, 0x060B, 0x070B, 0x080B, 0x080C, 0x070C, 0x060C,
+         0x050C, 0x040C, 0x030C, 0x020C, 0x010C, 0x000C, 0x010C, 0x020C, 0x030C, 0x040C, 0x050C, 0x060C, 0x070C, 0x080C, 0x080D, 0x070D,
+         0x060D, 0x050D, 0x040D, 0x030D, 0x020D, 0x010D, 0x000D, 0x010D, 0x020D, 0x030D, 0x040D, 0x050D, 0x060D, 0x070D, 0x080D, 0x080E,
+         0x070E, 0x060E, 0x050E, 0x040E, 0x030E, 0x020E, 0x010E, 0x000E, 0x010E, 0x020E, 0x030E, 0x040E, 0x030F, 0x020F, 0x010F, 0x000F,
+      },
+      // diff 1, inten_table 2, selector 2
+      {
+         0x0900, 0x0800, 0x0700, 0x0600, 0x0500, 0x0400, 0x0300, 0x0200, 0x0100, 0x0000, 0x0100, 0x0200, 0x0300, 0x0400, 0x0301, 0x0201,
+         0x0101, 0x0001, 0x0101, 0x0201, 0x0301, 0x0401, 0x0302, 0x0202, 0x0102, 0x0002, 0x0102, 0x0202, 0x0302, 0x0402, 0x0303, 0x0203,
+         0x0103, 0x0003, 0x0103, 0x0203, 0x0303, 0x0403, 0x0404, 0x0304, 0x0204, 0x0104, 0x0004, 0x0104, 0x0204, 0x0304, 0x0404, 0x0305,
+         0x0205, 0x0105, 0x0005, 0x0105, 0x0205, 0x0305, 0x0405, 0x0306, 0x0206, 0x0106, 0x0006, 0x0106, 0x0206, 0x0306, 0x0406, 0x0307,
+         0x0207, 0x0107, 0x0007, 0x0107, 0x0207, 0x0307, 0x0407, 0x0408, 0x0308, 0x0208, 0x0108, 0x0008, 0x0108, 0x0208, 0x0308, 0x0408,
+         0x0309, 0x0209, 0x0109, 0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x030A, 0x020A, 0x010A, 0x000A, 0x010A, 0x020A, 0x030A, 0x040A,
+         0x030B, 0x020B, 0x010B, 0x000B, 0x010B, 0x020B, 0x030B, 0x040B, 0x040C, 0x030C, 0x020C, 0x010C, 0x000C, 0x010C, 0x020C, 0x030C,
+         0x040C, 0x030D, 0x020D, 0x010D, 0x000D, 0x010D, 0x020D, 0x030D, 0x040D, 0x030E, 0x020E, 0x010E, 0x000E, 0x010E, 0x020E, 0x030E,
+         0x040E, 0x030F, 0x020F, 0x010F, 0x000F, 0x010F, 0x020F, 0x030F, 0x040F, 0x0410, 0x0310, 0x0210, 0x0110, 0x0010, 0x0110, 0x0210,
+         0x0310, 0x0410, 0x0311, 0x0211, 0x0111, 0x0011, 0x0111, 0x0211, 0x0311, 0x0411, 0x0312, 0x0212, 0x0112, 0x0012, 0x0112, 0x0212,
+         0x0312, 0x0412, 0x0313, 0x0213, 0x0113, 0x0013, 0x0113, 0x0213, 0x0313, 0x0413, 0x0414, 0x0314, 0x0214, 0x0114, 0x0014, 0x0114,
+         0x0214, 0x0314, 0x0414, 0x0315, 0x0215, 0x0115, 0x0015, 0x0115, 0x0215, 0x0315, 0x0415, 0x0316, 0x0216, 0x0116, 0x0016, 0x0116,
+         0x0216, 0x0316, 0x0416, 0x0317, 0x0217, 0x0117, 0x0017, 0x0117, 0x0217, 0x0317, 0x0417, 0x0418, 0x0318, 0x0218, 0x0118, 0x0018,
+         0x0118, 0x0218, 0x0318, 0x0418, 0x0319, 0x0219, 0x0119, 0x0019, 0x0119, 0x0219, 0x0319, 0x0419, 0x031A, 0x021A, 0x011A, 0x001A,
+         0x011A, 0x021A, 0x031A, 0x041A, 0x031B, 0x021B, 0x011B, 0x001B, 0x011B, 0x021B, 0x031B, 0x041B, 0x041C, 0x031C, 0x021C, 0x011C,
+         0x001C, 0x011C, 0x021C, 0x031C, 0x041C, 0x031D, 0x021D, 0x011D, 0x001D, 0x011D, 0x021D, 0x031D, 0x031E, 0x021E, 0x011E, 0x001E,
+      },
+      // diff 0, inten_table 3, selector 2
+      {
+         0x0D00, 0x0C00, 0x0B00, 0x0A00, 0x0900, 0x0800, 0x0700, 0x0600, 0x0500, 0x0400, 0x0300, 0x0200, 0x0100, 0x0000, 0x0100, 0x0200,
+         0x0300, 0x0400, 0x0500, 0x0600, 0x0700, 0x0800, 0x0801, 0x0701, 0x0601, 0x0501, 0x0401, 0x0301, 0x0201, 0x0101, 0x0001, 0x0101,
+         0x0201, 0x0301, 0x0401, 0x0501, 0x0601, 0x0701, 0x0801, 0x0802, 0x0702, 0x0602, 0x0502, 0x0402, 0x0302, 0x0202, 0x0102, 0x0002,
+         0x0102, 0x0202, 0x0302, 0x0402, 0x0502, 0x0602, 0x0702, 0x0802, 0x0803, 0x0703, 0x0603, 0x0503, 0x0403, 0x0303, 0x0203, 0x0103,
+         0x0003, 0x0103, 0x0203, 0x0303, 0x0403, 0x0503, 0x0603, 0x0703, 0x0803, 0x0804, 0x0704, 0x0604, 0x0504, 0x0404, 0x0304, 0x0204,
+         0x0104, 0x0004, 0x0104, 0x0204, 0x0304, 0x0404, 0x0504, 0x0604, 0x0704, 0x0804, 0x0805, 0x0705, 0x0605, 0x0505, 0x0405, 0x0305,
+         0x0205, 0x0105, 0x0005, 0x0105, 0x0205, 0x0305, 0x0405, 0x0505, 0x0605, 0x0705, 0x0805, 0x0806, 0x0706, 0x0606, 0x0506, 0x0406,
+         0x0306, 0x0206, 0x0106, 0x0006, 0x0106, 0x0206, 0x0306, 0x0406, 0x0506, 0x0606, 0x0706, 0x0806, 0x0807, 0x0707, 0x0607, 0x0507,
+         0x0407, 0x0307, 0x0207, 0x0107, 0x0007, 0x0107, 0x0207, 0x0307, 0x0407, 0x0507, 0x0607, 0x0707, 0x0807, 0x0808, 0x0708, 0x0608,
+         0x0508, 0x0408, 0x0308, 0x0208, 0x0108, 0x0008, 0x0108, 0x0208, 0x0308, 0x0408, 0x0508, 0x0608, 0x0708, 0x0808, 0x0809, 0x0709,
+         0x0609, 0x0509, 0x0409, 0x0309, 0x0209, 0x0109, 0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709, 0x0809, 0x080A,
+         0x070A, 0x060A, 0x050A, 0x040A, 0x030A, 0x020A, 0x010A, 0x000A, 0x010A, 0x020A, 0x030A, 0x040A, 0x050A, 0x060A, 0x070A, 0x080A,
+         0x080B, 0x070B, 0x060B, 0x050B, 0x040B, 0x030B, 0x020B, 0x010B, 0x000B, 0x010B, 0x020B, 0x030B, 0x040B, 0x050B, 0x060B, 0x070B,
+         0x080B, 0x080C, 0x070C, 0x060C, 0x050C, 0x040C, 0x030C, 0x020C, 0x010C, 0x000C, 0x010C, 0x020C, 0x030C, 0x040C, 0x050C, 0x060C,
+         0x070C, 0x080C, 0x080D, 0x070D, 0x060D, 0x050D, 0x040D, 0x030D, 0x020D, 0x010D, 0x000D, 0x010D, 0x020D, 0x030D, 0x040D, 0x050D,
+         0x060D, 0x070D, 0x080D, 0x080E, 0x070E, 0x060E, 0x050E, 0x040E, 0x030E, 0x020E, 0x010E, 0x000E, 0x010E, 0x020E, 0x010F, 0x000F,
+      },
+      // diff 1, inten_table 3, selector 2
+      {
+         0x0D00, 0x0C00, 0x0B00, 0x0A00, 0x0900, 0x0800, 0x0700, 0x0600, 0x0500, 0x0400, 0x0300, 0x0200, 0x0100, 0x0000, 0x0100, 0x0200,
+         0x0300, 0x0400, 0x0301, 0x0201, 0x0101, 0x0001, 0x0101, 0x0201, 0x0301, 0x0401, 0x0302, 0x0202, 0x0102, 0x0002, 0x0102, 0x0202,
+         0x0302, 0x0402, 0x0303, 0x0203, 0x0103, 0x0003, 0x0103, 0x0203, 0x0303, 0x0403, 0x0404, 0x0304, 0x0204, 0x0104, 0x0004, 0x0104,
+         0x0204, 0x0304, 0x0404, 0x0305, 0x0205, 0x0105, 0x0005, 0x0105, 0x0205, 0x0305, 0x0405, 0x0306, 0x0206, 0x0106, 0x0006, 0x0106,
+         0x0206, 0x0306, 0x0406, 0x0307, 0x0207, 0x0107, 0x0007, 0x0107, 0x0207, 0x0307, 0x0407, 0x0408, 0x0308, 0x0208, 0x0108, 0x0008,
+         0x0108, 0x0208, 0x0308, 0x0408, 0x0309, 0x0209, 0x0109, 0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x030A, 0x020A, 0x010A, 0x000A,
+         0x010A, 0x020A, 0x030A, 0x040A, 0x030B, 0x020B, 0x010B, 0x000B, 0x010B, 0x020B, 0x030B, 0x040B, 0x040C, 0x030C, 0x020C, 0x010C,
+         0x000C, 0x010C, 0x020C, 0x030C, 0x040C, 0x030D, 0x020D, 0x010D, 0x000D, 0x010D, 0x020D, 0x030D, 0x040D, 0x030E, 0x020E, 0x010E,
+         0x000E, 0x010E, 0x020E, 0x030E, 0x040E, 0x030F, 0x020F, 0x010F, 0x000F, 0x010F, 0x020F, 0x030F, 0x040F, 0x0410, 0x0310, 0x0210,
+         0x0110, 0x0010, 0x0110, 0x0210, 0x0310, 0x0410, 0x0311, 0x0211, 0x0111, 0x0011, 0x0111, 0x0211, 0x0311, 0x0411, 0x0312, 0x0212,
+         0x0112, 0x0012, 0x0112, 0x0212, 0x0312, 0x0412, 0x0313, 0x0213, 0x0113, 0x0013, 0x0113, 0x0213, 0x0313, 0x0413, 0x0414, 0x0314,
+         0x0214, 0x0114, 0x0014, 0x0114, 0x0214, 0x0314, 0x0414, 0x0315, 0x0215, 0x0115, 0x0015, 0x0115, 0x0215, 0x0315, 0x0415, 0x0316,
+         0x0216, 0x0116, 0x0016, 0x0116, 0x0216, 0x0316, 0x0416, 0x0317, 0x0217, 0x0117, 0x0017, 0x0117, 0x0217, 0x0317, 0x0417, 0x0418,
+         0x0318, 0x0218, 0x0118, 0x0018, 0x0118, 0x0218, 0x0318, 0x0418, 0x0319, 0x0219, 0x0119, 0x0019, 0x0119, 0x0219, 0x0319, 0x0419,
+         0x031A, 0x021A, 0x011A, 0x001A, 0x011A, 0x021A, 0x031A, 0x041A, 0x031B, 0x021B, 0x011B, 0x001B, 0x011B, 0x021B, 0x031B, 0x041B,
+         0x041C, 0x031C, 0x021C, 0x011C, 0x001C, 0x011C, 0x021C, 0x031C, 0x041C, 0x031D, 0x021D, 0x011D, 0x001D, 0x011D, 0x011E, 0x001E,
+      },
+      // diff 0, inten_table 4, selector 2
+      {
+         0x1200, 0x1100, 0x1000, 0x0F00, 0x0E00, 0x0D00, 0x0C00, 0x0B00, 0x0A00, 0x0900, 0x0800, 0x0700, 0x0600, 0x0500, 0x0400, 0x0300,
+         0x0200, 0x0100, 0x0000, 0x0100, 0x0200, 0x0300, 0x0400, 0x0500, 0x0600, 0x0700, 0x0800, 0x0801, 0x0701, 0x0601, 0x0501, 0x0401,
+         0x0301, 0x0201, 0x0101, 0x0001, 0x0101, 0x0201, 0x0301, 0x0401, 0x0501, 0x0601, 0x0701, 0x0801, 0x0802, 0x0702, 0x0602, 0x0502,
+         0x0402, 0x0302, 0x0202, 0x0102, 0x0002, 0x0102, 0x0202, 0x0302, 0x0402, 0x0502, 0x0602, 0x0702, 0x0802, 0x0803, 0x0703, 0x0603,
+         0x0503, 0x0403, 0x0303, 0x0203, 0x0103, 0x0003, 0x0103, 0x0203, 0x0303, 0x0403, 0x0503, 0x0603, 0x0703, 0x0803, 0x0804, 0x0704,
+         0x0604, 0x0504, 0x0404, 0x0304, 0x0204, 0x0104, 0x0004, 0x0104, 0x0204, 0x0304, 0x0404, 0x0504, 0x0604, 0x0704, 0x0804, 0x0805,
+         0x0705, 0x0605, 0x0505, 0x0405, 0x0305, 0x0205, 0x0105, 0x0005, 0x0105, 0x0205, 0x0305, 0x0405, 0x0505, 0x0605, 0x0705, 0x0805,
+         0x0806, 0x0706, 0x0606, 0x0506, 0x0406, 0x0306, 0x0206, 0x0106, 0x0006, 0x0106, 0x0206, 0x0306, 0x0406, 0x0506, 0x0606, 0x0706,
+         0x0806, 0x0807, 0x0707, 0x0607, 0x0507, 0x0407, 0x0307, 0x0207, 0x0107, 0x0007, 0x0107, 0x0207, 0x0307, 0x0407, 0x0507, 0x0607,
+         0x0707, 0x0807, 0x0808, 0x0708, 0x0608, 0x0508, 0x0408, 0x0308, 0x0208, 0x0108, 0x0008, 0x0108, 0x0208, 0x0308, 0x0408, 0x0508,
+         0x0608, 0x0708, 0x0808, 0x0809, 0x0709, 0x0609, 0x0509, 0x0409, 0x0309, 0x0209, 0x0109, 0x0009, 0x0109, 0x0209, 0x0309, 0x0409,
+         0x0509, 0x0609, 0x0709, 0x0809, 0x080A, 0x070A, 0x060A, 0x050A, 0x040A, 0x030A, 0x020A, 0x010A, 0x000A, 0x010A, 0x020A, 0x030A,
+         0x040A, 0x050A, 0x060A, 0x070A, 0x080A, 0x080B, 0x070B, 0x060B, 0x050B, 0x040B, 0x030B, 0x020B, 0x010B, 0x000B, 0x010B, 0x020B,
+         0x030B, 0x040B, 0x050B, 0x060B, 0x070B, 0x080B, 0x080C, 0x070C, 0x060C, 0x050C, 0x040C, 0x030C, 0x020C, 0x010C, 0x000C, 0x010C,
+         0x020C, 0x030C, 0x040C, 0x050C, 0x060C, 0x070C, 0x080C, 0x080D, 0x070D, 0x060D, 0x050D, 0x040D, 0x030D, 0x020D, 0x010D, 0x000D,
+         0x010D, 0x020D, 0x030D, 0x040D, 0x050D, 0x060D, 0x070D, 0x080D, 0x070E, 0x060E, 0x050E, 0x040E, 0x030E, 0x020E, 0x010E, 0x000E,
+      },
+      // diff 1, inten_table 4, selector 2
+      {
+         0x1200, 0x1100, 0x1000, 0x0F00, 0x0E00, 0x0D00, 0x0C00, 0x0B00, 0x0A00, 0x0900, 0x0800, 0x0700, 0x0600, 0x0500, 0x0400, 0x0300,
+         0x0200, 0x0100, 0x0000, 0x0100, 0x0200, 0x0300, 0x0400, 0x0301, 0x0201, 0x0101, 0x0001, 0x0101, 0x0201, 0x0301, 0x0401, 0x0302,
+         0x0202, 0x0102, 0x0002, 0x0102, 0x0202, 0x0302, 0x0402, 0x0303, 0x0203, 0x0103, 0x0003, 0x0103, 0x0203, 0x0303, 0x0403, 0x0404,
+         0x0304, 0x0204, 0x0104, 0x0004, 0x0104, 0x0204, 0x0304, 0x0404, 0x0305, 0x0205, 0x0105, 0x0005, 0x0105, 0x0205, 0x0305, 0x0405,
+         0x0306, 0x0206, 0x0106, 0x0006, 0x0106, 0x0206, 0x0306, 0x0406, 0x0307, 0x0207, 0x0107, 0x0007, 0x0107, 0x0207, 0x0307, 0x0407,
+         0x0408, 0x0308, 0x0208, 0x0108, 0x0008, 0x0108, 0x0208, 0x0308, 0x0408, 0x0309, 0x0209, 0x0109, 0x0009, 0x0109, 0x0209, 0x0309,
+         0x0409, 0x030A, 0x020A, 0x010A, 0x000A, 0x010A, 0x020A, 0x030A, 0x040A, 0x030B, 0x020B, 0x010B, 0x000B, 0x010B, 0x020B, 0x030B,
+         0x040B, 0x040C, 0x030C, 0x020C, 0x010C, 0x000C, 0x010C, 0x020C, 0x030C, 0x040C, 0x030D, 0x020D, 0x010D, 0x000D, 0x010D, 0x020D,
+         0x030D, 0x040D, 0x030E, 0x020E, 0x010E, 0x000E, 0x010E, 0x020E, 0x030E, 0x040E, 0x030F, 0x020F, 0x010F, 0x000F, 0x010F, 0x020F,
+         0x030F, 0x040F, 0x0410, 0x0310, 0x0210, 0x0110, 0x0010, 0x0110, 0x0210, 0x0310, 0x0410, 0x0311, 0x0211, 0x0111, 0x0011, 0x0111,
+         0x0211, 0x0311, 0x0411, 0x0312, 0x0212, 0x0112, 0x0012, 0x0112, 0x0212, 0x0312, 0x0412, 0x0313, 0x0213, 0x0113, 0x0013, 0x0113,
+         0x0213, 0x0313, 0x0413, 0x0414, 0x0314, 0x0214, 0x0114, 0x0014, 0x0114, 0x0214, 0x0314, 0x0414, 0x0315, 0x0215, 0x0115, 0x0015,
+         0x0115, 0x0215, 0x0315, 0x0415, 0x0316, 0x0216, 0x0116, 0x0016, 0x0116, 0x0216, 0x0316, 0x0416, 0x0317, 0x0217, 0x0117, 0x0017,
+         0x0117, 0x0217, 0x0317, 0x0417, 0x0418, 0x0318, 0x0218, 0x0118, 0x0018, 0x0118, 0x0218, 0x0318, 0x0418, 0x0319, 0x0219, 0x0119,
+         0x0019, 0x0119, 0x0219, 0x0319, 0x0419, 0x031A, 0x021A, 0x011A, 0x001A, 0x011A, 0x021A, 0x031A, 0x041A, 0x031B, 0x021B, 0x011B,
+         0x001B, 0x011B, 0x021B, 0x031B, 0x041B, 0x041C, 0x031C, 0x021C, 0x011C, 0x001C, 0x011C, 0x021C, 0x031C, 0x021D, 0x011D, 0x001D,
+      },
+      // diff 0, inten_table 5, selector 2
+      {
+         0x1800, 0x1700, 0x1600, 0x1500, 0x1400, 0x1300, 0x1200, 0x1100, 0x1000, 0x0F00, 0x0E00, 0x0D00, 0x0C00, 0x0B00, 0x0A00, 0x0900,
+         0x0800, 0x0700, 0x0600, 0x0500, 0x0400, 0x0300, 0x0200, 0x0100, 0x0000, 0x0100, 0x0200, 0x0300, 0x0400, 0x0500, 0x0600, 0x0700,
+         0x0800, 0x0801, 0x0701, 0x0601, 0x0501, 0x0401, 0x0301, 0x0201, 0x0101, 0x0001, 0x0101, 0x0201, 0x0301, 0x0401, 0x0501, 0x0601,
+         0x0701, 0x0801, 0x0802, 0x0702, 0x0602, 0x0502, 0x0402, 0x0302, 0x0202, 0x0102, 0x0002, 0x0102, 0x0202, 0x0302, 0x0402, 0x0502,
+         0x0602, 0x0702, 0x0802, 0x0803, 0x0703, 0x0603, 0x0503, 0x0403, 0x0303, 0x0203, 0x0103, 0x0003, 0x0103, 0x0203, 0x0303, 0x0403,
+         0x0503, 0x0603, 0x0703, 0x0803, 0x0804, 0x0704, 0x0604, 0x0504, 0x0404, 0x0304, 0x0204, 0x0104, 0x0004, 0x0104, 0x0204, 0x0304,
+         0x0404, 0x0504, 0x0604, 0x0704, 0x0804, 0x0805, 0x0705, 0x0605, 0x0505, 0x0405, 0x0305, 0x0205, 0x0105, 0x0005, 0x0105, 0x0205,
+         0x0305, 0x0405, 0x0505, 0x0605, 0x0705, 0x0805, 0x0806, 0x0706, 0x0606, 0x0506, 0x0406, 0x0306, 0x0206, 0x0106, 0x0006, 0x0106,
+         0x0206, 0x0306, 0x0406, 0x0506, 0x0606, 0x0706, 0x0806, 0x0807, 0x0707, 0x0607, 0x0507, 0x0407, 0x0307, 0x0207, 0x0107, 0x0007,
+         0x0107, 0x0207, 0x0307, 0x0407, 0x0507, 0x0607, 0x0707, 0x0807, 0x0808, 0x0708, 0x0608, 0x0508, 0x0408, 0x0308, 0x0208, 0x0108,
+         0x0008, 0x0108, 0x0208, 0x0308, 0x0408, 0x0508, 0x0608, 0x0708, 0x0808, 0x0809, 0x0709, 0x0609, 0x0509, 0x0409, 0x0309, 0x0209,
+         0x0109, 0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709, 0x0809, 0x080A, 0x070A, 0x060A, 0x050A, 0x040A, 0x030A,
+         0x020A, 0x010A, 0x000A, 0x010A, 0x020A, 0x030A, 0x040A, 0x050A, 0x060A, 0x070A, 0x080A, 0x080B, 0x070B, 0x060B, 0x050B, 0x040B,
+         0x030B, 0x020B, 0x010B, 0x000B, 0x010B, 0x020B, 0x030B, 0x040B, 0x050B, 0x060B, 0x070B, 0x080B, 0x080C, 0x070C, 0x060C, 0x050C,
+         0x040C, 0x030C, 0x020C, 0x010C, 0x000C, 0x010C, 0x020C, 0x030C, 0x040C, 0x050C, 0x060C, 0x070C, 0x080C, 0x080D, 0x070D, 0x060D,
+         0x050D, 0x040D, 0x030D, 0x020D, 0x010D, 0x000D, 0x010D, 0x020D, 0x030D, 0x040D, 0x050D, 0x040E, 0x030E, 0x020E, 0x010E, 0x000E,
+      },
+      // diff 1, inten_table 5, selector 2
+      {
+         0x1800, 0x1700, 0x1600, 0x1500, 0x1400, 0x1300, 0x1200, 0x1100, 0x1000, 0x0F00, 0x0E00, 0x0D00, 0x0C00, 0x0B00, 0x0A00, 0x0900,
+         0x0800, 0x0700, 0x0600, 0x0500, 0x0400, 0x0300, 0x0200, 0x0100, 0x0000, 0x0100, 0x0200, 0x0300, 0x0400, 0x0301, 0x0201, 0x0101,
+         0x0001, 0x0101, 0x0201, 0x0301, 0x0401, 0x0302, 0x0202, 0x0102, 0x0002, 0x0102, 0x0202, 0x0302, 0x0402, 0x0303, 0x0203, 0x0103,
+         0x0003, 0x0103, 0x0203, 0x0303, 0x0403, 0x0404, 0x0304, 0x0204, 0x0104, 0x0004, 0x0104, 0x0204, 0x0304, 0x0404, 0x0305, 0x0205,
+         0x0105, 0x0005, 0x0105, 0x0205, 0x0305, 0x0405, 0x0306, 0x0206, 0x0106, 0x0006, 0x0106, 0x0206, 0x0306, 0x0406, 0x0307, 0x0207,
+         0x0107, 0x0007, 0x0107, 0x0207, 0x0307, 0x0407, 0x0408, 0x0308, 0x0208, 0x0108, 0x0008, 0x0108, 0x0208, 0x0308, 0x0408, 0x0309,
+         0x0209, 0x0109, 0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x030A, 0x020A, 0x010A, 0x000A, 0x010A, 0x020A, 0x030A, 0x040A, 0x030B,
+         0x020B, 0x010B, 0x000B, 0x010B, 0x020B, 0x030B, 0x040B, 0x040C, 0x030C, 0x020C, 0x010C, 0x000C, 0x010C, 0x020C, 0x030C, 0x040C,
+         0x030D, 0x020D, 0x010D, 0x000D, 0x010D, 0x020D, 0x030D, 0x040D, 0x030E, 0x020E, 0x010E, 0x000E, 0x010E, 0x020E, 0x030E, 0x040E,
+         0x030F, 0x020F, 0x010F, 0x000F, 0x010F, 0x020F, 0x030F, 0x040F, 0x0410, 0x0310, 0x0210, 0x0110, 0x0010, 0x0110, 0x0210, 0x0310,
+         0x0410, 0x0311, 0x0211, 0x0111, 0x0011, 0x0111, 0x0211, 0x0311, 0x0411, 0x0312, 0x0212, 0x0112, 0x0012, 0x0112, 0x0212, 0x0312,
+         0x0412, 0x0313, 0x0213, 0x0113, 0x0013, 0x0113, 0x0213, 0x0313, 0x0413, 0x0414, 0x0314, 0x0214, 0x0114, 0x0014, 0x0114, 0x0214,
+         0x0314, 0x0414, 0x0315, 0x0215, 0x0115, 0x0015, 0x0115, 0x0215, 0x0315, 0x0415, 0x0316, 0x0216, 0x0116, 0x0016, 0x0116, 0x0216,
+         0x0316, 0x0416, 0x0317, 0x0217, 0x0117, 0x0017, 0x0117, 0x0217, 0x0317, 0x0417, 0x0418, 0x0318, 0x0218, 0x0118, 0x0018, 0x0118,
+         0x0218, 0x0318, 0x0418, 0x0319, 0x0219, 0x0119, 0x0019, 0x0119, 0x0219, 0x0319, 0x0419, 0x031A, 0x021A, 0x011A, 0x001A, 0x011A,
+         0x021A, 0x031A, 0x041A, 0x031B, 0x021B, 0x011B, 0x001B, 0x011B, 0x021B, 0x031B, 0x041B, 0x041C, 0x031C, 0x021C, 0x011C, 0x001C,
+      },
+      // diff 0, inten_table 6, selector 2
+      {
+         0x2100, 0x2000, 0x1F00, 0x1E00, 0x1D00, 0x1C00, 0x1B00, 0x1A00, 0x1900, 0x1800, 0x1700, 0x1600, 0x1500, 0x1400, 0x1300, 0x1200,
+         0x1100, 0x1000, 0x0F00, 0x0E00, 0x0D00, 0x0C00, 0x0B00, 0x0A00, 0x0900, 0x0800, 0x0700, 0x0600, 0x0500, 0x0400, 0x0300, 0x0200,
+         0x0100, 0x0000, 0x0100, 0x0200, 0x0300, 0x0400, 0x0500, 0x0600, 0x0700, 0x0800, 0x0801, 0x0701, 0x0601, 0x0501, 0x0401, 0x0301,
+         0x0201, 0x0101, 0x0001, 0x0101, 0x0201, 0x0301, 0x0401, 0x0501, 0x0601, 0x0701, 0x0801, 0x0802, 0x0702, 0x0602, 0x0502, 0x0402,
+         0x0302, 0x0202, 0x0102, 0x0002, 0x0102, 0x0202, 0x0302, 0x0402, 0x0502, 0x0602, 0x0702, 0x0802, 0x0803, 0x0703, 0x0603, 0x0503,
+         0x0403, 0x0303, 0x0203, 0x0103, 0x0003, 0x0103, 0x0203, 0x0303, 0x0403, 0x0503, 0x0603, 0x0703, 0x0803, 0x0804, 0x0704, 0x0604,
+         0x0504, 0x0404, 0x0304, 0x0204, 0x0104, 0x0004, 0x0104, 0x0204, 0x0304, 0x0404, 0x0504, 0x0604, 0x0704, 0x0804, 0x0805, 0x0705,
+         0x0605, 0x0505, 0x0405, 0x0305, 0x0205, 0x0105, 0x0005, 0x0105, 0x0205, 0x0305, 0x0405, 0x0505, 0x0605, 0x0705, 0x0805, 0x0806,
+         0x0706, 0x0606, 0x0506, 0x0406, 0x0306, 0x0206, 0x0106, 0x0006, 0x0106, 0x0206, 0x0306, 0x0406, 0x0506, 0x0606, 0x0706, 0x0806,
+         0x0807, 0x0707, 0x0607, 0x0507, 0x0407, 0x0307, 0x0207, 0x0107, 0x0007, 0x0107, 0x0207, 0x0307, 0x0407, 0x0507, 0x0607, 0x0707,
+         0x0807, 0x0808, 0x0708, 0x0608, 0x0508, 0x0408, 0x0308, 0x0208, 0x0108, 0x0008, 0x0108, 0x0208, 0x0308, 0x0408, 0x0508, 0x0608,
+         0x0708, 0x0808, 0x0809, 0x0709, 0x0609, 0x0509, 0x0409, 0x0309, 0x0209, 0x0109, 0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509,
+         0x0609, 0x0709, 0x0809, 0x080A, 0x070A, 0x060A, 0x050A, 0x040A, 0x030A, 0x020A, 0x010A, 0x000A, 0x010A, 0x020A, 0x030A, 0x040A,
+         0x050A, 0x060A, 0x070A, 0x080A, 0x080B, 0x070B, 0x060B, 0x050B, 0x040B, 0x030B, 0x020B, 0x010B, 0x000B, 0x010B, 0x020B, 0x030B,
+         0x040B, 0x050B, 0x060B, 0x070B, 0x080B, 0x080C, 0x070C, 0x060C, 0x050C, 0x040C, 0x030C, 0x020C, 0x010C, 0x000C, 0x010C, 0x020C,
+         0x030C, 0x040C, 0x050C, 0x060C, 0x070C, 0x080C, 0x080D, 0x070D, 0x060D, 0x050D, 0x040D, 0x030D, 0x020D, 0x010D, 0x000D, 0x000E,
+      },
+      // diff 1, inten_table 6, selector 2
+      {
+         0x2100, 0x2000, 0x1F00, 0x1E00, 0x1D00, 0x1C00, 0x1B00, 0x1A00, 0x1900, 0x1800, 0x1700, 0x1600, 0x1500, 0x1400, 0x1300, 0x1200,
+         0x1100, 0x1000, 0x0F00, 0x0E00, 0x0D00, 0x0C00, 0x0B00, 0x0A00, 0x0900, 0x0800, 0x0700, 0x0600, 0x0500, 0x0400, 0x0300, 0x0200,
+         0x0100, 0x0000, 0x0100, 0x0200, 0x0300, 0x0400, 0x0301, 0x0201, 0x0101, 0x0001, 0x0101, 0x0201, 0x0301, 0x0401, 0x0302, 0x0202,
+         0x0102, 0x0002, 0x0102, 0x0202, 0x0302, 0x0402, 0x0303, 0x0203, 0x0103, 0x0003, 0x0103, 0x0203, 0x0303, 0x0403, 0x0404, 0x0304,
+         0x0204, 0x0104, 0x0004, 0x0104, 0x0204, 0x0304, 0x0404, 0x0305, 0x0205, 0x0105, 0x0005, 0x0105, 0x0205, 0x0305, 0x0405, 0x0306,
+         0x0206, 0x0106, 0x0006, 0x0106, 0x0206, 0x0306, 0x0406, 0x0307, 0x0207, 0x0107, 0x0007, 0x0107, 0x0207, 0x0307, 0x0407, 0x0408,
+         0x0308, 0x0208, 0x0108, 0x0008, 0x0108, 0x0208, 0x0308, 0x0408, 0x0309, 0x0209, 0x0109, 0x0009, 0x0109, 0x0209, 0x0309, 0x0409,
+         0x030A, 0x020A, 0x010A, 0x000A, 0x010A, 0x020A, 0x030A, 0x040A, 0x030B, 0x020B, 0x010B, 0x000B, 0x010B, 0x020B, 0x030B, 0x040B,
+         0x040C, 0x030C, 0x020C, 0x010C, 0x000C, 0x010C, 0x020C, 0x030C, 0x040C, 0x030D, 0x020D, 0x010D, 0x000D, 0x010D, 0x020D, 0x030D,
+         0x040D, 0x030E, 0x020E, 0x010E, 0x000E, 0x010E, 0x020E, 0x030E, 0x040E, 0x030F, 0x020F, 0x010F, 0x000F, 0x010F, 0x020F, 0x030F,
+         0x040F, 0x0410, 0x0310, 0x0210, 0x0110, 0x0010, 0x0110, 0x0210, 0x0310, 0x0410, 0x0311, 0x0211, 0x0111, 0x0011, 0x0111, 0x0211,
+         0x0311, 0x0411, 0x0312, 0x0212, 0x0112, 0x0012, 0x0112, 0x0212, 0x0312, 0x0412, 0x0313, 0x0213, 0x0113, 0x0013, 0x0113, 0x0213,
+         0x0313, 0x0413, 0x0414, 0x0314, 0x0214, 0x0114, 0x0014, 0x0114, 0x0214, 0x0314, 0x0414, 0x0315, 0x0215, 0x0115, 0x0015, 0x0115,
+         0x0215, 0x0315, 0x0415, 0x0316, 0x0216, 0x0116, 0x0016, 0x0116, 0x0216, 0x0316, 0x0416, 0x0317, 0x0217, 0x0117, 0x0017, 0x0117,
+         0x0217, 0x0317, 0x0417, 0x0418, 0x0318, 0x0218, 0x0118, 0x0018, 0x0118, 0x0218, 0x0318, 0x0418, 0x0319, 0x0219, 0x0119, 0x0019,
+         0x0119, 0x0219, 0x0319, 0x0419, 0x031A, 0x021A, 0x011A, 0x001A, 0x011A, 0x021A, 0x031A, 0x041A, 0x031B, 0x021B, 0x011B, 0x001B,
+      },
+      // diff 0, inten_table 7, selector 2
+      {
+         0x2F00, 0x2E00, 0x2D00, 0x2C00, 0x2B00, 0x2A00, 0x2900, 0x2800, 0x2700, 0x2600, 0x2500, 0x2400, 0x2300, 0x2200, 0x2100, 0x2000,
+         0x1F00, 0x1E00, 0x1D00, 0x1C00, 0x1B00, 0x1A00, 0x1900, 0x1800, 0x1700, 0x1600, 0x1500, 0x1400, 0x1300, 0x1200, 0x1100, 0x1000,
+         0x0F00, 0x0E00, 0x0D00, 0x0C00, 0x0B00, 0x0A00, 0x0900, 0x0800, 0x0700, 0x0600, 0x0500, 0x0400, 0x0300, 0x0200, 0x0100, 0x0000,
+         0x0100, 0x0200, 0x0300, 0x0400, 0x0500, 0x0600, 0x0700, 0x0800, 0x0801, 0x0701, 0x0601, 0x0501, 0x0401, 0x0301, 0x0201, 0x0101,
+         0x0001, 0x0101, 0x0201, 0x0301, 0x0401, 0x0501, 0x0601, 0x0701, 0x0801, 0x0802, 0x0702, 0x0602, 0x0502, 0x0402, 0x0302, 0x0202,
+         0x0102, 0x0002, 0x0102, 0x0202, 0x0302, 0x0402, 0x0502, 0x0602, 0x0702, 0x0802, 0x0803, 0x0703, 0x0603, 0x0503, 0x0403, 0x0303,
+         0x0203, 0x0103, 0x0003, 0x0103, 0x0203, 0x0303, 0x0403, 0x0503, 0x0603, 0x0703, 0x0803, 0x0804, 0x0704, 0x0604, 0x0504, 0x0404,
+         0x0304, 0x0204, 0x0104, 0x0004, 0x0104, 0x0204, 0x0304, 0x0404, 0x0504, 0x0604, 0x0704, 0x0804, 0x0805, 0x0705, 0x0605, 0x0505,
+         0x0405, 0x0305, 0x0205, 0x0105, 0x0005, 0x0105, 0x0205, 0x0305, 0x0405, 0x0505, 0x0605, 0x0705, 0x0805, 0x0806, 0x0706, 0x0606,
+         0x0506, 0x0406, 0x0306, 0x0206, 0x0106, 0x0006, 0x0106, 0x0206, 0x0306, 0x0406, 0x0506, 0x0606, 0x0706, 0x0806, 0x0807, 0x0707,
+         0x0607, 0x0507, 0x0407, 0x0307, 0x0207, 0x0107, 0x0007, 0x0107, 0x0207, 0x0307, 0x0407, 0x0507, 0x0607, 0x0707, 0x0807, 0x0808,
+         0x0708, 0x0608, 0x0508, 0x0408, 0x0308, 0x0208, 0x0108, 0x0008, 0x0108, 0x0208, 0x0308, 0x0408, 0x0508, 0x0608, 0x0708, 0x0808,
+         0x0809, 0x0709, 0x0609, 0x0509, 0x0409, 0x0309, 0x0209, 0x0109, 0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709,
+         0x0809, 0x080A, 0x070A, 0x060A, 0x050A, 0x040A, 0x030A, 0x020A, 0x010A, 0x000A, 0x010A, 0x020A, 0x030A, 0x040A, 0x050A, 0x060A,
+         0x070A, 0x080A, 0x080B, 0x070B, 0x060B, 0x050B, 0x040B, 0x030B, 0x020B, 0x010B, 0x000B, 0x010B, 0x020B, 0x030B, 0x040B, 0x050B,
+         0x060B, 0x070B, 0x080B, 0x080C, 0x070C, 0x060C, 0x050C, 0x040C, 0x030C, 0x020C, 0x010C, 0x000C, 0x010C, 0x020C, 0x010D, 0x000D,
+      },
+      // diff 1, inten_table 7, selector 2
+      {
+         0x2F00, 0x2E00, 0x2D00, 0x2C00, 0x2B00, 0x2A00, 0x2900, 0x2800, 0x2700, 0x2600, 0x2500, 0x2400, 0x2300, 0x2200, 0x2100, 0x2000,
+         0x1F00, 0x1E00, 0x1D00, 0x1C00, 0x1B00, 0x1A00, 0x1900, 0x1800, 0x1700, 0x1600, 0x1500, 0x1400, 0x1300, 0x1200, 0x1100, 0x1000,
+         0x0F00, 0x0E00, 0x0D00, 0x0C00, 0x0B00, 0x0A00, 0x0900, 0x0800, 0x0700, 0x0600, 0x0500, 0x0400, 0x0300, 0x0200, 0x0100, 0x0000,
+         0x0100, 0x0200, 0x0300, 0x0400, 0x0301, 0x0201, 0x0101, 0x0001, 0x0101, 0x0201, 0x0301, 0x0401, 0x0302, 0x0202, 0x0102, 0x0002,
+         0x0102, 0x0202, 0x0302, 0x0402, 0x0303, 0x0203, 0x0103, 0x0003, 0x0103, 0x0203, 0x0303, 0x0403, 0x0404, 0x0304, 0x0204, 0x0104,
+         0x0004, 0x0104, 0x0204, 0x0304, 0x0404, 0x0305, 0x0205, 0x0105, 0x0005, 0x0105, 0x0205, 0x0305, 0x0405, 0x0306, 0x0206, 0x0106,
+         0x0006, 0x0106, 0x0206, 0x0306, 0x0406, 0x0307, 0x0207, 0x0107, 0x0007, 0x0107, 0x0207, 0x0307, 0x0407, 0x0408, 0x0308, 0x0208,
+         0x0108, 0x0008, 0x0108, 0x0208, 0x0308, 0x0408, 0x0309, 0x0209, 0x0109, 0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x030A, 0x020A,
+         0x010A, 0x000A, 0x010A, 0x020A, 0x030A, 0x040A, 0x030B, 0x020B, 0x010B, 0x000B, 0x010B, 0x020B, 0x030B, 0x040B, 0x040C, 0x030C,
+         0x020C, 0x010C, 0x000C, 0x010C, 0x020C, 0x030C, 0x040C, 0x030D, 0x020D, 0x010D, 0x000D, 0x010D, 0x020D, 0x030D, 0x040D, 0x030E,
+         0x020E, 0x010E, 0x000E, 0x010E, 0x020E, 0x030E, 0x040E, 0x030F, 0x020F, 0x010F, 0x000F, 0x010F, 0x020F, 0x030F, 0x040F, 0x0410,
+         0x0310, 0x0210, 0x0110, 0x0010, 0x0110, 0x0210, 0x0310, 0x0410, 0x0311, 0x0211, 0x0111, 0x0011, 0x0111, 0x0211, 0x0311, 0x0411,
+         0x0312, 0x0212, 0x0112, 0x0012, 0x0112, 0x0212, 0x0312, 0x0412, 0x0313, 0x0213, 0x0113, 0x0013, 0x0113, 0x0213, 0x0313, 0x0413,
+         0x0414, 0x0314, 0x0214, 0x0114, 0x0014, 0x0114, 0x0214, 0x0314, 0x0414, 0x0315, 0x0215, 0x0115, 0x0015, 0x0115, 0x0215, 0x0315,
+         0x0415, 0x0316, 0x0216, 0x0116, 0x0016, 0x0116, 0x0216, 0x0316, 0x0416, 0x0317, 0x0217, 0x0117, 0x0017, 0x0117, 0x0217, 0x0317,
+         0x0417, 0x0418, 0x0318, 0x0218, 0x0118, 0x0018, 0x0118, 0x0218, 0x0318, 0x0418, 0x0319, 0x0219, 0x0119, 0x0019, 0x0119, 0x001A,
+      },
+      // diff 0, inten_table 0, selector 3
+      {
+         0x0800, 0x0700, 0x0600, 0x0500, 0x0400, 0x0300, 0x0200, 0x0100, 0x0000, 0x0100, 0x0200, 0x0300, 0x0400, 0x0500, 0x0600, 0x0700,
+         0x0800, 0x0801, 0x0701, 0x0601, 0x0501, 0x0401, 0x0301, 0x0201, 0x0101, 0x0001, 0x0101, 0x0201, 0x0301, 0x0401, 0x0501, 0x0601,
+         0x0701, 0x0801, 0x0802, 0x0702, 0x0602, 0x0502, 0x0402, 0x0302, 0x0202, 0x0102, 0x0002, 0x0102, 0x0202, 0x0302, 0x0402, 0x0502,
+         0x0602, 0x0702, 0x0802, 0x0803, 0x0703, 0x0603, 0x0503, 0x0403, 0x0303, 0x0203, 0x0103, 0x0003, 0x0103, 0x0203, 0x0303, 0x0403,
+         0x0503, 0x0603, 0x0703, 0x0803, 0x0804, 0x0704, 0x0604, 0x0504, 0x0404, 0x0304, 0x0204, 0x0104, 0x0004, 0x0104, 0x0204, 0x0304,
+         0x0404, 0x0504, 0x0604, 0x0704, 0x0804, 0x0805, 0x0705, 0x0605, 0x0505, 0x0405, 0x0305, 0x0205, 0x0105, 0x0005, 0x0105, 0x0205,
+         0x0305, 0x0405, 0x0505, 0x0605, 0x0705, 0x0805, 0x0806, 0x0706, 0x0606, 0x0506, 0x0406, 0x0306, 0x0206, 0x0106, 0x0006, 0x0106,
+         0x0206, 0x0306, 0x0406, 0x0506, 0x0606, 0x0706, 0x0806, 0x0807, 0x0707, 0x0607, 0x0507, 0x0407, 0x0307, 0x0207, 0x0107, 0x0007,
+         0x0107, 0x0207, 0x0307, 0x0407, 0x0507, 0x0607, 0x0707, 0x0807, 0x0808, 0x0708, 0x0608, 0x0508, 0x0408, 0x0308, 0x0208, 0x0108,
+         0x0008, 0x0108, 0x0208, 0x0308, 0x0408, 0x0508, 0x0608, 0x0708, 0x0808, 0x0809, 0x0709, 0x0609, 0x0509, 0x0409, 0x0309, 0x0209,
+         0x0109, 0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709, 0x0809, 0x080A, 0x070A, 0x060A, 0x050A, 0x040A, 0x030A,
+         0x020A, 0x010A, 0x000A, 0x010A, 0x020A, 0x030A, 0x040A, 0x050A, 0x060A, 0x070A, 0x080A, 0x080B, 0x070B, 0x060B, 0x050B, 0x040B,
+         0x030B, 0x020B, 0x010B, 0x000B, 0x010B, 0x020B, 0x030B, 0x040B, 0x050B, 0x060B, 0x070B, 0x080B, 0x080C, 0x070C, 0x060C, 0x050C,
+         0x040C, 0x030C, 0x020C, 0x010C, 0x000C, 0x010C, 0x020C, 0x030C, 0x040C, 0x050C, 0x060C, 0x070C, 0x080C, 0x080D, 0x070D, 0x060D,
+         0x050D, 0x040D, 0x030D, 0x020D, 0x010D, 0x000D, 0x010D, 0x020D, 0x030D, 0x040D, 0x050D, 0x060D, 0x070D, 0x080D, 0x080E, 0x070E,
+         0x060E, 0x050E, 0x040E, 0x030E, 0x020E, 0x010E, 0x000E, 0x010E, 0x020E, 0x030E, 0x040E, 0x040F, 0x030F, 0x020F, 0x010F, 0x000F,
+      },
+      // diff 1, inten_table 0, selector 3
+      {
+         0x0800, 0x0700, 0x0600, 0x0500, 0x0400, 0x0300, 0x0200, 0x0100, 0x0000, 0x0100, 0x0200, 0x0300, 0x0400, 0x0301, 0x0201, 0x0101,
+         0x0001, 0x0101, 0x0201, 0x0301, 0x0401, 0x0302, 0x0202, 0x0102, 0x0002, 0x0102, 0x0202, 0x0302, 0x0402, 0x0303, 0x0203, 0x0103,
+         0x0003, 0x0103, 0x0203, 0x0303, 0x0403, 0x0404, 0x0304, 0x0204, 0x0104, 0x0004, 0x0104, 0x0204, 0x0304, 0x0404, 0x0305, 0x0205,
+         0x0105, 0x0005, 0x0105, 0x0205, 0x0305, 0x0405, 0x0306, 0x0206, 0x0106, 0x0006, 0x0106, 0x0206, 0x0306, 0x0406, 0x0307, 0x0207,
+         0x0107, 0x0007, 0x0107, 0x0207, 0x0307, 0x0407, 0x0408, 0x0308, 0x0208, 0x0108, 0x0008, 0x0108, 0x0208, 0x0308, 0x0408, 0x0309,
+         0x0209, 0x0109, 0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x030A, 0x020A, 0x010A, 0x000A, 0x010A, 0x020A, 0x030A, 0x040A, 0x030B,
+         0x020B, 0x010B, 0x000B, 0x010B, 0x020B, 0x030B, 0x040B, 0x040C, 0x030C, 0x020C, 0x010C, 0x000C, 0x010C, 0x020C, 0x030C, 0x040C,
+         0x030D, 0x020D, 0x010D, 0x000D, 0x010D, 0x020D, 0x030D, 0x040D, 0x030E, 0x020E, 0x010E, 0x000E, 0x010E, 0x020E, 0x030E, 0x040E,
+         0x030F, 0x020F, 0x010F, 0x000F, 0x010F, 0x020F, 0x030F, 0x040F, 0x0410, 0x0310, 0x0210, 0x0110, 0x0010, 0x0110, 0x0210, 0x0310,
+         0x0410, 0x0311, 0x0211, 0x0111, 0x0011, 0x0111, 0x0211, 0x0311, 0x0411, 0x0312, 0x0212, 0x0112, 0x0012, 0x0112, 0x0212, 0x0312,
+         0x0412, 0x0313, 0x0213, 0x0113, 0x0013, 0x0113, 0x0213, 0x0313, 0x0413, 0x0414, 0x0314, 0x0214, 0x0114, 0x0014, 0x0114, 0x0214,
+         0x0314, 0x0414, 0x0315, 0x0215, 0x0115, 0x0015, 0x0115, 0x0215, 0x0315, 0x0415, 0x0316, 0x0216, 0x0116, 0x0016, 0x0116, 0x0216,
+         0x0316, 0x0416, 0x0317, 0x0217, 0x0117, 0x0017, 0x0117, 0x0217, 0x0317, 0x0417, 0x0418, 0x0318, 0x0218, 0x0118, 0x0018, 0x0118,
+         0x0218, 0x0318, 0x0418, 0x0319, 0x0219, 0x0119, 0x0019, 0x0119, 0x0219, 0x0319, 0x0419, 0x031A, 0x021A, 0x011A, 0x001A, 0x011A,
+         0x021A, 0x031A, 0x041A, 0x031B, 0x021B, 0x011B, 0x001B, 0x011B, 0x021B, 0x031B, 0x041B, 0x041C, 0x031C, 0x021C, 0x011C, 0x001C,
+         0x011C, 0x021C, 0x031C, 0x041C, 0x031D, 0x021D, 0x011D, 0x001D, 0x011D, 0x021D, 0x031D, 0x041D, 0x031E, 0x021E, 0x011E, 0x001E,
+      },
+      // diff 0, inten_table 1, selector 3
+      {
+         0x1100, 0x1000, 0x0F00, 0x0E00, 0x0D00, 0x0C00, 0x0B00, 0x0A00, 0x0900, 0x0800, 0x0700, 0x0600, 0x0500, 0x0400, 0x0300, 0x0200,
+         0x0100, 0x0000, 0x0100, 0x0200, 0x0300, 0x0400, 0x0500, 0x0600, 0x0700, 0x0800, 0x0801, 0x0701, 0x0601, 0x0501, 0x0401, 0x0301,
+         0x0201, 0x0101, 0x0001, 0x0101, 0x0201, 0x0301, 0x0401, 0x0501, 0x0601, 0x0701, 0x0801, 0x0802, 0x0702, 0x0602, 0x0502, 0x0402,
+         0x0302, 0x0202, 0x0102, 0x0002, 0x0102, 0x0202, 0x0302, 0x0402, 0x0502, 0x0602, 0x0702, 0x0802, 0x0803, 0x0703, 0x0603, 0x0503,
+         0x0403, 0x0303, 0x0203, 0x0103, 0x0003, 0x0103, 0x0203, 0x0303, 0x0403, 0x0503, 0x0603, 0x0703, 0x0803, 0x0804, 0x0704, 0x0604,
+         0x0504, 0x0404, 0x0304, 0x0204, 0x0104, 0x0004, 0x0104, 0x0204, 0x0304, 0x0404, 0x0504, 0x0604, 0x0704, 0x0804, 0x0805, 0x0705,
+         0x0605, 0x0505, 0x0405, 0x0305, 0x0205, 0x0105, 0x0005, 0x0105, 0x0205, 0x0305, 0x0405, 0x0505, 0x0605, 0x0705, 0x0805, 0x0806,
+         0x0706, 0x0606, 0x0506, 0x0406, 0x0306, 0x0206, 0x0106, 0x0006, 0x0106, 0x0206, 0x0306, 0x0406, 0x0506, 0x0606, 0x0706, 0x0806,
+         0x0807, 0x0707, 0x0607, 0x0507, 0x0407, 0x0307, 0x0207, 0x0107, 0x0007, 0x0107, 0x0207, 0x0307, 0x0407, 0x0507, 0x0607, 0x0707,
+         0x0807, 0x0808, 0x0708, 0x0608, 0x0508, 0x0408, 0x0308, 0x0208, 0x0108, 0x0008, 0x0108, 0x0208, 0x0308, 0x0408, 0x0508, 0x0608,
+         0x0708, 0x0808, 0x0809, 0x0709, 0x0609, 0x0509, 0x0409, 0x0309, 0x0209, 0x0109, 0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509,
+         0x0609, 0x0709, 0x0809, 0x080A, 0x070A, 0x060A, 0x050A, 0x040A, 0x030A, 0x020A, 0x010A, 0x000A, 0x010A, 0x020A, 0x030A, 0x040A,
+         0x050A, 0x060A, 0x070A, 0x080A, 0x080B, 0x070B, 0x060B, 0x050B, 0x040B, 0x030B, 0x020B, 0x010B, 0x000B, 0x010B, 0x020B, 0x030B,
+         0x040B, 0x050B, 0x060B, 0x070B, 0x080B, 0x080C, 0x070C, 0x060C, 0x050C, 0x040C, 0x030C, 0x020C, 0x010C, 0x000C, 0x010C, 0x020C,
+         0x030C, 0x040C, 0x050C, 0x060C, 0x070C, 0x080C, 0x080D, 0x070D, 0x060D, 0x050D, 0x040D, 0x030D, 0x020D, 0x010D, 0x000D, 0x010D,
+         0x020D, 0x030D, 0x040D, 0x050D, 0x060D, 0x070D, 0x080D, 0x080E, 0x070E, 0x060E, 0x050E, 0x040E, 0x030E, 0x020E, 0x010E, 0x000E,
+      },
+      // diff 1, inten_table 1, selector 3
+      {
+         0x1100, 0x1000, 0x0F00, 0x0E00, 0x0D00, 0x0C00, 0x0B00, 0x0A00, 0x0900, 0x0800, 0x0700, 0x0600, 0x0500, 0x0400, 0x0300, 0x0200,
+         0x0100, 0x0000, 0x0100, 0x0200, 0x0300, 0x0400, 0x0301, 0x0201, 0x0101, 0x0001, 0x0101, 0x0201, 0x0301, 0x0401, 0x0302, 0x0202,
+         0x0102, 0x0002, 0x0102, 0x0202, 0x0302, 0x0402, 0x0303, 0x0203, 0x0103, 0x0003, 0x0103, 0x0203, 0x0303, 0x0403, 0x0404, 0x0304,
+         0x0204, 0x0104, 0x0004, 0x0104, 0x0204, 0x0304, 0x0404, 0x0305, 0x0205, 0x0105, 0x0005, 0x0105, 0x0205, 0x0305, 0x0405, 0x0306,
+         0x0206, 0x0106, 0x0006, 0x0106, 0x0206, 0x0306, 0x0406, 0x0307, 0x0207, 0x0107, 0x0007, 0x0107, 0x0207, 0x0307, 0x0407, 0x0408,
+         0x0308, 0x0208, 0x0108, 0x0008, 0x0108, 0x0208, 0x0308, 0x0408, 0x0309, 0x0209, 0x0109, 0x0009, 0x0109, 0x0209, 0x0309, 0x0409,
+         0x030A, 0x020A, 0x010A, 0x000A, 0x010A, 0x020A, 0x030A, 0x040A, 0x030B, 0x020B, 0x010B, 0x000B, 0x010B, 0x020B, 0x030B, 0x040B,
+         0x040C, 0x030C, 0x020C, 0x010C, 0x000C, 0x010C, 0x020C, 0x030C, 0x040C, 0x030D, 0x020D, 0x010D, 0x000D, 0x010D, 0x020D, 0x030D,
+         0x040D, 0x030E, 0x020E, 0x010E, 0x000E, 0x010E, 0x020E, 0x030E, 0x040E, 0x030F, 0x020F, 0x010F, 0x000F, 0x010F, 0x020F, 0x030F,
+         0x040F, 0x0410, 0x0310, 0x0210, 0x0110, 0x0010, 0x0110, 0x0210, 0x0310, 0x0410, 0x0311, 0x0211, 0x0111, 0x0011, 0x0111, 0x0211,
+         0x0311, 0x0411, 0x0312, 0x0212, 0x0112, 0x0012, 0x0112, 0x0212, 0x0312, 0x0412, 0x0313, 0x0213, 0x0113, 0x0013, 0x0113, 0x0213,
+         0x0313, 0x0413, 0x0414, 0x0314, 0x0214, 0x0114, 0x0014, 0x0114, 0x0214, 0x0314, 0x0414, 0x0315, 0x0215, 0x0115, 0x0015, 0x0115,
+         0x0215, 0x0315, 0x0415, 0x0316, 0x0216, 0x0116, 0x0016, 0x0116, 0x0216, 0x0316, 0x0416, 0x0317, 0x0217, 0x0117, 0x0017, 0x0117,
+         0x0217, 0x0317, 0x0417, 0x0418, 0x0318, 0x0218, 0x0118, 0x0018, 0x0118, 0x0218, 0x0318, 0x0418, 0x0319, 0x0219, 0x0119, 0x0019,
+         0x0119, 0x0219, 0x0319, 0x0419, 0x031A, 0x021A, 0x011A, 0x001A, 0x011A, 0x021A, 0x031A, 0x041A, 0x031B, 0x021B, 0x011B, 0x001B,
+         0x011B, 0x021B, 0x031B, 0x041B, 0x041C, 0x031C, 0x021C, 0x011C, 0x001C, 0x011C, 0x021C, 0x031C, 0x031D, 0x021D, 0x011D, 0x001D,
+      },
+      // diff 0, inten_table 2, selector 3
+      {
+         0x1D00, 0x1C00, 0x1B00, 0x1A00, 0x1900, 0x1800, 0x1700, 0x1600, 0x1500, 0x1400, 0x1300, 0x1200, 0x1100, 0x1000, 0x0F00, 0x0E00,
+         0x0D00, 0x0C00, 0x0B00, 0x0A00, 0x0900, 0x0800, 0x0700, 0x0600, 0x0500, 0x0400, 0x0300, 0x0200, 0x0100, 0x0000, 0x0100, 0x0200,
+         0x0300, 0x0400, 0x0500, 0x0600, 0x0700, 0x0800, 0x0801, 0x0701, 0x0601, 0x0501, 0x0401, 0x0301, 0x0201, 0x0101, 0x0001, 0x0101,
+         0x0201, 0x0301, 0x0401, 0x0501, 0x0601, 0x0701, 0x0801, 0x0802, 0x0702, 0x0602, 0x0502, 0x0402, 0x0302, 0x0202, 0x0102, 0x0002,
+         0x0102, 0x0202, 0x0302, 0x0402, 0x0502, 0x0602, 0x0702, 0x0802, 0x0803, 0x0703, 0x0603, 0x0503, 0x0403, 0x0303, 0x0203, 0x0103,
+         0x0003, 0x0103, 0x0203, 0x0303, 0x0403, 0x0503, 0x0603, 0x0703, 0x0803, 0x0804, 0x0704, 0x0604, 0x0504, 0x0404, 0x0304, 0x0204,
+         0x0104, 0x0004, 0x0104, 0x0204, 0x0304, 0x0404, 0x0504, 0x0604, 0x0704, 0x0804, 0x0805, 0x0705, 0x0605, 0x0505, 0x0405, 0x0305,
+         0x0205, 0x0105, 0x0005, 0x0105, 0x0205, 0x0305, 0x0405, 0x0505, 0x0605, 0x0705, 0x0805, 0x0806, 0x0706, 0x0606, 0x0506, 0x0406,
+         0x0306, 0x0206, 0x0106, 0x0006, 0x0106, 0x0206, 0x0306, 0x0406, 0x0506, 0x0606, 0x0706, 0x0806, 0x0807, 0x0707, 0x0607, 0x0507,
+         0x0407, 0x0307, 0x0207, 0x0107, 0x0007, 0x0107, 0x0207, 0x0307, 0x0407, 0x0507, 0x0607, 0x0707, 0x0807, 0x0808, 0x0708, 0x0608,
+         0x0508, 0x0408, 0x0308, 0x0208, 0x0108, 0x0008, 0x0108, 0x0208, 0x0308, 0x0408, 0x0508, 0x0608, 0x0708, 0x0808, 0x0809, 0x0709,
+         0x0609, 0x0509, 0x0409, 0x0309, 0x0209, 0x0109, 0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709, 0x0809, 0x080A,
+         0x070A, 0x060A, 0x050A, 0x040A, 0x030A, 0x020A, 0x010A, 0x000A, 0x010A, 0x020A, 0x030A, 0x040A, 0x050A, 0x060A, 0x070A, 0x080A,
+         0x080B, 0x070B, 0x060B, 0x050B, 0x040B, 0x030B, 0x020B, 0x010B, 0x000B, 0x010B, 0x020B, 0x030B, 0x040B, 0x050B, 0x060B, 0x070B,
+         0x080B, 0x080C, 0x070C, 0x060C, 0x050C, 0x040C, 0x030C, 0x020C, 0x010C, 0x000C, 0x010C, 0x020C, 0x030C, 0x040C, 0x050C, 0x060C,
+         0x070C, 0x080C, 0x080D, 0x070D, 0x060D, 0x050D, 0x040D, 0x030D, 0x020D, 0x010D, 0x000D, 0x010D, 0x020D, 0x020E, 0x010E, 0x000E,
+      },
+      // diff 1, inten_table 2, selector 3
+      {
+         0x1D00, 0x1C00, 0x1B00, 0x1A00, 0x1900, 0x1800, 0x1700, 0x1600, 0x1500, 0x1400, 0x1300, 0x1200, 0x1100, 0x1000, 0x0F00, 0x0E00,
+         0x0D00, 0x0C00, 0x0B00, 0x0A00, 0x0900, 0x0800, 0x0700, 0x0600, 0x0500, 0x0400, 0x0300, 0x0200, 0x0100, 0x0000, 0x0100, 0x0200,
+         0x0300, 0x0400, 0x0301, 0x0201, 0x0101, 0x0001, 0x0101, 0x0201, 0x0301, 0x0401, 0x0302, 0x0202, 0x0102, 0x0002, 0x0102, 0x0202,
+         0x0302, 0x0402, 0x0303, 0x0203, 0x0103, 0x0003, 0x0103, 0x0203, 0x0303, 0x0403, 0x0404, 0x0304, 0x0204, 0x0104, 0x0004, 0x0104,
+         0x0204, 0x0304, 0x0404, 0x0305, 0x0205, 0x0105, 0x0005, 0x0105, 0x0205, 0x0305, 0x0405, 0x0306, 0x0206, 0x0106, 0x0006, 0x0106,
+         0x0206, 0x0306, 0x0406, 0x0307, 0x0207, 0x0107, 0x0007, 0x0107, 0x0207, 0x0307, 0x0407, 0x0408, 0x0308, 0x0208, 0x0108, 0x0008,
+         0x0108, 0x0208, 0x0308, 0x0408, 0x0309, 0x0209, 0x0109, 0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x030A, 0x020A, 0x010A, 0x000A,
+         0x010A, 0x020A, 0x030A, 0x040A, 0x030B, 0x020B, 0x010B, 0x000B, 0x010B, 0x020B, 0x030B, 0x040B, 0x040C, 0x030C, 0x020C, 0x010C,
+         0x000C, 0x010C, 0x020C, 0x030C, 0x040C, 0x030D, 0x020D, 0x010D, 0x000D, 0x010D, 0x020D, 0x030D, 0x040D, 0x030E, 0x020E, 0x010E,
+         0x000E, 0x010E, 0x020E, 0x030E, 0x040E, 0x030F, 0x020F, 0x010F, 0x000F, 0x010F, 0x020F, 0x030F, 0x040F, 0x0410, 0x0310, 0x0210,
+         0x0110, 0x0010, 0x0110, 0x0210, 0x0310, 0x0410, 0x0311, 0x0211, 0x0111, 0x0011, 0x0111, 0x0211, 0x0311, 0x0411, 0x0312, 0x0212,
+         0x0112, 0x0012, 0x0112, 0x0212, 0x0312, 0x0412, 0x0313, 0x0213, 0x0113, 0x0013, 0x0113, 0x0213, 0x0313, 0x0413, 0x0414, 0x0314,
+         0x0214, 0x0114, 0x0014, 0x0114, 0x0214, 0x0314, 0x0414, 0x0315, 0x0215, 0x0115, 0x0015, 0x0115, 0x0215, 0x0315, 0x0415, 0x0316,
+         0x0216, 0x0116, 0x0016, 0x0116, 0x0216, 0x0316, 0x0416, 0x0317, 0x0217, 0x0117, 0x0017, 0x0117, 0x0217, 0x0317, 0x0417, 0x0418,
+         0x0318, 0x0218, 0x0118, 0x0018, 0x0118, 0x0218, 0x0318, 0x0418, 0x0319, 0x0219, 0x0119, 0x0019, 0x0119, 0x0219, 0x0319, 0x0419,
+         0x031A, 0x021A, 0x011A, 0x001A, 0x011A, 0x021A, 0x031A, 0x041A, 0x031B, 0x021B, 0x011B, 0x001B, 0x011B, 0x021B, 0x011C, 0x001C,
+      },
+      // diff 0, inten_table 3, selector 3
+      {
+         0x2A00, 0x2900, 0x2800, 0x2700, 0x2600, 0x2500, 0x2400, 0x2300, 0x2200, 0x2100, 0x2000, 0x1F00, 0x1E00, 0x1D00, 0x1C00, 0x1B00,
+         0x1A00, 0x1900, 0x1800, 0x1700, 0x1600, 0x1500, 0x1400, 0x1300, 0x1200, 0x1100, 0x1000, 0x0F00, 0x0E00, 0x0D00, 0x0C00, 0x0B00,
+         0x0A00, 0x0900, 0x0800, 0x0700, 0x0600, 0x0500, 0x0400, 0x0300, 0x0200, 0x0100, 0x0000, 0x0100, 0x0200, 0x0300, 0x0400, 0x0500,
+         0x0600, 0x0700, 0x0800, 0x0801, 0x0701, 0x0601, 0x0501, 0x0401, 0x0301, 0x0201, 0x0101, 0x0001, 0x0101, 0x0201, 0x0301, 0x0401,
+         0x0501, 0x0601, 0x0701, 0x0801, 0x0802, 0x0702, 0x0602, 0x0502, 0x0402, 0x0302, 0x0202, 0x0102, 0x0002, 0x0102, 0x0202, 0x0302,
+         0x0402, 0x0502, 0x0602, 0x0702, 0x0802, 0x0803, 0x0703, 0x0603, 0x0503, 0x0403, 0x0303, 0x0203, 0x0103, 0x0003, 0x0103, 0x0203,
+         0x0303, 0x0403, 0x0503, 0x0603, 0x0703, 0x0803, 0x0804, 0x0704, 0x0604, 0x0504, 0x0404, 0x0304, 0x0204, 0x0104, 0x0004, 0x0104,
+         0x0204, 0x0304, 0x0404, 0x0504, 0x0604, 0x0704, 0x0804, 0x0805, 0x0705, 0x0605, 0x0505, 0x0405, 0x0305, 0x0205, 0x0105, 0x0005,
+         0x0105, 0x0205, 0x0305, 0x0405, 0x0505, 0x0605, 0x0705, 0x0805, 0x0806, 0x0706, 0x0606, 0x0506, 0x0406, 0x0306, 0x0206, 0x0106,
+         0x0006, 0x0106, 0x0206, 0x0306, 0x0406, 0x0506, 0x0606, 0x0706, 0x0806, 0x0807, 0x0707, 0x0607, 0x0507, 0x0407, 0x0307, 0x0207,
+         0x0107, 0x0007, 0x0107, 0x0207, 0x0307, 0x0407, 0x0507, 0x0607, 0x0707, 0x0807, 0x0808, 0x0708, 0x0608, 0x0508, 0x0408, 0x0308,
+         0x0208, 0x0108, 0x0008, 0x0108, 0x0208, 0x0308, 0x0408, 0x0508, 0x0608, 0x0708, 0x0808, 0x0809, 0x0709, 0x0609, 0x0509, 0x0409,
+         0x0309, 0x0209, 0x0109, 0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709, 0x0809, 0x080A, 0x070A, 0x060A, 0x050A,
+         0x040A, 0x030A, 0x020A, 0x010A, 0x000A, 0x010A, 0x020A, 0x030A, 0x040A, 0x050A, 0x060A, 0x070A, 0x080A, 0x080B, 0x070B, 0x060B,
+         0x050B, 0x040B, 0x030B, 0x020B, 0x010B, 0x000B, 0x010B, 0x020B, 0x030B, 0x040B, 0x050B, 0x060B, 0x070B, 0x080B, 0x080C, 0x070C,
+         0x060C, 0x050C, 0x040C, 0x030C, 0x020C, 0x010C, 0x000C, 0x010C, 0x020C, 0x030C, 0x040C, 0x040D, 0x030D, 0x020D, 0x010D, 0x000D,
+      },
+      // diff 1, inten_table 3, selector 3
+      {
+         0x2A00, 0x2900, 0x2800, 0x2700, 0x2600, 0x2500, 0x2400, 0x2300, 0x2200, 0x2100, 0x2000, 0x1F00, 0x1E00, 0x1D00, 0x1C00, 0x1B00,
+         0x1A00, 0x1900, 0x1800, 0x1700, 0x1600, 0x1500, 0x1400, 0x1300, 0x1200, 0x1100, 0x1000, 0x0F00, 0x0E00, 0x0D00, 0x0C00, 0x0B00,
+         0x0A00, 0x0900, 0x0800, 0x0700, 0x0600, 0x0500, 0x0400, 0x0300, 0x0200, 0x0100, 0x0000, 0x0100, 0x0200, 0x0300, 0x0400, 0x0301,
+         0x0201, 0x0101, 0x0001, 0x0101, 0x0201, 0x0301, 0x0401, 0x0302, 0x0202, 0x0102, 0x0002, 0x0102, 0x0202, 0x0302, 0x0402, 0x0303,
+         0x0203, 0x0103, 0x0003, 0x0103, 0x0203, 0x0303, 0x0403, 0x0404, 0x0304, 0x0204, 0x0104, 0x0004, 0x0104, 0x0204, 0x0304, 0x0404,
+         0x0305, 0x0205, 0x0105, 0x0005, 0x0105, 0x0205, 0x0305, 0x0405, 0x0306, 0x0206, 0x0106, 0x0006, 0x0106, 0x0206, 0x0306, 0x0406,
+         0x0307, 0x0207, 0x0107, 0x0007, 0x0107, 0x0207, 0x0307, 0x0407, 0x0408, 0x0308, 0x0208, 0x0108, 0x0008, 0x0108, 0x0208, 0x0308,
+         0x0408, 0x0309, 0x0209, 0x0109, 0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x030A, 0x020A, 0x010A, 0x000A, 0x010A, 0x020A, 0x030A,
+         0x040A, 0x030B, 0x020B, 0x010B, 0x000B, 0x010B, 0x020B, 0x030B, 0x040B, 0x040C, 0x030C, 0x020C, 0x010C, 0x000C, 0x010C, 0x020C,
+         0x030C, 0x040C, 0x030D, 0x020D, 0x010D, 0x000D, 0x010D, 0x020D, 0x030D, 0x040D, 0x030E, 0x020E, 0x010E, 0x000E, 0x010E, 0x020E,
+         0x030E, 0x040E, 0x030F, 0x020F, 0x010F, 0x000F, 0x010F, 0x020F, 0x030F, 0x040F, 0x0410, 0x0310, 0x0210, 0x0110, 0x0010, 0x0110,
+         0x0210, 0x0310, 0x0410, 0x0311, 0x0211, 0x0111, 0x0011, 0x0111, 0x0211, 0x0311, 0x0411, 0x0312, 0x0212, 0x0112, 0x0012, 0x0112,
+         0x0212, 0x0312, 0x0412, 0x0313, 0x0213, 0x0113, 0x0013, 0x0113, 0x0213, 0x0313, 0x0413, 0x0414, 0x0314, 0x0214, 0x0114, 0x0014,
+         0x0114, 0x0214, 0x0314, 0x0414, 0x0315, 0x0215, 0x0115, 0x0015, 0x0115, 0x0215, 0x0315, 0x0415, 0x0316, 0x0216, 0x0116, 0x0016,
+         0x0116, 0x0216, 0x0316, 0x0416, 0x0317, 0x0217, 0x0117, 0x0017, 0x0117, 0x0217, 0x0317, 0x0417, 0x0418, 0x0318, 0x0218, 0x0118,
+         0x0018, 0x0118, 0x0218, 0x0318, 0x0418, 0x0319, 0x0219, 0x0119, 0x0019, 0x0119, 0x0219, 0x0319, 0x031A, 0x021A, 0x011A, 0x001A,
+      },
+      // diff 0, inten_table 4, selector 3
+      {
+         0x3C00, 0x3B00, 0x3A00, 0x3900, 0x3800, 0x3700, 0x3600, 0x3500, 0x3400, 0x3300, 0x3200, 0x3100, 0x3000, 0x2F00, 0x2E00, 0x2D00,
+         0x2C00, 0x2B00, 0x2A00, 0x2900, 0x2800, 0x2700, 0x2600, 0x2500, 0x2400, 0x2300, 0x2200, 0x2100, 0x2000, 0x1F00, 0x1E00, 0x1D00,
+         0x1C00, 0x1B00, 0x1A00, 0x1900, 0x1800, 0x1700, 0x1600, 0x1500, 0x1400, 0x1300, 0x1200, 0x1100, 0x1000, 0x0F00, 0x0E00, 0x0D00,
+         0x0C00, 0x0B00, 0x0A00, 0x0900, 0x0800, 0x0700, 0x0600, 0x0500, 0x0400, 0x0300, 0x0200, 0x0100, 0x0000, 0x0100, 0x0200, 0x0300,
+         0x0400, 0x0500, 0x0600, 0x0700, 0x0800, 0x0801, 0x0701, 0x0601, 0x0501, 0x0401, 0x0301, 0x0201, 0x0101, 0x0001, 0x0101, 0x0201,
+         0x0301, 0x0401, 0x0501, 0x0601, 0x0701, 0x0801, 0x0802, 0x0702, 0x0602, 0x0502, 0x0402, 0x0302, 0x0202, 0x0102, 0x0002, 0x0102,
+         0x0202, 0x0302, 0x0402, 0x0502, 0x0602, 0x0702, 0x0802, 0x0803, 0x0703, 0x0603, 0x0503, 0x0403, 0x0303, 0x0203, 0x0103, 0x0003,
+         0x0103, 0x0203, 0x0303, 0x0403, 0x0503, 0x0603, 0x0703, 0x0803, 0x0804, 0x0704, 0x0604, 0x0504, 0x0404, 0x0304, 0x0204, 0x0104,
+         0x0004, 0x0104, 0x0204, 0x0304, 0x0404, 0x0504, 0x0604, 0x0704, 0x0804, 0x0805, 0x0705, 0x0605, 0x0505, 0x0405, 0x0305, 0x0205,
+         0x0105, 0x0005, 0x0105, 0x0205, 0x0305, 0x0405, 0x0505, 0x0605, 0x0705, 0x0805, 0x0806, 0x0706, 0x0606, 0x0506, 0x0406, 0x0306,
+         0x0206, 0x0106, 0x0006, 0x0106, 0x0206, 0x0306, 0x0406, 0x0506, 0x0606, 0x0706, 0x0806, 0x0807, 0x0707, 0x0607, 0x0507, 0x0407,
+         0x0307, 0x0207, 0x0107, 0x0007, 0x0107, 0x0207, 0x0307, 0x0407, 0x0507, 0x0607, 0x0707, 0x0807, 0x0808, 0x0708, 0x0608, 0x0508,
+         0x0408, 0x0308, 0x0208, 0x0108, 0x0008, 0x0108, 0x0208, 0x0308, 0x0408, 0x0508, 0x0608, 0x0708, 0x0808, 0x0809, 0x0709, 0x0609,
+         0x0509, 0x0409, 0x0309, 0x0209, 0x0109, 0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609, 0x0709, 0x0809, 0x080A, 0x070A,
+         0x060A, 0x050A, 0x040A, 0x030A, 0x020A, 0x010A, 0x000A, 0x010A, 0x020A, 0x030A, 0x040A, 0x050A, 0x060A, 0x070A, 0x080A, 0x080B,
+         0x070B, 0x060B, 0x050B, 0x040B, 0x030B, 0x020B, 0x010B, 0x000B, 0x010B, 0x020B, 0x030B, 0x040B, 0x030C, 0x020C, 0x010C, 0x000C,
+      },
+      // diff 1, inten_table 4, selector 3
+      {
+         0x3C00, 0x3B00, 0x3A00, 0x3900, 0x3800, 0x3700, 0x3600, 0x3500, 0x3400, 0x3300, 0x3200, 0x3100, 0x3000, 0x2F00, 0x2E00, 0x2D00,
+         0x2C00, 0x2B00, 0x2A00, 0x2900, 0x2800, 0x2700, 0x2600, 0x2500, 0x2400, 0x2300, 0x2200, 0x2100, 0x2000, 0x1F00, 0x1E00, 0x1D00,
+         0x1C00, 0x1B00, 0x1A00, 0x1900, 0x1800, 0x1700, 0x1600, 0x1500, 0x1400, 0x1300, 0x1200, 0x1100, 0x1000, 0x0F00, 0x0E00, 0x0D00,
+         0x0C00, 0x0B00, 0x0A00, 0x0900, 0x0800, 0x0700, 0x0600, 0x0500, 0x0400, 0x0300, 0x0200, 0x0100, 0x0000, 0x0100, 0x0200, 0x0300,
+         0x0400, 0x0301, 0x0201, 0x0101, 0x0001, 0x0101, 0x0201, 0x0301, 0x0401, 0x0302, 0x0202, 0x0102, 0x0002, 0x0102, 0x0202, 0x0302,
+         0x0402, 0x0303, 0x0203, 0x0103, 0x0003, 0x0103, 0x0203, 0x0303, 0x0403, 0x0404, 0x0304, 0x0204, 0x0104, 0x0004, 0x0104, 0x0204,
+         0x0304, 0x0404, 0x0305, 0x0205, 0x0105, 0x0005, 0x0105, 0x0205, 0x0305, 0x0405, 0x0306, 0x0206, 0x0106, 0x0006, 0x0106, 0x0206,
+         0x0306, 0x0406, 0x0307, 0x0207, 0x0107, 0x0007, 0x0107, 0x0207, 0x0307, 0x0407, 0x0408, 0x0308, 0x0208, 0x0108, 0x0008, 0x0108,
+         0x0208, 0x0308, 0x0408, 0x0309, 0x0209, 0x0109, 0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x030A, 0x020A, 0x010A, 0x000A, 0x010A,
+         0x020A, 0x030A, 0x040A, 0x030B, 0x020B, 0x010B, 0x000B, 0x010B, 0x020B, 0x030B, 0x040B, 0x040C, 0x030C, 0x020C, 0x010C, 0x000C,
+         0x010C, 0x020C, 0x030C, 0x040C, 0x030D, 0x020D, 0x010D, 0x000D, 0x010D, 0x020D, 0x030D, 0x040D, 0x030E, 0x020E, 0x010E, 0x000E,
+         0x010E, 0x020E, 0x030E, 0x040E, 0x030F, 0x020F, 0x010F, 0x000F, 0x010F, 0x020F, 0x030F, 0x040F, 0x0410, 0x0310, 0x0210, 0x0110,
+         0x0010, 0x0110, 0x0210, 0x0310, 0x0410, 0x0311, 0x0211, 0x0111, 0x0011, 0x0111, 0x0211, 0x0311, 0x0411, 0x0312, 0x0212, 0x0112,
+         0x0012, 0x0112, 0x0212, 0x0312, 0x0412, 0x0313, 0x0213, 0x0113, 0x0013, 0x0113, 0x0213, 0x0313, 0x0413, 0x0414, 0x0314, 0x0214,
+         0x0114, 0x0014, 0x0114, 0x0214, 0x0314, 0x0414, 0x0315, 0x0215, 0x0115, 0x0015, 0x0115, 0x0215, 0x0315, 0x0415, 0x0316, 0x0216,
+         0x0116, 0x0016, 0x0116, 0x0216, 0x0316, 0x0416, 0x0317, 0x0217, 0x0117, 0x0017, 0x0117, 0x0217, 0x0317, 0x0218, 0x0118, 0x0018,
+      },
+      // diff 0, inten_table 5, selector 3
+      {
+         0x5000, 0x4F00, 0x4E00, 0x4D00, 0x4C00, 0x4B00, 0x4A00, 0x4900, 0x4800, 0x4700, 0x4600, 0x4500, 0x4400, 0x4300, 0x4200, 0x4100,
+         0x4000, 0x3F00, 0x3E00, 0x3D00, 0x3C00, 0x3B00, 0x3A00, 0x3900, 0x3800, 0x3700, 0x3600, 0x3500, 0x3400, 0x3300, 0x3200, 0x3100,
+         0x3000, 0x2F00, 0x2E00, 0x2D00, 0x2C00, 0x2B00, 0x2A00, 0x2900, 0x2800, 0x2700, 0x2600, 0x2500, 0x2400, 0x2300, 0x2200, 0x2100,
+         0x2000, 0x1F00, 0x1E00, 0x1D00, 0x1C00, 0x1B00, 0x1A00, 0x1900, 0x1800, 0x1700, 0x1600, 0x1500, 0x1400, 0x1300, 0x1200, 0x1100,
+         0x1000, 0x0F00, 0x0E00, 0x0D00, 0x0C00, 0x0B00, 0x0A00, 0x0900, 0x0800, 0x0700, 0x0600, 0x0500, 0x0400, 0x0300, 0x0200, 0x0100,
+         0x0000, 0x0100, 0x0200, 0x0300, 0x0400, 0x0500, 0x0600, 0x0700, 0x0800, 0x0801, 0x0701, 0x0601, 0x0501, 0x0401, 0x0301, 0x0201,
+         0x0101, 0x0001, 0x0101, 0x0201, 0x0301, 0x0401, 0x0501, 0x0601, 0x0701, 0x0801, 0x0802, 0x0702, 0x0602, 0x0502, 0x0402, 0x0302,
+         0x0202, 0x0102, 0x0002, 0x0102, 0x0202, 0x0302, 0x0402, 0x0502, 0x0602, 0x0702, 0x0802, 0x0803, 0x0703, 0x0603, 0x0503, 0x0403,
+         0x0303, 0x0203, 0x0103, 0x0003, 0x0103, 0x0203, 0x0303, 0x0403, 0x0503, 0x0603, 0x0703, 0x0803, 0x0804, 0x0704, 0x0604, 0x0504,
+         0x0404, 0x0304, 0x0204, 0x0104, 0x0004, 0x0104, 0x0204, 0x0304, 0x0404, 0x0504, 0x0604, 0x0704, 0x0804, 0x0805, 0x0705, 0x0605,
+         0x0505, 0x0405, 0x0305, 0x0205, 0x0105, 0x0005, 0x0105, 0x0205, 0x0305, 0x0405, 0x0505, 0x0605, 0x0705, 0x0805, 0x0806, 0x0706,
+         0x0606, 0x0506, 0x0406, 0x0306, 0x0206, 0x0106, 0x0006, 0x0106, 0x0206, 0x0306, 0x0406, 0x0506, 0x0606, 0x0706, 0x0806, 0x0807,
+         0x0707, 0x0607, 0x0507, 0x0407, 0x0307, 0x0207, 0x0107, 0x0007, 0x0107, 0x0207, 0x0307, 0x0407, 0x0507, 0x0607, 0x0707, 0x0807,
+         0x0808, 0x0708, 0x0608, 0x0508, 0x0408, 0x0308, 0x0208, 0x0108, 0x0008, 0x0108, 0x0208, 0x0308, 0x0408, 0x0508, 0x0608, 0x0708,
+         0x0808, 0x0809, 0x0709, 0x0609, 0x0509, 0x0409, 0x0309, 0x0209, 0x0109, 0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x0509, 0x0609,
+         0x0709, 0x0809, 0x080A, 0x070A, 0x060A, 0x050A, 0x040A, 0x030A, 0x020A, 0x010A, 0x000A, 0x010A, 0x020A, 0x020B, 0x010B, 0x000B,
+      },
+      // diff 1, inten_table 5, selector 3
+      {
+         0x5000, 0x4F00, 0x4E00, 0x4D00, 0x4C00, 0x4B00, 0x4A00, 0x4900, 0x4800, 0x4700, 0x4600, 0x4500, 0x4400, 0x4300, 0x4200, 0x4100,
+         0x4000, 0x3F00, 0x3E00, 0x3D00, 0x3C00, 0x3B00, 0x3A00, 0x3900, 0x3800, 0x3700, 0x3600, 0x3500, 0x3400, 0x3300, 0x3200, 0x3100,
+         0x3000, 0x2F00, 0x2E00, 0x2D00, 0x2C00, 0x2B00, 0x2A00, 0x2900, 0x2800, 0x2700, 0x2600, 0x2500, 0x2400, 0x2300, 0x2200, 0x2100,
+         0x2000, 0x1F00, 0x1E00, 0x1D00, 0x1C00, 0x1B00, 0x1A00, 0x1900, 0x1800, 0x1700, 0x1600, 0x1500, 0x1400, 0x1300, 0x1200, 0x1100,
+         0x1000, 0x0F00, 0x0E00, 0x0D00, 0x0C00, 0x0B00, 0x0A00, 0x0900, 0x0800, 0x0700, 0x0600, 0x0500, 0x0400, 0x0300, 0x0200, 0x0100,
+         0x0000, 0x0100, 0x0200, 0x0300, 0x0400, 0x0301, 0x0201, 0x0101, 0x0001, 0x0101, 0x0201, 0x0301, 0x0401, 0x0302, 0x0202, 0x0102,
+         0x0002, 0x0102, 0x0202, 0x0302, 0x0402, 0x0303, 0x0203, 0x0103, 0x0003, 0x0103, 0x0203, 0x0303, 0x0403, 0x0404, 0x0304, 0x0204,
+         0x0104, 0x0004, 0x0104, 0x0204, 0x0304, 0x0404, 0x0305, 0x0205, 0x0105, 0x0005, 0x0105, 0x0205, 0x0305, 0x0405, 0x0306, 0x0206,
+         0x0106, 0x0006, 0x0106, 0x0206, 0x0306, 0x0406, 0x0307, 0x0207, 0x0107, 0x0007, 0x0107, 0x0207, 0x0307, 0x0407, 0x0408, 0x0308,
+         0x0208, 0x0108, 0x0008, 0x0108, 0x0208, 0x0308, 0x0408, 0x0309, 0x0209, 0x0109, 0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x030A,
+         0x020A, 0x010A, 0x000A, 0x010A, 0x020A, 0x030A, 0x040A, 0x030B, 0x020B, 0x010B, 0x000B, 0x010B, 0x020B, 0x030B, 0x040B, 0x040C,
+         0x030C, 0x020C, 0x010C, 0x000C, 0x010C, 0x020C, 0x030C, 0x040C, 0x030D, 0x020D, 0x010D, 0x000D, 0x010D, 0x020D, 0x030D, 0x040D,
+         0x030E, 0x020E, 0x010E, 0x000E, 0x010E, 0x020E, 0x030E, 0x040E, 0x030F, 0x020F, 0x010F, 0x000F, 0x010F, 0x020F, 0x030F, 0x040F,
+         0x0410, 0x0310, 0x0210, 0x0110, 0x0010, 0x0110, 0x0210, 0x0310, 0x0410, 0x0311, 0x0211, 0x0111, 0x0011, 0x0111, 0x0211, 0x0311,
+         0x0411, 0x0312, 0x0212, 0x0112, 0x0012, 0x0112, 0x0212, 0x0312, 0x0412, 0x0313, 0x0213, 0x0113, 0x0013, 0x0113, 0x0213, 0x0313,
+         0x0413, 0x0414, 0x0314, 0x0214, 0x0114, 0x0014, 0x0114, 0x0214, 0x0314, 0x0414, 0x0315, 0x0215, 0x0115, 0x0015, 0x0115, 0x0016,
+      },
+      // diff 0, inten_table 6, selector 3
+      {
+         0x6A00, 0x6900, 0x6800, 0x6700, 0x6600, 0x6500, 0x6400, 0x6300, 0x6200, 0x6100, 0x6000, 0x5F00, 0x5E00, 0x5D00, 0x5C00, 0x5B00,
+         0x5A00, 0x5900, 0x5800, 0x5700, 0x5600, 0x5500, 0x5400, 0x5300, 0x5200, 0x5100, 0x5000, 0x4F00, 0x4E00, 0x4D00, 0x4C00, 0x4B00,
+         0x4A00, 0x4900, 0x4800, 0x4700, 0x4600, 0x4500, 0x4400, 0x4300, 0x4200, 0x4100, 0x4000, 0x3F00, 0x3E00, 0x3D00, 0x3C00, 0x3B00,
+         0x3A00, 0x3900, 0x3800, 0x3700, 0x3600, 0x3500, 0x3400, 0x3300, 0x3200, 0x3100, 0x3000, 0x2F00, 0x2E00, 0x2D00, 0x2C00, 0x2B00,
+         0x2A00, 0x2900, 0x2800, 0x2700, 0x2600, 0x2500, 0x2400, 0x2300, 0x2200, 0x2100, 0x2000, 0x1F00, 0x1E00, 0x1D00, 0x1C00, 0x1B00,
+         0x1A00, 0x1900, 0x1800, 0x1700, 0x1600, 0x1500, 0x1400, 0x1300, 0x1200, 0x1100, 0x1000, 0x0F00, 0x0E00, 0x0D00, 0x0C00, 0x0B00,
+         0x0A00, 0x0900, 0x0800, 0x0700, 0x0600, 0x0500, 0x0400, 0x0300, 0x0200, 0x0100, 0x0000, 0x0100, 0x0200, 0x0300, 0x0400, 0x0500,
+         0x0600, 0x0700, 0x0800, 0x0801, 0x0701, 0x0601, 0x0501, 0x0401, 0x0301, 0x0201, 0x0101, 0x0001, 0x0101, 0x0201, 0x0301, 0x0401,
+         0x0501, 0x0601, 0x0701, 0x0801, 0x0802, 0x0702, 0x0602, 0x0502, 0x0402, 0x0302, 0x0202, 0x0102, 0x0002, 0x0102, 0x0202, 0x0302,
+         0x0402, 0x0502, 0x0602, 0x0702, 0x0802, 0x0803, 0x0703, 0x0603, 0x0503, 0x0403, 0x0303, 0x0203, 0x0103, 0x0003, 0x0103, 0x0203,
+         0x0303, 0x0403, 0x0503, 0x0603, 0x0703, 0x0803, 0x0804, 0x0704, 0x0604, 0x0504, 0x0404, 0x0304, 0x0204, 0x0104, 0x0004, 0x0104,
+         0x0204, 0x0304, 0x0404, 0x0504, 0x0604, 0x0704, 0x0804, 0x0805, 0x0705, 0x0605, 0x0505, 0x0405, 0x0305, 0x0205, 0x0105, 0x0005,
+         0x0105, 0x0205, 0x0305, 0x0405, 0x0505, 0x0605, 0x0705, 0x0805, 0x0806, 0x0706, 0x0606, 0x0506, 0x0406, 0x0306, 0x0206, 0x0106,
+         0x0006, 0x0106, 0x0206, 0x0306, 0x0406, 0x0506, 0x0606, 0x0706, 0x0806, 0x0807, 0x0707, 0x0607, 0x0507, 0x0407, 0x0307, 0x0207,
+         0x0107, 0x0007, 0x0107, 0x0207, 0x0307, 0x0407, 0x0507, 0x0607, 0x0707, 0x0807, 0x0808, 0x0708, 0x0608, 0x0508, 0x0408, 0x0308,
+         0x0208, 0x0108, 0x0008, 0x0108, 0x0208, 0x0308, 0x0408, 0x0508, 0x0608, 0x0609, 0x0509, 0x0409, 0x0309, 0x0209, 0x0109, 0x0009,
+      },
+      // diff 1, inten_table 6, selector 3
+      {
+         0x6A00, 0x6900, 0x6800, 0x6700, 0x6600, 0x6500, 0x6400, 0x6300, 0x6200, 0x6100, 0x6000, 0x5F00, 0x5E00, 0x5D00, 0x5C00, 0x5B00,
+         0x5A00, 0x5900, 0x5800, 0x5700, 0x5600, 0x5500, 0x5400, 0x5300, 0x5200, 0x5100, 0x5000, 0x4F00, 0x4E00, 0x4D00, 0x4C00, 0x4B00,
+         0x4A00, 0x4900, 0x4800, 0x4700, 0x4600, 0x4500, 0x4400, 0x4300, 0x4200, 0x4100, 0x4000, 0x3F00, 0x3E00, 0x3D00, 0x3C00, 0x3B00,
+         0x3A00, 0x3900, 0x3800, 0x3700, 0x3600, 0x3500, 0x3400, 0x3300, 0x3200, 0x3100, 0x3000, 0x2F00, 0x2E00, 0x2D00, 0x2C00, 0x2B00,
+         0x2A00, 0x2900, 0x2800, 0x2700, 0x2600, 0x2500, 0x2400, 0x2300, 0x2200, 0x2100, 0x2000, 0x1F00, 0x1E00, 0x1D00, 0x1C00, 0x1B00,
+         0x1A00, 0x1900, 0x1800, 0x1700, 0x1600, 0x1500, 0x1400, 0x1300, 0x1200, 0x1100, 0x1000, 0x0F00, 0x0E00, 0x0D00, 0x0C00, 0x0B00,
+         0x0A00, 0x0900, 0x0800, 0x0700, 0x0600, 0x0500, 0x0400, 0x0300, 0x0200, 0x0100, 0x0000, 0x0100, 0x0200, 0x0300, 0x0400, 0x0301,
+         0x0201, 0x0101, 0x0001, 0x0101, 0x0201, 0x0301, 0x0401, 0x0302, 0x0202, 0x0102, 0x0002, 0x0102, 0x0202, 0x0302, 0x0402, 0x0303,
+         0x0203, 0x0103, 0x0003, 0x0103, 0x0203, 0x0303, 0x0403, 0x0404, 0x0304, 0x0204, 0x0104, 0x0004, 0x0104, 0x0204, 0x0304, 0x0404,
+         0x0305, 0x0205, 0x0105, 0x0005, 0x0105, 0x0205, 0x0305, 0x0405, 0x0306, 0x0206, 0x0106, 0x0006, 0x0106, 0x0206, 0x0306, 0x0406,
+         0x0307, 0x0207, 0x0107, 0x0007, 0x0107, 0x0207, 0x0307, 0x0407, 0x0408, 0x0308, 0x0208, 0x0108, 0x0008, 0x0108, 0x0208, 0x0308,
+         0x0408, 0x0309, 0x0209, 0x0109, 0x0009, 0x0109, 0x0209, 0x0309, 0x0409, 0x030A, 0x020A, 0x010A, 0x000A, 0x010A, 0x020A, 0x030A,
+         0x040A, 0x030B, 0x020B, 0x010B, 0x000B, 0x010B, 0x020B, 0x030B, 0x040B, 0x040C, 0x030C, 0x020C, 0x010C, 0x000C, 0x010C, 0x020C,
+         0x030C, 0x040C, 0x030D, 0x020D, 0x010D, 0x000D, 0x010D, 0x020D, 0x030D, 0x040D, 0x030E, 0x020E, 0x010E, 0x000E, 0x010E, 0x020E,
+         0x030E, 0x040E, 0x030F, 0x020F, 0x010F, 0x000F, 0x010F, 0x020F, 0x030F, 0x040F, 0x0410, 0x0310, 0x0210, 0x0110, 0x0010, 0x0110,
+         0x0210, 0x0310, 0x0410, 0x0311, 0x0211, 0x0111, 0x0011, 0x0111, 0x0211, 0x0311, 0x0411, 0x0312, 0x0212, 0x0112, 0x0012, 0x0013,
+      },
+      // diff 0, inten_table 7, selector 3
+      {
+         0xB700, 0xB600, 0xB500, 0xB400, 0xB300, 0xB200, 0xB100, 0xB000, 0xAF00, 0xAE00, 0xAD00, 0xAC00, 0xAB00, 0xAA00, 0xA900, 0xA800,
+         0xA700, 0xA600, 0xA500, 0xA400, 0xA300, 0xA200, 0xA100, 0xA000, 0x9F00, 0x9E00, 0x9D00, 0x9C00, 0x9B00, 0x9A00, 0x9900, 0x9800,
+         0x9700, 0x9600, 0x9500, 0x9400, 0x9300, 0x9200, 0x9100, 0x9000, 0x8F00, 0x8E00, 0x8D00, 0x8C00, 0x8B00, 0x8A00, 0x8900, 0x8800,
+         0x8700, 0x8600, 0x8500, 0x8400, 0x8300, 0x8200, 0x8100, 0x8000, 0x7F00, 0x7E00, 0x7D00, 0x7C00, 0x7B00, 0x7A00, 0x7900, 0x7800,
+         0x7700, 0x7600, 0x7500, 0x7400, 0x7300, 0x7200, 0x7100, 0x7000, 0x6F00, 0x6E00, 0x6D00, 0x6C00, 0x6B00, 0x6A00, 0x6900, 0x6800,
+         0x6700, 0x6600, 0x6500, 0x6400, 0x6300, 0x6200, 0x6100, 0x6000, 0x5F00, 0x5E00, 0x5D00, 0x5C00, 0x5B00, 0x5A00, 0x5900, 0x5800,
+         0x5700, 0x5600, 0x5500, 0x5400, 0x5300, 0x5200, 0x5100, 0x5000, 0x4F00, 0x4E00, 0x4D00, 0x4C00, 0x4B00, 0x4A00, 0x4900, 0x4800,
+         0x4700, 0x4600, 0x4500, 0x4400, 0x4300, 0x4200, 0x4100, 0x4000, 0x3F00, 0x3E00, 0x3D00, 0x3C00, 0x3B00, 0x3A00, 0x3900, 0x3800,
+         0x3700, 0x3600, 0x3500, 0x3400, 0x3300, 0x3200, 0x3100, 0x3000, 0x2F00, 0x2E00, 0x2D00, 0x2C00, 0x2B00, 0x2A00, 0x2900, 0x2800,
+         0x2700, 0x2600, 0x2500, 0x2400, 0x2300, 0x2200, 0x2100, 0x2000, 0x1F00, 0x1E00, 0x1D00, 0x1C00, 0x1B00, 0x1A00, 0x1900, 0x1800,
+         0x1700, 0x1600, 0x1500, 0x1400, 0x1300, 0x1200, 0x1100, 0x1000, 0x0F00, 0x0E00, 0x0D00, 0x0C00, 0x0B00, 0x0A00, 0x0900, 0x0800,
+         0x0700, 0x0600, 0x0500, 0x0400, 0x0300, 0x0200, 0x0100, 0x0000, 0x0100, 0x0200, 0x0300, 0x0400, 0x0500, 0x0600, 0x0700, 0x0800,
+         0x0801, 0x0701, 0x0601, 0x0501, 0x0401, 0x0301, 0x0201, 0x0101, 0x0001, 0x0101, 0x0201, 0x0301, 0x0401, 0x0501, 0x0601, 0x0701,
+         0x0801, 0x0802, 0x0702, 0x0602, 0x0502, 0x0402, 0x0302, 0x0202, 0x0102, 0x0002, 0x0102, 0x0202, 0x0302, 0x0402, 0x0502, 0x0602,
+         0x0702, 0x0802, 0x0803, 0x0703, 0x0603, 0x0503, 0x0403, 0x0303, 0x0203, 0x0103, 0x0003, 0x0103, 0x0203, 0x0303, 0x0403, 0x0503,
+         0x0603, 0x0703, 0x0803, 0x0804, 0x0704, 0x0604, 0x0504, 0x0404, 0x0304, 0x0204, 0x0104, 0x0004, 0x0104, 0x0204, 0x0105, 0x0005,
+      },
+      // diff 1, inten_table 7, selector 3
+      {
+         0xB700, 0xB600, 0xB500, 0xB400, 0xB300, 0xB200, 0xB100, 0xB000, 0xAF00, 0xAE00, 0xAD00, 0xAC00, 0xAB00, 0xAA00, 0xA900, 0xA800,
+         0xA700, 0xA600, 0xA500, 0xA400, 0xA300, 0xA200, 0xA100, 0xA000, 0x9F00, 0x9E00, 0x9D00, 0x9C00, 0x9B00, 0x9A00, 0x9900, 0x9800,
+         0x9700, 0x9600, 0x9500, 0x9400, 0x9300, 0x9200, 0x9100, 0x9000, 0x8F00, 0x8E00, 0x8D00, 0x8C00, 0x8B00, 0x8A00, 0x8900, 0x8800,
+         0x8700, 0x8600, 0x8500, 0x8400, 0x8300, 0x8200, 0x8100, 0x8000, 0x7F00, 0x7E00, 0x7D00, 0x7C00, 0x7B00, 0x7A00, 0x7900, 0x7800,
+         0x7700, 0x7600, 0x7500, 0x7400, 0x7300, 0x7200, 0x7100, 0x7000, 0x6F00, 0x6E00, 0x6D00, 0x6C00, 0x6B00, 0x6A00, 0x6900, 0x6800,
+         0x6700, 0x6600, 0x6500, 0x6400, 0x6300, 0x6200, 0x6100, 0x6000, 0x5F00, 0x5E00, 0x5D00, 0x5C00, 0x5B00, 0x5A00, 0x5900, 0x5800,
+         0x5700, 0x5600, 0x5500, 0x5400, 0x5300, 0x5200, 0x5100, 0x5000, 0x4F00, 0x4E00, 0x4D00, 0x4C00, 0x4B00, 0x4A00, 0x4900, 0x4800,
+         0x4700, 0x4600, 0x4500, 0x4400, 0x4300, 0x4200, 0x4100, 0x4000, 0x3F00, 0x3E00, 0x3D00, 0x3C00, 0x3B00, 0x3A00, 0x3900, 0x3800,
+         0x3700, 0x3600, 0x3500, 0x3400, 0x3300, 0x3200, 0x3100, 0x3000, 0x2F00, 0x2E00, 0x2D00, 0x2C00, 0x2B00, 0x2A00, 0x2900, 0x2800,
+         0x2700, 0x2600, 0x2500, 0x2400, 0x2300, 0x2200, 0x2100, 0x2000, 0x1F00, 0x1E00, 0x1D00, 0x1C00, 0x1B00, 0x1A00, 0x1900, 0x1800,
+         0x1700, 0x1600, 0x1500, 0x1400, 0x1300, 0x1200, 0x1100, 0x1000, 0x0F00, 0x0E00, 0x0D00, 0x0C00, 0x0B00, 0x0A00, 0x0900, 0x0800,
+         0x0700, 0x0600, 0x0500, 0x0400, 0x0300, 0x0200, 0x0100, 0x0000, 0x0100, 0x0200, 0x0300, 0x0400, 0x0301, 0x0201, 0x0101, 0x0001,
+         0x0101, 0x0201, 0x0301, 0x0401, 0x0302, 0x0202, 0x0102, 0x0002, 0x0102, 0x0202, 0x0302, 0x0402, 0x0303, 0x0203, 0x0103, 0x0003,
+         0x0103, 0x0203, 0x0303, 0x0403, 0x0404, 0x0304, 0x0204, 0x0104, 0x0004, 0x0104, 0x0204, 0x0304, 0x0404, 0x0305, 0x0205, 0x0105,
+         0x0005, 0x0105, 0x0205, 0x0305, 0x0405, 0x0306, 0x0206, 0x0106, 0x0006, 0x0106, 0x0206, 0x0306, 0x0406, 0x0307, 0x0207, 0x0107,
+         0x0007, 0x0107, 0x0207, 0x0307, 0x0407, 0x0408, 0x0308, 0x0208, 0x0108, 0x0008, 0x0108, 0x0208, 0x0308, 0x0209, 0x0109, 0x0009,
+      },
+   };
 
    // g_color8_to_etc_block_config[color][table_index] = Supplies for each 8-bit color value a list of packed ETC1 diff/intensity table/selectors/packed_colors that map to that color.
    // To pack: diff | (inten << 1) | (selector << 4) | (packed_c << 8)
@@ -1662,6 +2911,426 @@ namespace rg_etc1
       m_best_solution.m_error = cUINT64_MAX;
    }
 
+   // Selector kernels. Both work on the 8 pixels of a subblock against 4 block colors; the alpha components are ignored.
+   //
+   // select_func picks the closest block color for each pixel (the lowest selector wins ties) and returns the total squared error.
+   // It may stop early and return any error >= limit once the total reaches it, leaving the remaining selectors undefined.
+   //
+   // error_func returns the total squared error of the pixels against the block colors picked by pSelectors.
+   //
+   // The SIMD kernels must give exactly the same selectors and errors as the scalar ones.
+   typedef uint64_t (*select_func)(const color_quad_u8* pSrc_pixels, const color_quad_u8* pBlock_colors, uint8_t* pSelectors, uint64_t limit);
+   typedef uint64_t (*error_func)(const color_quad_u8* pSrc_pixels, const color_quad_u8* pBlock_colors, const uint8_t* pSelectors);
+
+   static uint64_t select_scalar(const color_quad_u8* pSrc_pixels, const color_quad_u8* pBlock_colors, uint8_t* pSelectors, uint64_t limit)
+   {
+      uint64_t total_error = 0;
+
+      for (uint32_t c = 0; c < 8; c++)
+      {
+         const color_quad_u8& src_pixel = *pSrc_pixels++;
+
+         uint32_t best_selector_index = 0;
+         uint32_t best_error = pBlock_colors[0].squared_distance_rgb(src_pixel);
+
+         for (uint32_t s = 1; s < 4; s++)
+         {
+            const uint32_t trial_error = pBlock_colors[s].squared_distance_rgb(src_pixel);
+            if (trial_error < best_error)
+            {
+               best_error = trial_error;
+               best_selector_index = s;
+            }
+         }
+
+         pSelectors[c] = static_cast<uint8_t>(best_selector_index);
+
+         total_error += best_error;
+         if (total_error >= limit)
+            break;
+      }
+
+      return total_error;
+   }
+
+   static uint64_t error_scalar(const color_quad_u8* pSrc_pixels, const color_quad_u8* pBlock_colors, const uint8_t* pSelectors)
+   {
+      uint64_t total_error = 0;
+
+      for (uint32_t c = 0; c < 8; c++)
+         total_error += pBlock_colors[pSelectors[c]].squared_distance_rgb(pSrc_pixels[c]);
+
+      return total_error;
+   }
+
+#ifdef RG_ETC1_X86
+   // The x86 kernels hold 4 (SSE4.1) or 8 (AVX2) RGBA8 pixels per register with alpha cleared. Differences are taken in
+   // 16-bit lanes and squared with madd, which sums R^2+G^2 and B^2+0; hadd then sums the two halves of each pixel.
+
+   __attribute__((target("sse4.1")))
+   static inline __m128i error4_sse41(__m128i px, __m128i color)
+   {
+      const __m128i zero = _mm_setzero_si128();
+      __m128i lo = _mm_sub_epi16(_mm_unpacklo_epi8(px, zero), _mm_unpacklo_epi8(color, zero));
+      __m128i hi = _mm_sub_epi16(_mm_unpackhi_epi8(px, zero), _mm_unpackhi_epi8(color, zero));
+      lo = _mm_madd_epi16(lo, lo);
+      hi = _mm_madd_epi16(hi, hi);
+      return _mm_hadd_epi32(lo, hi);
+   }
+
+   __attribute__((target("sse4.1")))
+   static inline uint64_t hsum_sse41(__m128i v)
+   {
+      v = _mm_add_epi32(v, _mm_shuffle_epi32(v, 0x4E));
+      v = _mm_add_epi32(v, _mm_shuffle_epi32(v, 0xB1));
+      return static_cast<uint32_t>(_mm_cvtsi128_si32(v));
+   }
+
+   __attribute__((target("sse4.1")))
+   static uint64_t select_sse41(const color_quad_u8* pSrc_pixels, const color_quad_u8* pBlock_colors, uint8_t* pSelectors, uint64_t)
+   {
+      const __m128i rgb_mask = _mm_set1_epi32(0x00FFFFFF);
+      const __m128i px0 = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc_pixels + 0)), rgb_mask);
+      const __m128i px1 = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc_pixels + 4)), rgb_mask);
+
+      __m128i color = _mm_and_si128(_mm_set1_epi32(pBlock_colors[0].m_u32), rgb_mask);
+      __m128i best0 = error4_sse41(px0, color);
+      __m128i best1 = error4_sse41(px1, color);
+      __m128i sel0 = _mm_setzero_si128();
+      __m128i sel1 = _mm_setzero_si128();
+
+      for (uint32_t s = 1; s < 4; s++)
+      {
+         color = _mm_and_si128(_mm_set1_epi32(pBlock_colors[s].m_u32), rgb_mask);
+         const __m128i selector = _mm_set1_epi32(s);
+         const __m128i err0 = error4_sse41(px0, color);
+         const __m128i err1 = error4_sse41(px1, color);
+
+         // strictly less, so the lowest selector wins ties
+         sel0 = _mm_blendv_epi8(sel0, selector, _mm_cmplt_epi32(err0, best0));
+         sel1 = _mm_blendv_epi8(sel1, selector, _mm_cmplt_epi32(err1, best1));
+         best0 = _mm_min_epi32(best0, err0);
+         best1 = _mm_min_epi32(best1, err1);
+      }
+
+      const __m128i sel = _mm_packus_epi16(_mm_packs_epi32(sel0, sel1), _mm_setzero_si128());
+      _mm_storel_epi64(reinterpret_cast<__m128i*>(pSelectors), sel);
+
+      return hsum_sse41(_mm_add_epi32(best0, best1));
+   }
+
+   __attribute__((target("sse4.1")))
+   static inline __m128i gather4_sse41(__m128i colors, const uint8_t* pSelectors)
+   {
+      // byte index of each component of each pixel's block color: selector * 4 + component
+      int32_t packed;
+      std::memcpy(&packed, pSelectors, sizeof(packed));
+      __m128i index = _mm_slli_epi32(_mm_cvtepu8_epi32(_mm_cvtsi32_si128(packed)), 2);
+      index = _mm_shuffle_epi8(index, _mm_setr_epi8(0, 0, 0, 0, 4, 4, 4, 4, 8, 8, 8, 8, 12, 12, 12, 12));
+      index = _mm_add_epi8(index, _mm_set1_epi32(0x03020100));
+      return _mm_shuffle_epi8(colors, index);
+   }
+
+   __attribute__((target("sse4.1")))
+   static uint64_t error_sse41(const color_quad_u8* pSrc_pixels, const color_quad_u8* pBlock_colors, const uint8_t* pSelectors)
+   {
+      const __m128i rgb_mask = _mm_set1_epi32(0x00FFFFFF);
+      const __m128i px0 = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc_pixels + 0)), rgb_mask);
+      const __m128i px1 = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc_pixels + 4)), rgb_mask);
+      const __m128i colors = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pBlock_colors)), rgb_mask);
+
+      const __m128i err0 = error4_sse41(px0, gather4_sse41(colors, pSelectors + 0));
+      const __m128i err1 = error4_sse41(px1, gather4_sse41(colors, pSelectors + 4));
+
+      return hsum_sse41(_mm_add_epi32(err0, err1));
+   }
+
+   // The AVX2 unpacks work within 128-bit lanes, but hadd puts the pixels back in order.
+   __attribute__((target("avx2")))
+   static inline __m256i error8_avx2(__m256i px, __m256i color)
+   {
+      const __m256i zero = _mm256_setzero_si256();
+      __m256i lo = _mm256_sub_epi16(_mm256_unpacklo_epi8(px, zero), _mm256_unpacklo_epi8(color, zero));
+      __m256i hi = _mm256_sub_epi16(_mm256_unpackhi_epi8(px, zero), _mm256_unpackhi_epi8(color, zero));
+      lo = _mm256_madd_epi16(lo, lo);
+      hi = _mm256_madd_epi16(hi, hi);
+      return _mm256_hadd_epi32(lo, hi);
+   }
+
+   __attribute__((target("avx2")))
+   static inline uint64_t hsum_avx2(__m256i v)
+   {
+      __m128i sum = _mm_add_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+      sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0x4E));
+      sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0xB1));
+      return static_cast<uint32_t>(_mm_cvtsi128_si32(sum));
+   }
+
+   __attribute__((target("avx2")))
+   static uint64_t select_avx2(const color_quad_u8* pSrc_pixels, const color_quad_u8* pBlock_colors, uint8_t* pSelectors, uint64_t)
+   {
+      const __m256i rgb_mask = _mm256_set1_epi32(0x00FFFFFF);
+      const __m256i px = _mm256_and_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(pSrc_pixels)), rgb_mask);
+
+      __m256i best = error8_avx2(px, _mm256_and_si256(_mm256_set1_epi32(pBlock_colors[0].m_u32), rgb_mask));
+      __m256i sel = _mm256_setzero_si256();
+
+      for (uint32_t s = 1; s < 4; s++)
+      {
+         const __m256i err = error8_avx2(px, _mm256_and_si256(_mm256_set1_epi32(pBlock_colors[s].m_u32), rgb_mask));
+
+         // strictly less, so the lowest selector wins ties
+         sel = _mm256_blendv_epi8(sel, _mm256_set1_epi32(s), _mm256_cmpgt_epi32(best, err));
+         best = _mm256_min_epi32(best, err);
+      }
+
+      // each 128-bit lane packs its 4 selectors into its low 4 bytes
+      sel = _mm256_packus_epi16(_mm256_packs_epi32(sel, sel), sel);
+      const int32_t lo = _mm_cvtsi128_si32(_mm256_castsi256_si128(sel));
+      const int32_t hi = _mm_cvtsi128_si32(_mm256_extracti128_si256(sel, 1));
+      std::memcpy(pSelectors + 0, &lo, sizeof(lo));
+      std::memcpy(pSelectors + 4, &hi, sizeof(hi));
+
+      return hsum_avx2(best);
+   }
+
+   __attribute__((target("avx2")))
+   static uint64_t error_avx2(const color_quad_u8* pSrc_pixels, const color_quad_u8* pBlock_colors, const uint8_t* pSelectors)
+   {
+      const __m256i rgb_mask = _mm256_set1_epi32(0x00FFFFFF);
+      const __m256i px = _mm256_and_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(pSrc_pixels)), rgb_mask);
+      const __m256i colors = _mm256_and_si256(_mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pBlock_colors))), rgb_mask);
+
+      // byte index of each component of each pixel's block color: selector * 4 + component
+      __m256i index = _mm256_slli_epi32(_mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(pSelectors))), 2);
+      index = _mm256_shuffle_epi8(index, _mm256_setr_epi8(0, 0, 0, 0, 4, 4, 4, 4, 8, 8, 8, 8, 12, 12, 12, 12,
+                                                          0, 0, 0, 0, 4, 4, 4, 4, 8, 8, 8, 8, 12, 12, 12, 12));
+      index = _mm256_add_epi8(index, _mm256_set1_epi32(0x03020100));
+
+      return hsum_avx2(error8_avx2(px, _mm256_shuffle_epi8(colors, index)));
+   }
+#endif
+
+#ifdef RG_ETC1_NEON
+   // The NEON kernels hold 4 RGBA8 pixels per register with alpha cleared. Absolute differences are squared by widening
+   // multiplies, then pairwise adds sum the components of each pixel.
+
+   static inline uint32x4_t error4_neon(uint8x16_t px, uint8x16_t color)
+   {
+      const uint8x16_t diff = vabdq_u8(px, color);
+      const uint32x4_t lo = vpaddlq_u16(vmull_u8(vget_low_u8(diff), vget_low_u8(diff)));
+      const uint32x4_t hi = vpaddlq_u16(vmull_high_u8(diff, diff));
+      return vpaddq_u32(lo, hi);
+   }
+
+   static uint64_t select_neon(const color_quad_u8* pSrc_pixels, const color_quad_u8* pBlock_colors, uint8_t* pSelectors, uint64_t)
+   {
+      const uint32x4_t rgb_mask = vdupq_n_u32(0x00FFFFFF);
+      const uint8x16_t px0 = vreinterpretq_u8_u32(vandq_u32(vld1q_u32(&pSrc_pixels[0].m_u32), rgb_mask));
+      const uint8x16_t px1 = vreinterpretq_u8_u32(vandq_u32(vld1q_u32(&pSrc_pixels[4].m_u32), rgb_mask));
+
+      uint8x16_t color = vreinterpretq_u8_u32(vdupq_n_u32(pBlock_colors[0].m_u32 & 0x00FFFFFF));
+      uint32x4_t best0 = error4_neon(px0, color);
+      uint32x4_t best1 = error4_neon(px1, color);
+      uint32x4_t sel0 = vdupq_n_u32(0);
+      uint32x4_t sel1 = vdupq_n_u32(0);
+
+      for (uint32_t s = 1; s < 4; s++)
+      {
+         color = vreinterpretq_u8_u32(vdupq_n_u32(pBlock_colors[s].m_u32 & 0x00FFFFFF));
+         const uint32x4_t selector = vdupq_n_u32(s);
+         const uint32x4_t err0 = error4_neon(px0, color);
+         const uint32x4_t err1 = error4_neon(px1, color);
+
+         // strictly less, so the lowest selector wins ties
+         sel0 = vbslq_u32(vcltq_u32(err0, best0), selector, sel0);
+         sel1 = vbslq_u32(vcltq_u32(err1, best1), selector, sel1);
+         best0 = vminq_u32(best0, err0);
+         best1 = vminq_u32(best1, err1);
+      }
+
+      vst1_u8(pSelectors, vmovn_u16(vcombine_u16(vmovn_u32(sel0), vmovn_u32(sel1))));
+
+      return vaddvq_u32(vaddq_u32(best0, best1));
+   }
+
+   static uint64_t error_neon(const color_quad_u8* pSrc_pixels, const color_quad_u8* pBlock_colors, const uint8_t* pSelectors)
+   {
+      static const uint8_t spread[2][16] =
+      {
+         { 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3 },
+         { 4, 4, 4, 4, 5, 5, 5, 5, 6, 6, 6, 6, 7, 7, 7, 7 },
+      };
+      static const uint8_t component[16] = { 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3 };
+
+      const uint32x4_t rgb_mask = vdupq_n_u32(0x00FFFFFF);
+      const uint8x16_t px0 = vreinterpretq_u8_u32(vandq_u32(vld1q_u32(&pSrc_pixels[0].m_u32), rgb_mask));
+      const uint8x16_t px1 = vreinterpretq_u8_u32(vandq_u32(vld1q_u32(&pSrc_pixels[4].m_u32), rgb_mask));
+      const uint8x16_t colors = vreinterpretq_u8_u32(vandq_u32(vld1q_u32(&pBlock_colors[0].m_u32), rgb_mask));
+
+      // byte index of each component of each pixel's block color: selector * 4 + component
+      const uint8x8_t sel = vshl_n_u8(vld1_u8(pSelectors), 2);
+      const uint8x16_t sel2 = vcombine_u8(sel, sel);
+      const uint8x16_t index0 = vaddq_u8(vqtbl1q_u8(sel2, vld1q_u8(spread[0])), vld1q_u8(component));
+      const uint8x16_t index1 = vaddq_u8(vqtbl1q_u8(sel2, vld1q_u8(spread[1])), vld1q_u8(component));
+
+      const uint32x4_t err0 = error4_neon(px0, vqtbl1q_u8(colors, index0));
+      const uint32x4_t err1 = error4_neon(px1, vqtbl1q_u8(colors, index1));
+
+      return vaddvq_u32(vaddq_u32(err0, err1));
+   }
+#endif
+
+   struct selector_kernels
+   {
+      const char* m_pName;
+      select_func m_select;
+      error_func m_error;
+   };
+
+   enum { cMaxSelectorKernels = 3 };
+
+   // Fills pKernels with every kernel set this build and CPU support, best first; the scalar kernels are always last.
+   static uint32_t get_selector_kernels(selector_kernels* pKernels)
+   {
+      uint32_t n = 0;
+
+#if defined(RG_ETC1_X86)
+      __builtin_cpu_init();
+      if (__builtin_cpu_supports("avx2"))
+      {
+         const selector_kernels avx2 = { "avx2", select_avx2, error_avx2 };
+         pKernels[n++] = avx2;
+      }
+      if (__builtin_cpu_supports("sse4.1"))
+      {
+         const selector_kernels sse41 = { "sse4.1", select_sse41, error_sse41 };
+         pKernels[n++] = sse41;
+      }
+#elif defined(RG_ETC1_NEON)
+      const selector_kernels neon = { "neon", select_neon, error_neon };
+      pKernels[n++] = neon;
+#endif
+
+      const selector_kernels scalar = { "scalar", select_scalar, error_scalar };
+      pKernels[n++] = scalar;
+
+      return n;
+   }
+
+   // Selected in pack_etc1_block_init().
+   static select_func g_select = select_scalar;
+   static error_func g_error = error_scalar;
+
+   static void init_selector_kernels()
+   {
+      selector_kernels kernels[cMaxSelectorKernels];
+      get_selector_kernels(kernels);
+
+      g_select = kernels[0].m_select;
+      g_error = kernels[0].m_error;
+   }
+
+   // Small deterministic generator for the kernel self-test, so every run checks the same subblocks.
+   static inline uint32_t next_random(uint32_t& state)
+   {
+      state = state * 1664525U + 1013904223U;
+      return state >> 8;
+   }
+
+   // Random color; components are often 0 or 255 to reach the largest differences the kernels must handle.
+   static color_quad_u8 random_color(uint32_t& state)
+   {
+      color_quad_u8 color;
+      for (uint32_t i = 0; i < 4; i++)
+      {
+         const uint32_t v = next_random(state);
+         color.c[i] = static_cast<uint8_t>((v & 0x300) == 0 ? 0 : (v & 0x300) == 0x100 ? 255 : v);
+      }
+      return color;
+   }
+
+   static bool check_selector_kernels(const selector_kernels& kernels, const selector_kernels& scalar)
+   {
+      enum { cNumTrials = 100000 };
+
+      uint32_t state = 1;
+
+      for (uint32_t trial = 0; trial < cNumTrials; trial++)
+      {
+         color_quad_u8 pixels[8], block_colors[4];
+
+         const color_quad_u8 c0(random_color(state)), c1(random_color(state));
+         for (uint32_t i = 0; i < 8; i++)
+         {
+            switch (trial % 3)
+            {
+               case 0: pixels[i] = random_color(state); break;         // random
+               case 1: pixels[i] = c0; break;                          // flat
+               default: pixels[i] = (next_random(state) & 1) ? c1 : c0; // two colors
+            }
+            // alpha must be ignored
+            pixels[i].a = static_cast<uint8_t>(next_random(state));
+         }
+
+         for (uint32_t s = 0; s < 4; s++)
+            block_colors[s] = random_color(state);
+
+         // repeated block colors and block colors equal to the pixels exercise the tie breaking
+         if (trial & 4)
+            block_colors[3] = block_colors[next_random(state) % 3];
+         if (trial & 8)
+            block_colors[next_random(state) % 4].set_rgb(c0);
+         if (trial & 16)
+            block_colors[next_random(state) % 4].set_rgb(c1);
+
+         uint8_t expected_selectors[8], actual_selectors[8];
+         const uint64_t expected = scalar.m_select(pixels, block_colors, expected_selectors, cUINT64_MAX);
+         const uint64_t actual = kernels.m_select(pixels, block_colors, actual_selectors, cUINT64_MAX);
+         if ((actual != expected) || std::memcmp(actual_selectors, expected_selectors, sizeof(expected_selectors)))
+            return false;
+
+         // an early exit may return any error at or above the limit
+         const uint64_t limit = next_random(state) % (expected + 2);
+         const uint64_t limited_expected = scalar.m_select(pixels, block_colors, expected_selectors, limit);
+         const uint64_t limited_actual = kernels.m_select(pixels, block_colors, actual_selectors, limit);
+         if ((limited_expected < limit || limited_actual < limit) && limited_actual != limited_expected)
+            return false;
+
+         uint8_t selectors[8];
+         for (uint32_t i = 0; i < 8; i++)
+            selectors[i] = static_cast<uint8_t>(next_random(state) & 3);
+
+         if (kernels.m_error(pixels, block_colors, selectors) != scalar.m_error(pixels, block_colors, selectors))
+            return false;
+      }
+
+      return true;
+   }
+
+   unsigned int etc1_kernel_count()
+   {
+      selector_kernels kernels[cMaxSelectorKernels];
+      return get_selector_kernels(kernels);
+   }
+
+   const char* etc1_kernel_name(unsigned int index)
+   {
+      selector_kernels kernels[cMaxSelectorKernels];
+      const uint32_t n = get_selector_kernels(kernels);
+      return index < n ? kernels[index].m_pName : nullptr;
+   }
+
+   bool check_etc1_kernel(unsigned int index)
+   {
+      selector_kernels kernels[cMaxSelectorKernels];
+      const uint32_t n = get_selector_kernels(kernels);
+      if (index >= n)
+         return false;
+
+      return check_selector_kernels(kernels[index], kernels[n - 1]);
+   }
+
    bool etc1_optimizer::evaluate_solution(const etc1_solution_coordinates& coords, potential_solution& trial_solution, potential_solution* pBest_solution)
    {
       trial_solution.m_valid = false;
@@ -1678,8 +3347,6 @@ namespace rg_etc1
 
       const color_quad_u8 base_color(coords.get_scaled_color());
 
-      const uint32_t n = 8;
-
       trial_solution.m_error = cUINT64_MAX;
 
       for (uint32_t inten_table = 0; inten_table < cETC1IntenModifierValues; inten_table++)
@@ -1693,43 +3360,7 @@ namespace rg_etc1
             block_colors[s].set(base_color.r + yd, base_color.g + yd, base_color.b + yd, 0);
          }
 
-         uint64_t total_error = 0;
-
-         const color_quad_u8* pSrc_pixels = m_pParams->m_pSrc_pixels;
-         for (uint32_t c = 0; c < n; c++)
-         {
-            const color_quad_u8& src_pixel = *pSrc_pixels++;
-
-            uint32_t best_selector_index = 0;
-            uint32_t best_error = rg_etc1::square(src_pixel.r - block_colors[0].r) + rg_etc1::square(src_pixel.g - block_colors[0].g) + rg_etc1::square(src_pixel.b - block_colors[0].b);
-
-            uint32_t trial_error = rg_etc1::square(src_pixel.r - block_colors[1].r) + rg_etc1::square(src_pixel.g - block_colors[1].g) + rg_etc1::square(src_pixel.b - block_colors[1].b);
-            if (trial_error < best_error)
-            {
-               best_error = trial_error;
-               best_selector_index = 1;
-            }
-
-            trial_error = rg_etc1::square(src_pixel.r - block_colors[2].r) + rg_etc1::square(src_pixel.g - block_colors[2].g) + rg_etc1::square(src_pixel.b - block_colors[2].b);
-            if (trial_error < best_error)
-            {
-               best_error = trial_error;
-               best_selector_index = 2;
-            }
-
-            trial_error = rg_etc1::square(src_pixel.r - block_colors[3].r) + rg_etc1::square(src_pixel.g - block_colors[3].g) + rg_etc1::square(src_pixel.b - block_colors[3].b);
-            if (trial_error < best_error)
-            {
-               best_error = trial_error;
-               best_selector_index = 3;
-            }
-
-            m_temp_selectors[c] = static_cast<uint8_t>(best_selector_index);
-
-            total_error += best_error;
-            if (total_error >= trial_solution.m_error)
-               break;
-         }
+         const uint64_t total_error = g_select(m_pParams->m_pSrc_pixels, block_colors, m_temp_selectors, trial_solution.m_error);
 
          if (total_error < trial_solution.m_error)
          {
@@ -1796,8 +3427,6 @@ namespace rg_etc1
          //   01  12  23
          const uint32_t block_inten_midpoints[3] = { block_inten[0] + block_inten[1], block_inten[1] + block_inten[2], block_inten[2] + block_inten[3] };
 
-         uint64_t total_error = 0;
-         const color_quad_u8* pSrc_pixels = m_pParams->m_pSrc_pixels;
          if ((m_pSorted_luma[n - 1] * 2) < block_inten_midpoints[0])
          {
             if (block_inten[0] > m_pSorted_luma[n - 1])
@@ -1808,9 +3437,6 @@ namespace rg_etc1
             }
 
             std::memset(&m_temp_selectors[0], 0, n);
-
-            for (uint32_t c = 0; c < n; c++)
-               total_error += block_colors[0].squared_distance_rgb(pSrc_pixels[c]);
          }
          else if ((m_pSorted_luma[0] * 2) >= block_inten_midpoints[2])
          {
@@ -1822,9 +3448,6 @@ namespace rg_etc1
             }
 
             std::memset(&m_temp_selectors[0], 3, n);
-
-            for (uint32_t c = 0; c < n; c++)
-               total_error += block_colors[3].squared_distance_rgb(pSrc_pixels[c]);
          }
          else
          {
@@ -1837,18 +3460,19 @@ namespace rg_etc1
                      goto done;
                const uint32_t sorted_pixel_index = m_pSorted_luma_indices[c];
                m_temp_selectors[sorted_pixel_index] = static_cast<uint8_t>(cur_selector);
-               total_error += block_colors[cur_selector].squared_distance_rgb(pSrc_pixels[sorted_pixel_index]);
             }
 done:
             while (c < n)
             {
                const uint32_t sorted_pixel_index = m_pSorted_luma_indices[c];
                m_temp_selectors[sorted_pixel_index] = 3;
-               total_error += block_colors[3].squared_distance_rgb(pSrc_pixels[sorted_pixel_index]);
                ++c;
             }
          }
 
+         // the selectors are known now; sum up their error in one go
+         const uint64_t total_error = g_error(m_pParams->m_pSrc_pixels, block_colors, m_temp_selectors);
+
          if (total_error < trial_solution.m_error)
          {
             trial_solution.m_error = total_error;
@@ -1875,7 +3499,7 @@ done:
       return success;
    }
 
-   static uint32_t etc1_decode_value(uint32_t diff, uint32_t inten, uint32_t selector, uint32_t packed_c)
+   static inline uint32_t etc1_decode_value(uint32_t diff, uint32_t inten, uint32_t selector, uint32_t packed_c)
    {
       RG_ETC1_ASSERT((diff < 2) && (inten < 8) && (selector < 4) && (packed_c < (diff ? 32 : 16)));
       int c;
@@ -1890,7 +3514,7 @@ done:
 
    static inline int mul_8bit(int a, int b) { int t = a*b + 128; return (t + (t >> 8)) >> 8; }
 
-   void pack_etc1_block_init()
+   void generate_etc1_tables(unsigned short inverse_lookup[64][256], unsigned char quant5[256 + 16])
    {
       for (uint32_t diff = 0; diff < 2; diff++)
       {
@@ -1917,7 +3541,7 @@ done:
                      }
                   }
                   RG_ETC1_ASSERT(best_error <= 255);
-                  g_etc1_inverse_lookup[inverse_table_index][color] = static_cast<uint16_t>(best_packed_c | (best_error << 8));
+                  inverse_lookup[inverse_table_index][color] = static_cast<uint16_t>(best_packed_c | (best_error << 8));
                }
             }
          }
@@ -1930,10 +3554,30 @@ done:
       for(int i = 0; i < 256 + 16; i++)
       {
          int v = clamp<int>(i - 8, 0, 255);
-         g_quant5_tab[i] = static_cast<uint8_t>(expand5[mul_8bit(v,31)]);
+         quant5[i] = static_cast<uint8_t>(expand5[mul_8bit(v,31)]);
       }
    }
 
+   bool check_etc1_tables()
+   {
+      unsigned short inverse_lookup[64][256];
+      unsigned char quant5[256 + 16];
+      generate_etc1_tables(inverse_lookup, quant5);
+
+      return !std::memcmp(inverse_lookup, g_etc1_inverse_lookup, sizeof(g_etc1_inverse_lookup))
+          && !std::memcmp(quant5, g_quant5_tab, sizeof(g_quant5_tab));
+   }
+
+   void pack_etc1_block_init()
+   {
+      // The lookup tables are precomputed; only the selector kernels depend on the CPU.
+      init_selector_kernels();
+
+#ifdef RG_ETC1_BUILD_DEBUG
+      RG_ETC1_ASSERT(check_etc1_tables());
+#endif
+   }
+
    // Packs solid color blocks efficiently using a set of small precomputed tables.
    // For random 888 inputs, MSE results are better than Erricson's ETC1 packer in "slow" mode ~9.5% of the time, is slightly worse only ~.01% of the time, and is equal the rest of the time.
    static uint64_t pack_etc1_block_solid_color(etc1_block& block, const uint8_t* pColor)
@@ -2140,7 +3784,7 @@ found_perfect_match:
    static void dither_block_555(color_quad_u8* dest, const color_quad_u8* block)
    {
       int err[8],*ep1 = err,*ep2 = err+4;
-      uint8_t *quant = g_quant5_tab+8;
+      const uint8_t *quant = g_quant5_tab+8;
 
       std::memset(dest, 0xFF, sizeof(color_quad_u8)*16);
 
@@ -2179,29 +3823,19 @@ found_perfect_match:
       }
    }
 
-   unsigned int pack_etc1_block(void* pETC1_block, const unsigned int* pSrc_pixels_rgba, etc1_pack_params& pack_params)
+   static inline bool is_solid_block(const color_quad_u8* pSrc_pixels)
    {
-      const color_quad_u8* pSrc_pixels = reinterpret_cast<const color_quad_u8*>(pSrc_pixels_rgba);
-      etc1_block& dst_block = *static_cast<etc1_block*>(pETC1_block);
-
-#ifdef RG_ETC1_BUILD_DEBUG
-      // Ensure all alpha values are 0xFF.
-      for (uint32_t i = 0; i < 16; i++)
-      {
-         RG_ETC1_ASSERT(pSrc_pixels[i].a == 255);
-      }
-#endif
-
-      color_quad_u8 src_pixel0(pSrc_pixels[0]);
-
-      // Check for solid block.
       const uint32_t first_pixel_u32 = pSrc_pixels->m_u32;
-      int r;
-      for (r = 15; r >= 1; --r)
+      for (int r = 15; r >= 1; --r)
          if (pSrc_pixels[r].m_u32 != first_pixel_u32)
-            break;
-      if (!r)
-         return static_cast<unsigned int>(16 * pack_etc1_block_solid_color(dst_block, &pSrc_pixels[0].r));
+            return false;
+      return true;
+   }
+
+   // Packs a block that is known not to be solid, using the caller's optimizer so its state can be reused across blocks.
+   static unsigned int pack_etc1_block_optimized(etc1_block& dst_block, const color_quad_u8* pSrc_pixels, etc1_pack_params& pack_params, etc1_optimizer& optimizer)
+   {
+      int r;
 
       color_quad_u8 dithered_pixels[16];
       if (pack_params.m_dithering)
@@ -2210,8 +3844,6 @@ found_perfect_match:
          pSrc_pixels = dithered_pixels;
       }
 
-      etc1_optimizer optimizer;
-
       uint64_t best_error = cUINT64_MAX;
       uint32_t best_flip = false, best_use_color4 = false;
 
@@ -2444,4 +4076,50 @@ found_perfect_match:
       return static_cast<unsigned int>(best_error);
    }
 
+   unsigned int pack_etc1_block(void* pETC1_block, const unsigned int* pSrc_pixels_rgba, etc1_pack_params& pack_params)
+   {
+      const color_quad_u8* pSrc_pixels = reinterpret_cast<const color_quad_u8*>(pSrc_pixels_rgba);
+      etc1_block& dst_block = *static_cast<etc1_block*>(pETC1_block);
+
+#ifdef RG_ETC1_BUILD_DEBUG
+      // Ensure all alpha values are 0xFF.
+      for (uint32_t i = 0; i < 16; i++)
+      {
+         RG_ETC1_ASSERT(pSrc_pixels[i].a == 255);
+      }
+#endif
+
+      // Check for solid block.
+      if (is_solid_block(pSrc_pixels))
+         return static_cast<unsigned int>(16 * pack_etc1_block_solid_color(dst_block, &pSrc_pixels[0].r));
+
+      etc1_optimizer optimizer;
+      return pack_etc1_block_optimized(dst_block, pSrc_pixels, pack_params, optimizer);
+   }
+
+   void pack_etc1_blocks(void* pETC1_blocks, const unsigned int* pSrc_pixels_rgba, unsigned int* pErrors, unsigned int num_blocks, etc1_pack_params& pack_params)
+   {
+      const color_quad_u8* pSrc_pixels = reinterpret_cast<const color_quad_u8*>(pSrc_pixels_rgba);
+      // Blocks are packed 8 bytes apart; only m_bytes of each etc1_block is written.
+      uint8_t* pDst_blocks = static_cast<uint8_t*>(pETC1_blocks);
+
+      // First pass: solid blocks only need a table lookup. The other blocks are marked with an error no block can reach.
+      for (uint32_t i = 0; i < num_blocks; i++)
+      {
+         const color_quad_u8* pBlock_pixels = pSrc_pixels + i * 16;
+         if (is_solid_block(pBlock_pixels))
+            pErrors[i] = static_cast<unsigned int>(16 * pack_etc1_block_solid_color(*reinterpret_cast<etc1_block*>(pDst_blocks + i * 8), &pBlock_pixels[0].r));
+         else
+            pErrors[i] = cUINT32_MAX;
+      }
+
+      // Second pass: run the remaining blocks back to back through one optimizer, while its state and the lookup tables are hot.
+      etc1_optimizer optimizer;
+      for (uint32_t i = 0; i < num_blocks; i++)
+      {
+         if (pErrors[i] == cUINT32_MAX)
+            pErrors[i] = pack_etc1_block_optimized(*reinterpret_cast<etc1_block*>(pDst_blocks + i * 8), pSrc_pixels + i * 16, pack_params, optimizer);
+      }
+   }
+
 } // namespace rg_etc1
@@ -36,8 +36,18 @@
 /** @brief Maximum copy length */
 #define RLE_MAX_COPY 128
 
+namespace
+{
+
+/** @brief Run-length encoding compression
+ *  @param[in]  source Source buffer
+ *  @param[in]  len    Source length
+ *  @param[in]  limit  Output size limit; may be null
+ *  @returns Compressed buffer; empty if the output grew past the limit
+ */
 std::vector<uint8_t>
-rleEncode(const void *source, size_t len)
+rleCommonEncode(const void *source, size_t len,
+                const std::atomic<size_t> *limit)
 {
   // create output buffer
   std::vector<uint8_t> result;
@@ -51,6 +61,10 @@ rleEncode(const void *source, size_t len)
   size_t        save_len = 0, run;
   while(src < end)
   {
+    // give up once this output can't be the smallest
+    if(limit && result.size() > limit->load(std::memory_order_relaxed))
+      return std::vector<uint8_t>();
+
     // calculate current run
     for(run = 1; src+run < end && run < RLE_MAX_RUN; ++run)
     {
@@ -112,6 +126,20 @@ rleEncode(const void *source, size_t len)
   return result;
 }
 
+}
+
+std::vector<uint8_t>
+rleEncode(const void *source, size_t len)
+{
+  return rleCommonEncode(source, len, nullptr);
+}
+
+std::vector<uint8_t>
+rleEncode(const void *source, size_t len, const std::atomic<size_t> &limit)
+{
+  return rleCommonEncode(source, len, &limit);
+}
+
 void
 rleDecode(const void *source,
           void       *dest,
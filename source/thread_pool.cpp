@@ -0,0 +1,186 @@
+/*------------------------------------------------------------------------------
+ * Copyright (c) 2017
+ *     Michael Theall (mtheall)
+ *
+ * This file is part of tex3ds.
+ *
+ * tex3ds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * tex3ds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with tex3ds.  If not, see <http://www.gnu.org/licenses/>.
+ *----------------------------------------------------------------------------*/
+/** @file thread_pool.cpp
+ *  @brief Worker thread pool
+ */
+#include <algorithm>
+#include "thread_pool.h"
+
+namespace
+{
+/** @brief Pool owning the current worker thread, if any */
+thread_local ThreadPool *current_pool = nullptr;
+
+/** @brief Index of the current worker thread in its pool */
+thread_local size_t current_index = 0;
+}
+
+ThreadPool::ThreadPool(size_t num_threads)
+: queued(0),
+  pending(0),
+  next(0),
+  quit(false)
+{
+  // hardware_concurrency() may report 0 if it can't be determined
+  if(num_threads == 0)
+    num_threads = std::max(1u, std::thread::hardware_concurrency());
+
+  for(size_t i = 0; i < num_threads; ++i)
+    queues.push_back(std::unique_ptr<Queue>(new Queue()));
+
+  for(size_t i = 0; i < num_threads; ++i)
+    workers.push_back(std::thread(&ThreadPool::work_thread, this, i));
+}
+
+ThreadPool::~ThreadPool()
+{
+  std::unique_lock<std::mutex> lock(mutex);
+
+  // let the workers finish what is queued
+  while(pending != 0)
+    done_cond.wait(lock);
+
+  quit = true;
+  work_cond.notify_all();
+  lock.unlock();
+
+  for(auto &worker: workers)
+    worker.join();
+}
+
+void ThreadPool::submit(Job job)
+{
+  // workers keep their own jobs local; others are dealt round-robin
+  size_t index;
+  if(current_pool == this)
+    index = current_index;
+  else
+    index = next++ % queues.size();
+
+  ++pending;
+
+  {
+    std::lock_guard<std::mutex> lock(queues[index]->mutex);
+    queues[index]->jobs.push_back(std::move(job));
+  }
+
+  ++queued;
+
+  // taking the mutex orders this against a worker deciding to sleep
+  std::lock_guard<std::mutex> lock(mutex);
+  work_cond.notify_one();
+}
+
+void ThreadPool::wait()
+{
+  std::unique_lock<std::mutex> lock(mutex);
+
+  while(pending != 0)
+    done_cond.wait(lock);
+
+  if(error)
+  {
+    std::exception_ptr e = error;
+    error = nullptr;
+    std::rethrow_exception(e);
+  }
+}
+
+bool ThreadPool::pop(size_t index, Job &job)
+{
+  Queue &queue = *queues[index];
+  std::lock_guard<std::mutex> lock(queue.mutex);
+
+  if(queue.jobs.empty())
+    return false;
+
+  // newest first; it is the most likely to still be in cache
+  job = std::move(queue.jobs.back());
+  queue.jobs.pop_back();
+  --queued;
+  return true;
+}
+
+bool ThreadPool::steal(size_t index, Job &job)
+{
+  for(size_t i = 1; i < queues.size(); ++i)
+  {
+    Queue &queue = *queues[(index + i) % queues.size()];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+
+    if(queue.jobs.empty())
+      continue;
+
+    // oldest first; it is the furthest from the owner's working set
+    job = std::move(queue.jobs.front());
+    queue.jobs.pop_front();
+    --queued;
+    return true;
+  }
+
+  return false;
+}
+
+void ThreadPool::finish()
+{
+  // wake up waiters if this was the last job
+  if(--pending == 0)
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    done_cond.notify_all();
+  }
+}
+
+void ThreadPool::work_thread(size_t index)
+{
+  current_pool  = this;
+  current_index = index;
+
+  while(true)
+  {
+    Job job;
+    if(!pop(index, job) && !steal(index, job))
+    {
+      // nothing to do; sleep until something is queued
+      std::unique_lock<std::mutex> lock(mutex);
+      while(!quit && queued == 0)
+        work_cond.wait(lock);
+
+      if(quit && queued == 0)
+        return;
+
+      continue;
+    }
+
+    // run the job
+    try
+    {
+      job();
+    }
+    catch(...)
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      if(!error)
+        error = std::current_exception();
+    }
+
+    finish();
+  }
+}
@@ -0,0 +1,211 @@
+/*------------------------------------------------------------------------------
+ * Copyright (c) 2017
+ *     Michael Theall (mtheall)
+ *
+ * This file is part of tex3ds.
+ *
+ * tex3ds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * tex3ds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with tex3ds.  If not, see <http://www.gnu.org/licenses/>.
+ *----------------------------------------------------------------------------*/
+/** @file etc1_check.cpp
+ *  @brief Check the ETC1 lookup tables and selector kernels
+ *
+ *  @details
+ *  The precomputed lookup tables must match the loops that generate them, and
+ *  every set of selector kernels supported by this CPU must pick the same
+ *  selectors and report the same errors as the scalar kernels. An ETC1A4
+ *  band encoded by encode::etc1a4() must decode with decode::etc1a4() to the
+ *  alpha nibbles it was given and to the colors of its ETC1 blocks.
+ *
+ *  With --print-tables, prints the lookup tables as C++ source instead, to
+ *  regenerate them in rg_etc1.cpp.
+ */
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+#include "decode.h"
+#include "encode.h"
+#include "quantum.h"
+#include "rg_etc1.h"
+
+namespace
+{
+
+/** @brief Print the lookup tables as they appear in rg_etc1.cpp */
+void print_tables()
+{
+  static unsigned short inverse_lookup[64][256];
+  static unsigned char  quant5[256 + 16];
+
+  rg_etc1::generate_etc1_tables(inverse_lookup, quant5);
+
+  std::printf("   static const uint8_t g_quant5_tab[256+16] =\n   {\n");
+  for(unsigned int i = 0; i < 256 + 16; ++i)
+    std::printf("%s0x%02X,%s", i % 16 ? " " : "      ", quant5[i],
+                i % 16 == 15 ? "\n" : "");
+  std::printf("   };\n\n");
+
+  std::printf("   // Given an ETC1 diff/inten_table/selector, and an 8-bit "
+              "desired color, this table encodes the best packed_color in the "
+              "low byte, and the abs error in the high byte.\n");
+  std::printf("   static const uint16_t g_etc1_inverse_lookup[2*8*4][256] ="
+              "      // [diff/inten_table/selector][desired_color]\n   {\n");
+  for(unsigned int t = 0; t < 64; ++t)
+  {
+    std::printf("      // diff %u, inten_table %u, selector %u\n      {\n",
+                t & 1, (t >> 1) & 7, t >> 4);
+    for(unsigned int i = 0; i < 256; ++i)
+      std::printf("%s0x%04X,%s", i % 16 ? " " : "         ",
+                  inverse_lookup[t][i], i % 16 == 15 ? "\n" : "");
+    std::printf("      },\n");
+  }
+  std::printf("   };\n");
+}
+
+
+/** @brief Check an ETC1A4 round trip
+ *
+ *  @details
+ *  Encodes a band of two tiles with known alpha and decodes it again. Each
+ *  4x4 block is stored as 8 bytes of 4bpp alpha, indexed by 2*x + y/2 with
+ *  odd rows in the upper nibble, followed by the little-endian ETC1 block.
+ *
+ *  @returns whether the round trip matched
+ */
+bool check_etc1a4()
+{
+  constexpr size_t STRIDE = 16;
+
+  std::mt19937                            rng(1);
+  std::uniform_int_distribution<unsigned> channel(0, CHANNEL_MAX);
+
+  // alpha nibble of each pixel
+  auto nibble = [](size_t x, size_t y) -> uint8_t
+  {
+    return (x * 3 + y * 5 + x / 8) & 0xF;
+  };
+
+  std::vector<Pixel> tiles(8 * STRIDE), decoded(8 * STRIDE);
+  for(size_t y = 0; y < 8; ++y)
+  {
+    for(size_t x = 0; x < STRIDE; ++x)
+    {
+      Pixel &c = tiles[y*STRIDE + x];
+
+      c.r = channel(rng);
+      c.g = channel(rng);
+      c.b = channel(rng);
+      c.a = bits_to_channel<4>(nibble(x, y));
+    }
+  }
+
+  std::vector<uint8_t> out(2 * 64);
+  encode::WorkUnit work(tiles.data(), STRIDE, 0, 2, out.data(),
+                        rg_etc1::cMediumQuality, rg_etc1::pack_etc1_blocks,
+                        0, nullptr, nullptr, encode::etc1a4);
+  work.process(work);
+
+  decode::etc1a4(out.data(), decoded.data(), STRIDE, 0, 2);
+
+  const uint8_t *in = out.data();
+  for(size_t t = 0; t < 2; ++t)
+  {
+    for(size_t j = 0; j < 8; j += 4)
+    {
+      for(size_t i = 0; i < 8; i += 4)
+      {
+        const uint8_t *in_alpha = in;
+        uint8_t       in_block[8];
+        uint8_t       out_block[4*4*4];
+
+        // etc1 block is stored little-endian; rg_etc1 wants big-endian
+        for(size_t k = 0; k < 8; ++k)
+          in_block[k] = in[16-k-1];
+        in += 16;
+
+        rg_etc1::unpack_etc1_block(in_block,
+                                   reinterpret_cast<unsigned int*>(out_block));
+
+        for(size_t y = 0; y < 4; ++y)
+        {
+          for(size_t x = 0; x < 4; ++x)
+          {
+            const size_t  px = t*8 + i + x;
+            const size_t  py = j + y;
+            const Pixel   &c = decoded[py*STRIDE + px];
+            const uint8_t a  = in_alpha[2*x + y/2] >> (y & 1 ? 4 : 0) & 0xF;
+
+            if(a != nibble(px, py))
+            {
+              std::printf("FAIL: etc1a4 alpha of (%zu, %zu) is %u, "
+                          "expected %u\n", px, py, a, nibble(px, py));
+              return false;
+            }
+
+            if(c.r != bits_to_channel<8>(out_block[y*16 + x*4 + 0])
+            || c.g != bits_to_channel<8>(out_block[y*16 + x*4 + 1])
+            || c.b != bits_to_channel<8>(out_block[y*16 + x*4 + 2])
+            || c.a != bits_to_channel<4>(a))
+            {
+              std::printf("FAIL: etc1a4 decode of (%zu, %zu) does not match "
+                          "the ETC1 block\n", px, py);
+              return false;
+            }
+          }
+        }
+      }
+    }
+  }
+
+  return true;
+}
+
+}
+
+int main(int argc, char *argv[])
+{
+  if(argc > 1 && std::strcmp(argv[1], "--print-tables") == 0)
+  {
+    print_tables();
+    return 0;
+  }
+
+  bool ok = rg_etc1::check_etc1_tables();
+  if(ok)
+    std::printf("lookup tables: checked\n");
+  else
+    std::printf("FAIL: lookup tables do not match generate_etc1_tables()\n");
+
+  if(check_etc1a4())
+    std::printf("etc1a4: checked\n");
+  else
+    ok = false;
+
+  const unsigned int count = rg_etc1::etc1_kernel_count();
+
+  for(unsigned int i = 0; i + 1 < count; ++i)
+  {
+    if(!rg_etc1::check_etc1_kernel(i))
+    {
+      std::printf("FAIL: %s selector kernels do not match scalar\n",
+                  rg_etc1::etc1_kernel_name(i));
+      ok = false;
+      continue;
+    }
+
+    std::printf("%s: checked\n", rg_etc1::etc1_kernel_name(i));
+  }
+
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,411 @@
+/*------------------------------------------------------------------------------
+ * Copyright (c) 2017
+ *     Michael Theall (mtheall)
+ *
+ * This file is part of tex3ds.
+ *
+ * tex3ds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * tex3ds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with tex3ds.  If not, see <http://www.gnu.org/licenses/>.
+ *----------------------------------------------------------------------------*/
+/** @file format_check.cpp
+ *  @brief Check the generated tile encoders and decoders
+ *
+ *  @details
+ *  encode_tile() of every format descriptor must produce the same bytes as
+ *  the hand-written per-format packing it replaced, and decode_tile() of the
+ *  result must give the quantized channels the per-format preview used to.
+ *  The automake check builds this once with 8-bit and once with 16-bit
+ *  staging channels.
+ */
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+#include "format.h"
+
+namespace
+{
+
+/** @brief Stride of the test bitmap; wider than a tile to catch stride bugs */
+constexpr size_t STRIDE = 24;
+
+/** @brief Number of tiles to check per format */
+constexpr size_t TILES = 64;
+
+/** @brief Hand-written packing of a tile
+ *  @param[in]  c   Tile pixels in Morton order
+ *  @param[in]  l   Luminance of each pixel
+ *  @param[out] out Output buffer
+ */
+typedef void (*Reference)(const Pixel *c, const Channel *l,
+                          std::vector<uint8_t> &out);
+
+/** @brief Decoded pixel of the hand-written preview
+ *  @param[in] c Pixel
+ *  @param[in] l Luminance of the pixel
+ *  @returns decoded pixel
+ */
+typedef Pixel (*Preview)(const Pixel &c, Channel l);
+
+/** @brief Get luminance from RGB with gamma correction
+ *  @param[in] c Pixel
+ *  @returns luminance
+ */
+Channel luminance(const Pixel &c)
+{
+  // ITU Recommendation BT.709
+  const double r = 0.212655;
+  const double g = 0.715158;
+  const double b = 0.072187;
+
+  // Gamma correction
+  double v = gamma(r * gamma_inverse(static_cast<double>(c.r) / CHANNEL_MAX)
+                 + g * gamma_inverse(static_cast<double>(c.g) / CHANNEL_MAX)
+                 + b * gamma_inverse(static_cast<double>(c.b) / CHANNEL_MAX));
+
+  // clamp
+  return std::max(0.0, std::min(1.0, v)) * CHANNEL_MAX;
+}
+
+// Hand-written packing of each format, as encode.cpp had it; see Reference
+
+void rgba8888(const Pixel *c, const Channel*, std::vector<uint8_t> &out)
+{
+  for(size_t i = 0; i < 64; ++i)
+  {
+    out.push_back(channel_to_bits<8>(c[i].a));
+    out.push_back(channel_to_bits<8>(c[i].b));
+    out.push_back(channel_to_bits<8>(c[i].g));
+    out.push_back(channel_to_bits<8>(c[i].r));
+  }
+}
+
+void rgb888(const Pixel *c, const Channel*, std::vector<uint8_t> &out)
+{
+  for(size_t i = 0; i < 64; ++i)
+  {
+    out.push_back(channel_to_bits<8>(c[i].b));
+    out.push_back(channel_to_bits<8>(c[i].g));
+    out.push_back(channel_to_bits<8>(c[i].r));
+  }
+}
+
+void rgba5551(const Pixel *c, const Channel*, std::vector<uint8_t> &out)
+{
+  for(size_t i = 0; i < 64; ++i)
+  {
+    uint16_t v = (channel_to_bits<5>(c[i].r) << 11)
+               | (channel_to_bits<5>(c[i].g) <<  6)
+               | (channel_to_bits<5>(c[i].b) <<  1)
+               | (channel_to_bits<1>(c[i].a) <<  0);
+
+    out.push_back(v >> 0);
+    out.push_back(v >> 8);
+  }
+}
+
+void rgb565(const Pixel *c, const Channel*, std::vector<uint8_t> &out)
+{
+  for(size_t i = 0; i < 64; ++i)
+  {
+    uint16_t v = (channel_to_bits<5>(c[i].r) << 11)
+               | (channel_to_bits<6>(c[i].g) <<  5)
+               | (channel_to_bits<5>(c[i].b) <<  0);
+
+    out.push_back(v >> 0);
+    out.push_back(v >> 8);
+  }
+}
+
+void rgba4444(const Pixel *c, const Channel*, std::vector<uint8_t> &out)
+{
+  for(size_t i = 0; i < 64; ++i)
+  {
+    uint16_t v = (channel_to_bits<4>(c[i].r) << 12)
+               | (channel_to_bits<4>(c[i].g) <<  8)
+               | (channel_to_bits<4>(c[i].b) <<  4)
+               | (channel_to_bits<4>(c[i].a) <<  0);
+
+    out.push_back(v >> 0);
+    out.push_back(v >> 8);
+  }
+}
+
+void la88(const Pixel *c, const Channel *l, std::vector<uint8_t> &out)
+{
+  for(size_t i = 0; i < 64; ++i)
+  {
+    out.push_back(channel_to_bits<8>(c[i].a));
+    out.push_back(channel_to_bits<8>(l[i]));
+  }
+}
+
+void hilo88(const Pixel *c, const Channel*, std::vector<uint8_t> &out)
+{
+  for(size_t i = 0; i < 64; ++i)
+  {
+    out.push_back(channel_to_bits<8>(c[i].g));
+    out.push_back(channel_to_bits<8>(c[i].r));
+  }
+}
+
+void l8(const Pixel*, const Channel *l, std::vector<uint8_t> &out)
+{
+  for(size_t i = 0; i < 64; ++i)
+    out.push_back(channel_to_bits<8>(l[i]));
+}
+
+void a8(const Pixel *c, const Channel*, std::vector<uint8_t> &out)
+{
+  for(size_t i = 0; i < 64; ++i)
+    out.push_back(channel_to_bits<8>(c[i].a));
+}
+
+void la44(const Pixel *c, const Channel *l, std::vector<uint8_t> &out)
+{
+  for(size_t i = 0; i < 64; ++i)
+  {
+    out.push_back((channel_to_bits<4>(l[i])    << 4)
+                | (channel_to_bits<4>(c[i].a) << 0));
+  }
+}
+
+void l4(const Pixel*, const Channel *l, std::vector<uint8_t> &out)
+{
+  for(size_t i = 0; i < 64; i += 2)
+  {
+    out.push_back((channel_to_bits<4>(l[i+1]) << 4)
+                | (channel_to_bits<4>(l[i+0]) << 0));
+  }
+}
+
+void a4(const Pixel *c, const Channel*, std::vector<uint8_t> &out)
+{
+  for(size_t i = 0; i < 64; i += 2)
+  {
+    out.push_back((channel_to_bits<4>(c[i+1].a) << 4)
+                | (channel_to_bits<4>(c[i+0].a) << 0));
+  }
+}
+
+// Hand-written preview of each format, as encode.cpp had it; see Preview
+
+Pixel preview_rgba8888(const Pixel &c, Channel)
+{
+  return { quantize_channel<8>(c.r), quantize_channel<8>(c.g),
+           quantize_channel<8>(c.b), quantize_channel<8>(c.a) };
+}
+
+Pixel preview_rgb888(const Pixel &c, Channel)
+{
+  return { quantize_channel<8>(c.r), quantize_channel<8>(c.g),
+           quantize_channel<8>(c.b), CHANNEL_MAX };
+}
+
+Pixel preview_rgba5551(const Pixel &c, Channel)
+{
+  return { quantize_channel<5>(c.r), quantize_channel<5>(c.g),
+           quantize_channel<5>(c.b), quantize_channel<1>(c.a) };
+}
+
+Pixel preview_rgb565(const Pixel &c, Channel)
+{
+  return { quantize_channel<5>(c.r), quantize_channel<6>(c.g),
+           quantize_channel<5>(c.b), CHANNEL_MAX };
+}
+
+Pixel preview_rgba4444(const Pixel &c, Channel)
+{
+  return { quantize_channel<4>(c.r), quantize_channel<4>(c.g),
+           quantize_channel<4>(c.b), quantize_channel<4>(c.a) };
+}
+
+Pixel preview_la88(const Pixel &c, Channel l)
+{
+  l = quantize_channel<8>(l);
+  return { l, l, l, quantize_channel<8>(c.a) };
+}
+
+Pixel preview_hilo88(const Pixel &c, Channel)
+{
+  return { quantize_channel<8>(c.r), quantize_channel<8>(c.g),
+           0, CHANNEL_MAX };
+}
+
+Pixel preview_l8(const Pixel&, Channel l)
+{
+  l = quantize_channel<8>(l);
+  return { l, l, l, CHANNEL_MAX };
+}
+
+Pixel preview_a8(const Pixel &c, Channel)
+{
+  return { 0, 0, 0, quantize_channel<8>(c.a) };
+}
+
+Pixel preview_la44(const Pixel &c, Channel l)
+{
+  l = quantize_channel<4>(l);
+  return { l, l, l, quantize_channel<4>(c.a) };
+}
+
+Pixel preview_l4(const Pixel&, Channel l)
+{
+  l = quantize_channel<4>(l);
+  return { l, l, l, CHANNEL_MAX };
+}
+
+Pixel preview_a4(const Pixel &c, Channel)
+{
+  return { 0, 0, 0, quantize_channel<4>(c.a) };
+}
+
+/** @brief Fill a tile
+ *  @param[out] p    Tile pixel data
+ *  @param[in]  kind Tile kind
+ *  @param[in]  rng  Random number generator
+ */
+void fill_tile(Pixel *p, size_t kind, std::mt19937 &rng)
+{
+  std::uniform_int_distribution<unsigned> channel(0, CHANNEL_MAX);
+  std::uniform_int_distribution<unsigned> edge(0, 3);
+
+  // values at and around the quantization steps of every format
+  const Channel edges[] = { 0, 1, CHANNEL_MAX - 1, CHANNEL_MAX };
+
+  for(size_t y = 0; y < 8; ++y)
+  {
+    for(size_t x = 0; x < 8; ++x)
+    {
+      Pixel &c = p[y*STRIDE + x];
+
+      switch(kind)
+      {
+        case 0:
+          // random
+          c.r = channel(rng);
+          c.g = channel(rng);
+          c.b = channel(rng);
+          c.a = channel(rng);
+          break;
+
+        case 1:
+          // extremes
+          c.r = edges[edge(rng)];
+          c.g = edges[edge(rng)];
+          c.b = edges[edge(rng)];
+          c.a = edges[edge(rng)];
+          break;
+
+        default:
+          // gradient
+          c.r = (x * 8 + y) * CHANNEL_MAX / 63;
+          c.g = (y * 8 + x) * CHANNEL_MAX / 63;
+          c.b = CHANNEL_MAX - c.r;
+          c.a = CHANNEL_MAX - c.g;
+          break;
+      }
+    }
+  }
+}
+
+/** @brief Check a format against its hand-written packing and preview
+ *  @tparam    F         Pixel format
+ *  @param[in] name      Name of the format
+ *  @param[in] reference Hand-written packing
+ *  @param[in] preview   Hand-written preview
+ *  @returns whether every tile matched
+ */
+template<typename F>
+bool check_format(const char *name, Reference reference, Preview preview)
+{
+  std::mt19937 rng(1);
+
+  std::vector<Pixel>   tile(8 * STRIDE), decoded(8 * STRIDE);
+  std::vector<uint8_t> actual(F::tile_size);
+
+  for(size_t i = 0; i < TILES; ++i)
+  {
+    fill_tile(tile.data(), i % 3, rng);
+
+    Pixel   c[64];
+    Channel l[64];
+    for(size_t k = 0; k < 64; ++k)
+    {
+      c[k] = tile[morton_offset(k, STRIDE)];
+      l[k] = luminance(c[k]);
+    }
+
+    std::vector<uint8_t> expected;
+    reference(c, l, expected);
+
+    format::encode_tile<F>(tile.data(), STRIDE, actual.data());
+
+    if(expected.size() != F::tile_size
+    || std::memcmp(expected.data(), actual.data(), F::tile_size) != 0)
+    {
+      std::printf("FAIL: %s encode does not match the hand-written packing "
+                  "(%zu-bit channels, tile %zu)\n",
+                  name, size_t(CHANNEL_BITS), i);
+      return false;
+    }
+
+    format::decode_tile<F>(actual.data(), decoded.data(), STRIDE);
+
+    for(size_t k = 0; k < 64; ++k)
+    {
+      const Pixel  e = preview(c[k], l[k]);
+      const Pixel &d = decoded[morton_offset(k, STRIDE)];
+
+      if(d.r != e.r || d.g != e.g || d.b != e.b || d.a != e.a)
+      {
+        std::printf("FAIL: %s decode of pixel %zu is (%u, %u, %u, %u), "
+                    "expected (%u, %u, %u, %u) (%zu-bit channels, tile %zu)\n",
+                    name, k, unsigned(d.r), unsigned(d.g), unsigned(d.b),
+                    unsigned(d.a), unsigned(e.r), unsigned(e.g),
+                    unsigned(e.b), unsigned(e.a), size_t(CHANNEL_BITS), i);
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+}
+
+int main()
+{
+  using namespace format;
+
+  bool ok = true;
+  ok &= check_format<RGBA8888>("rgba8888", rgba8888, preview_rgba8888);
+  ok &= check_format<RGB888>("rgb888", rgb888, preview_rgb888);
+  ok &= check_format<RGBA5551>("rgba5551", rgba5551, preview_rgba5551);
+  ok &= check_format<RGB565>("rgb565", rgb565, preview_rgb565);
+  ok &= check_format<RGBA4444>("rgba4444", rgba4444, preview_rgba4444);
+  ok &= check_format<LA88>("la88", la88, preview_la88);
+  ok &= check_format<HILO88>("hilo88", hilo88, preview_hilo88);
+  ok &= check_format<L8>("l8", l8, preview_l8);
+  ok &= check_format<A8>("a8", a8, preview_a8);
+  ok &= check_format<LA44>("la44", la44, preview_la44);
+  ok &= check_format<L4>("l4", l4, preview_l4);
+  ok &= check_format<A4>("a4", a4, preview_a4);
+
+  if(ok)
+    std::printf("formats: checked (%zu-bit channels)\n",
+                size_t(CHANNEL_BITS));
+
+  return ok ? 0 : 1;
+}
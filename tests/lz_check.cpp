@@ -0,0 +1,452 @@
+/*------------------------------------------------------------------------------
+ * Copyright (c) 2017
+ *     Michael Theall (mtheall)
+ *
+ * This file is part of tex3ds.
+ *
+ * tex3ds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * tex3ds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with tex3ds.  If not, see <http://www.gnu.org/licenses/>.
+ *----------------------------------------------------------------------------*/
+/** @file lz_check.cpp
+ *  @brief Check the LZSS/LZ10/LZ11 encoders against their decoders
+ *
+ *  @details
+ *  Every encoder's output must decode back to its input. The optimal-parse
+ *  encoders must never produce more than the greedy ones, and the test
+ *  inputs must make the LZ11 encoders emit every match length encoding.
+ *
+ *  The greedy encoders must also produce exactly the same bytes as the
+ *  original encoder, which found matches with a backward byte scan; a copy of
+ *  it is kept here.
+ */
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+#include "compress.h"
+
+namespace
+{
+
+/** @brief Encoder */
+typedef std::vector<uint8_t> (*Encoder)(const void*, size_t);
+
+/** @brief Decoder */
+typedef void (*Decoder)(const void*, void*, size_t);
+
+/** @brief Test input */
+struct Input
+{
+  std::string          name; ///< Input name
+  std::vector<uint8_t> data; ///< Input data
+};
+
+/** @brief Get the size of a compression header
+ *  @param[in] data Compressed buffer
+ *  @returns header size
+ */
+size_t header_size(const std::vector<uint8_t> &data)
+{
+  return data[0] & 0x80 ? 8 : 4;
+}
+
+/** @brief Get the match lengths in an LZ11 stream
+ *  @param[in] data Compressed buffer
+ *  @param[in] size Decompressed size
+ *  @returns match lengths
+ */
+std::set<size_t> lz11_lengths(const std::vector<uint8_t> &data, size_t size)
+{
+  std::set<size_t> lengths;
+
+  const uint8_t *src = data.data() + header_size(data);
+  while(size > 0)
+  {
+    uint8_t flags = *src++;
+    for(size_t i = 0; i < 8 && size > 0; ++i, flags <<= 1)
+    {
+      if(!(flags & 0x80))
+      {
+        ++src;
+        --size;
+        continue;
+      }
+
+      size_t len;
+      switch(src[0] >> 4)
+      {
+        case 0:
+          len  = ((src[0] << 4) | (src[1] >> 4)) + 0x11;
+          src += 1;
+          break;
+
+        case 1:
+          len  = (((src[0] & 0x0F) << 12) | (src[1] << 4) | (src[2] >> 4))
+               + 0x111;
+          src += 2;
+          break;
+
+        default:
+          len = (src[0] >> 4) + 1;
+          break;
+      }
+
+      src += 2;
+      lengths.insert(len);
+      size -= std::min(len, size);
+    }
+  }
+
+  return lengths;
+}
+
+/** @brief Find the nearest earlier occurrence of a byte
+ *  @param[in] first Start of the range
+ *  @param[in] last  End of the range
+ *  @param[in] val   Byte to find
+ *  @returns nearest occurrence
+ *  @retval nullptr not found
+ */
+const uint8_t*
+rfind(const uint8_t *first, const uint8_t *last, const uint8_t &val)
+{
+  while(--last >= first)
+  {
+    if(*last == val)
+      return last;
+  }
+
+  return nullptr;
+}
+
+/** @brief Find best buffer match, as the original encoder did
+ *  @param[in]  start    Input buffer
+ *  @param[in]  buffer   Encoding buffer
+ *  @param[in]  len      Length of encoding buffer
+ *  @param[in]  max_disp Maximum displacement
+ *  @param[out] outlen   Length of match
+ *  @returns Best match
+ *  @retval nullptr no match
+ */
+const uint8_t*
+find_best_match(const uint8_t *start, const uint8_t *buffer, size_t len,
+                size_t max_disp, size_t &outlen)
+{
+  // clamp start to maximum displacement from buffer
+  if(buffer - start > static_cast<ptrdiff_t>(max_disp))
+    start = buffer - max_disp;
+
+  const uint8_t *best_start = buffer;
+  size_t        best_len = 0;
+
+  // find nearest matching start byte
+  const uint8_t *p = rfind(start, buffer, *buffer);
+  while(p)
+  {
+    // find length of match
+    size_t test_len = 1;
+    for(size_t i = 1; i < len; ++i)
+    {
+      if(p[i] == buffer[i])
+        ++test_len;
+      else
+        break;
+    }
+
+    if(test_len >= best_len)
+    {
+      // this match is the best so far, so save it
+      best_start = p;
+      best_len   = test_len;
+    }
+
+    // if we maximized the match, stop here
+    if(best_len == len)
+      break;
+
+    // find next nearest matching byte and try again
+    p = rfind(start, p, *buffer);
+  }
+
+  outlen = best_len;
+  return best_len ? best_start : nullptr;
+}
+
+/** @brief LZSS/LZ10/LZ11 compression, as the original encoder did it
+ *  @param[in] buffer Source buffer
+ *  @param[in] len    Source length
+ *  @param[in] lz11   Whether to use LZ11
+ *  @returns Compressed buffer
+ */
+std::vector<uint8_t> original_encode(const uint8_t *buffer, size_t len,
+                                     bool lz11)
+{
+  const size_t max_len  = lz11 ? 65808 : 18;
+  const size_t max_disp = 4096;
+
+  std::vector<uint8_t> result;
+  compressionHeader(result, lz11 ? 0x11 : 0x10, len);
+
+  size_t code_pos = result.size();
+  result.push_back(0);
+
+  size_t         chunks = 0;
+  const uint8_t *start  = buffer;
+  while(len > 0)
+  {
+    const uint8_t *tmp    = nullptr;
+    size_t        tmplen = 1;
+
+    if(buffer != start)
+      tmp = find_best_match(start, buffer, std::min(len, max_len), max_disp,
+                            tmplen);
+
+    if(tmplen > 2 && tmplen < len)
+    {
+      size_t skip_len, next_len;
+
+      find_best_match(start, buffer+1, std::min(len-1, max_len), max_disp,
+                      skip_len);
+      if(skip_len < 3)
+        skip_len = 1;
+
+      find_best_match(start, buffer+tmplen, std::min(len-tmplen, max_len),
+                      max_disp, next_len);
+      if(next_len < 3)
+        next_len = 1;
+
+      if(tmplen + next_len <= skip_len + 1)
+        tmplen = 1;
+    }
+
+    if(chunks == 8)
+    {
+      code_pos = result.size();
+      result.push_back(0);
+      chunks = 0;
+    }
+    const size_t shift = 7 - chunks++;
+
+    const size_t disp = buffer - tmp - 1;
+    if(tmplen < 3)
+    {
+      result.push_back(*buffer);
+      tmplen = 1;
+    }
+    else if(!lz11)
+    {
+      result[code_pos] |= 1 << shift;
+      result.push_back(((tmplen-3) << 4) | (disp >> 8));
+      result.push_back(disp);
+    }
+    else if(tmplen <= 0x10)
+    {
+      result[code_pos] |= 1 << shift;
+      result.push_back(((tmplen-1) << 4) | (disp >> 8));
+      result.push_back(disp);
+    }
+    else if(tmplen <= 0x110)
+    {
+      result[code_pos] |= 1 << shift;
+      result.push_back((tmplen-0x11) >> 4);
+      result.push_back(((tmplen-0x11) << 4) | (disp >> 8));
+      result.push_back(disp);
+    }
+    else
+    {
+      result[code_pos] |= 1 << shift;
+      result.push_back((1 << 4) | (tmplen-0x111) >> 12);
+      result.push_back((tmplen-0x111) >> 4);
+      result.push_back(((tmplen-0x111) << 4) | (disp >> 8));
+      result.push_back(disp);
+    }
+
+    buffer += tmplen;
+    len    -= tmplen;
+  }
+
+  // pad the output buffer to 4 bytes
+  result.resize((result.size() + 3) & ~3);
+  return result;
+}
+
+/** @brief Append random bytes
+ *  @param[out] data Buffer to append to
+ *  @param[in]  len  Number of bytes
+ *  @param[in]  rng  Random number generator
+ */
+void append_random(std::vector<uint8_t> &data, size_t len, std::mt19937 &rng)
+{
+  for(size_t i = 0; i < len; ++i)
+    data.push_back(rng());
+}
+
+/** @brief Build the test inputs
+ *  @returns test inputs
+ */
+std::vector<Input> make_inputs()
+{
+  std::mt19937       rng(1);
+  std::vector<Input> inputs;
+
+  Input random = { "random", {} };
+  append_random(random.data, 16384, rng);
+  inputs.emplace_back(random);
+
+  Input low = { "low-entropy", {} };
+  for(size_t i = 0; i < 65536; ++i)
+    low.data.push_back(rng() % 4);
+  inputs.emplace_back(low);
+
+  // copies of random strings whose longest match is exactly each length
+  // around the LZ10 and LZ11 length encoding boundaries
+  Input boundaries = { "boundaries", {} };
+  for(size_t len: { 3, 4, 0x10, 0x11, 18, 19, 0x110, 0x111, 0x112, 1000 })
+  {
+    append_random(boundaries.data, 64, rng);
+
+    const size_t first = boundaries.data.size();
+    append_random(boundaries.data, len, rng);
+
+    const uint8_t after = rng();
+    boundaries.data.push_back(after);
+    append_random(boundaries.data, 64, rng);
+
+    for(size_t i = 0; i < len; ++i)
+      boundaries.data.push_back(boundaries.data[first + i]);
+    boundaries.data.push_back(after ^ 0xFF);
+  }
+  inputs.emplace_back(boundaries);
+
+  // runs longer than the longest LZ11 match, and runs at every boundary
+  Input runs = { "long runs", {} };
+  for(size_t len: { 0x10, 0x11, 0x110, 0x111, 70000 })
+  {
+    append_random(runs.data, 32, rng);
+    runs.data.resize(runs.data.size() + len, rng());
+  }
+  inputs.emplace_back(runs);
+
+  // noise broken up by runs of zeros, like a texture with transparent areas
+  Input sparse = { "sparse", {} };
+  while(sparse.data.size() < 262144)
+  {
+    append_random(sparse.data, rng() % 512 + 1, rng);
+    sparse.data.resize(sparse.data.size() + rng() % 4096 + 1, 0);
+  }
+  inputs.emplace_back(sparse);
+
+  return inputs;
+}
+
+/** @brief Check that an encoder's output decodes to its input
+ *  @param[in] name    Encoder name
+ *  @param[in] input   Test input
+ *  @param[in] encoded Encoded input
+ *  @param[in] decode  Decoder
+ *  @returns whether the output decodes to the input
+ */
+bool check_round_trip(const char *name, const Input &input,
+                      const std::vector<uint8_t> &encoded, Decoder decode)
+{
+  std::vector<uint8_t> decoded(input.data.size());
+  decode(encoded.data() + header_size(encoded), decoded.data(),
+         decoded.size());
+
+  if(decoded != input.data)
+  {
+    std::printf("FAIL: %s does not round trip (%s)\n", name,
+                input.name.c_str());
+    return false;
+  }
+
+  return true;
+}
+
+}
+
+int main()
+{
+  bool ok = true;
+
+  std::set<size_t> greedy_lengths, optimal_lengths;
+  for(const auto &input: make_inputs())
+  {
+    const std::vector<uint8_t> lz10 = lzssEncode(input.data.data(),
+                                                 input.data.size());
+    const std::vector<uint8_t> lz11 = lz11Encode(input.data.data(),
+                                                 input.data.size());
+    const std::vector<uint8_t> lz10_optimal =
+      lzssOptimalEncode(input.data.data(), input.data.size());
+    const std::vector<uint8_t> lz11_optimal =
+      lz11OptimalEncode(input.data.data(), input.data.size());
+
+    if(lz10 != original_encode(input.data.data(), input.data.size(), false))
+    {
+      std::printf("FAIL: lz10 differs from the original encoder (%s)\n",
+                  input.name.c_str());
+      ok = false;
+    }
+
+    if(lz11 != original_encode(input.data.data(), input.data.size(), true))
+    {
+      std::printf("FAIL: lz11 differs from the original encoder (%s)\n",
+                  input.name.c_str());
+      ok = false;
+    }
+
+    ok &= check_round_trip("lz10", input, lz10, lzssDecode);
+    ok &= check_round_trip("lz11", input, lz11, lz11Decode);
+    ok &= check_round_trip("lz10-optimal", input, lz10_optimal, lzssDecode);
+    ok &= check_round_trip("lz11-optimal", input, lz11_optimal, lz11Decode);
+
+    if(lz10_optimal.size() > lz10.size())
+    {
+      std::printf("FAIL: lz10-optimal is larger than lz10 (%s)\n",
+                  input.name.c_str());
+      ok = false;
+    }
+
+    if(lz11_optimal.size() > lz11.size())
+    {
+      std::printf("FAIL: lz11-optimal is larger than lz11 (%s)\n",
+                  input.name.c_str());
+      ok = false;
+    }
+
+    for(size_t len: lz11_lengths(lz11, input.data.size()))
+      greedy_lengths.insert(len);
+    for(size_t len: lz11_lengths(lz11_optimal, input.data.size()))
+      optimal_lengths.insert(len);
+
+    std::printf("%s: lz10 %zu, lz10-optimal %zu, lz11 %zu, lz11-optimal %zu "
+                "bytes from %zu\n", input.name.c_str(), lz10.size(),
+                lz10_optimal.size(), lz11.size(), lz11_optimal.size(),
+                input.data.size());
+  }
+
+  // the lengths on either side of each LZ11 length encoding boundary
+  for(size_t len: { 0x10, 0x11, 0x110, 0x111 })
+  {
+    if(!greedy_lengths.count(len) || !optimal_lengths.count(len))
+    {
+      std::printf("FAIL: no LZ11 match of length 0x%zx was encoded\n", len);
+      ok = false;
+    }
+  }
+
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,161 @@
+/*------------------------------------------------------------------------------
+ * Copyright (c) 2017
+ *     Michael Theall (mtheall)
+ *
+ * This file is part of tex3ds.
+ *
+ * tex3ds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * tex3ds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with tex3ds.  If not, see <http://www.gnu.org/licenses/>.
+ *----------------------------------------------------------------------------*/
+/** @file pack_check.cpp
+ *  @brief Check the tile packing kernels against the scalar kernels
+ *
+ *  @details
+ *  Every set of kernels supported by this CPU packs the same tiles as the
+ *  scalar kernels and must produce the same bytes. The automake check builds
+ *  this once with 8-bit and once with 16-bit staging channels.
+ */
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+#include "pack.h"
+
+namespace
+{
+
+/** @brief Stride of the test bitmap; wider than a tile to catch stride bugs */
+constexpr size_t STRIDE = 24;
+
+/** @brief Number of random tiles to check */
+constexpr size_t RANDOM_TILES = 10000;
+
+/** @brief Fill a tile
+ *  @param[out] p    Tile pixel data
+ *  @param[in]  kind Tile kind
+ *  @param[in]  rng  Random number generator
+ */
+void fill_tile(Pixel *p, size_t kind, std::mt19937 &rng)
+{
+  std::uniform_int_distribution<unsigned> channel(0, CHANNEL_MAX);
+  std::uniform_int_distribution<unsigned> edge(0, 3);
+
+  // values at and around the quantization steps of every format
+  const Channel edges[] = { 0, 1, CHANNEL_MAX - 1, CHANNEL_MAX };
+
+  Pixel flat = { Channel(channel(rng)), Channel(channel(rng)),
+                 Channel(channel(rng)), Channel(channel(rng)) };
+
+  for(size_t y = 0; y < 8; ++y)
+  {
+    for(size_t x = 0; x < 8; ++x)
+    {
+      Pixel &c = p[y*STRIDE + x];
+
+      switch(kind)
+      {
+        case 0:
+          // random
+          c.r = channel(rng);
+          c.g = channel(rng);
+          c.b = channel(rng);
+          c.a = channel(rng);
+          break;
+
+        case 1:
+          // flat
+          c = flat;
+          break;
+
+        case 2:
+          // extremes
+          c.r = edges[edge(rng)];
+          c.g = edges[edge(rng)];
+          c.b = edges[edge(rng)];
+          c.a = edges[edge(rng)];
+          break;
+
+        default:
+          // gradient
+          c.r = (x * 8 + y) * CHANNEL_MAX / 63;
+          c.g = (y * 8 + x) * CHANNEL_MAX / 63;
+          c.b = CHANNEL_MAX - c.r;
+          c.a = CHANNEL_MAX - c.g;
+          break;
+      }
+    }
+  }
+}
+
+/** @brief Check one kernel against the scalar kernel
+ *  @param[in] set    Name of the kernel set
+ *  @param[in] format Name of the format
+ *  @param[in] kernel Kernel to check
+ *  @param[in] scalar Scalar kernel
+ *  @param[in] size   Bytes per tile
+ *  @returns whether every tile matched
+ */
+bool check_kernel(const char *set, const char *format, pack::Kernel kernel,
+                  pack::Kernel scalar, size_t size)
+{
+  std::mt19937 rng(1);
+
+  std::vector<Pixel>   tile(8 * STRIDE);
+  std::vector<uint8_t> expected(size), actual(size);
+
+  for(size_t i = 0; i < RANDOM_TILES; ++i)
+  {
+    fill_tile(tile.data(), i % 4, rng);
+
+    scalar(tile.data(), STRIDE, expected.data());
+    kernel(tile.data(), STRIDE, actual.data());
+
+    if(std::memcmp(expected.data(), actual.data(), size) != 0)
+    {
+      std::printf("FAIL: %s %s does not match scalar "
+                  "(%zu-bit channels, tile %zu)\n",
+                  set, format, size_t(CHANNEL_BITS), i);
+      return false;
+    }
+  }
+
+  return true;
+}
+
+}
+
+int main()
+{
+  const pack::Kernels &scalar = pack::scalar_kernels();
+
+  bool ok = true;
+  for(auto set: pack::supported_kernels())
+  {
+    if(set == &scalar)
+      continue;
+
+    ok &= check_kernel(set->name, "rgb565", set->rgb565, scalar.rgb565, 128);
+    ok &= check_kernel(set->name, "rgba5551", set->rgba5551, scalar.rgba5551,
+                       128);
+    ok &= check_kernel(set->name, "rgba4444", set->rgba4444, scalar.rgba4444,
+                       128);
+    ok &= check_kernel(set->name, "la44", set->la44, scalar.la44, 64);
+    ok &= check_kernel(set->name, "l4", set->l4, scalar.l4, 32);
+    ok &= check_kernel(set->name, "a4", set->a4, scalar.a4, 32);
+
+    std::printf("%s: checked (%zu-bit channels)\n", set->name,
+                size_t(CHANNEL_BITS));
+  }
+
+  return ok ? 0 : 1;
+}
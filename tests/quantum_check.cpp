@@ -0,0 +1,141 @@
+/*------------------------------------------------------------------------------
+ * Copyright (c) 2017
+ *     Michael Theall (mtheall)
+ *
+ * This file is part of tex3ds.
+ *
+ * tex3ds is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * tex3ds is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with tex3ds.  If not, see <http://www.gnu.org/licenses/>.
+ *----------------------------------------------------------------------------*/
+/** @file quantum_check.cpp
+ *  @brief Check the table-driven luminance against the gamma formula
+ *
+ *  @details
+ *  luminance_tile() must give exactly the 8-bit luminance of the original
+ *  formula, gamma() of the BT.709 weighted sum of gamma_inverse() of each
+ *  channel. With 8-bit staging channels every RGB triple is checked; with
+ *  16-bit ones, every grey level and a large random sample. The automake
+ *  check builds this once with 8-bit and once with 16-bit staging channels.
+ */
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include "quantum.h"
+
+namespace
+{
+
+/** @brief Number of random tiles to check with 16-bit channels */
+constexpr size_t RANDOM_TILES = 65536;
+
+/** @brief Linear value of each channel value */
+std::vector<double> linear;
+
+/** @brief Get the 8-bit luminance the way encoding originally did
+ *  @param[in] c Pixel
+ *  @returns 8-bit luminance
+ */
+uint8_t reference(const Pixel &c)
+{
+  // ITU Recommendation BT.709
+  const double r = 0.212655;
+  const double g = 0.715158;
+  const double b = 0.072187;
+
+  // gamma_inverse() of each channel, from a table to save time
+  double v = gamma(r * linear[c.r] + g * linear[c.g] + b * linear[c.b]);
+
+  Channel l = std::max(0.0, std::min(1.0, v)) * CHANNEL_MAX;
+  return channel_to_bits<8>(l);
+}
+
+/** @brief Check a tile
+ *  @param[in] tile Tile pixel data
+ *  @returns whether every pixel matched
+ */
+bool check_tile(const Pixel *tile)
+{
+  uint8_t out[64];
+  luminance_tile(tile, 8, out);
+
+  for(size_t i = 0; i < 64; ++i)
+  {
+    const Pixel &c = tile[i];
+    if(out[i] != reference(c))
+    {
+      std::printf("FAIL: luminance of (%u, %u, %u) is %u, expected %u "
+                  "(%zu-bit channels)\n", unsigned(c.r), unsigned(c.g),
+                  unsigned(c.b), out[i], reference(c), size_t(CHANNEL_BITS));
+      return false;
+    }
+  }
+
+  return true;
+}
+
+}
+
+int main()
+{
+  for(size_t i = 0; i <= CHANNEL_MAX; ++i)
+    linear.push_back(gamma_inverse(static_cast<double>(i) / CHANNEL_MAX));
+
+  Pixel  tile[64] = {};
+  size_t n        = 0;
+  bool   ok       = true;
+
+  auto add = [&](Channel r, Channel g, Channel b)
+  {
+    tile[n].r = r;
+    tile[n].g = g;
+    tile[n].b = b;
+
+    if(++n == 64)
+    {
+      ok &= check_tile(tile);
+      n   = 0;
+    }
+  };
+
+  // every grey level, including black and white
+  for(size_t v = 0; v <= CHANNEL_MAX; ++v)
+    add(v, v, v);
+
+  if(CHANNEL_BITS == 8)
+  {
+    // every RGB triple
+    for(size_t r = 0; r <= CHANNEL_MAX; ++r)
+    {
+      for(size_t g = 0; g <= CHANNEL_MAX; ++g)
+      {
+        for(size_t b = 0; b <= CHANNEL_MAX; ++b)
+          add(r, g, b);
+      }
+    }
+  }
+  else
+  {
+    std::mt19937                            rng(1);
+    std::uniform_int_distribution<unsigned> channel(0, CHANNEL_MAX);
+
+    for(size_t i = 0; i < RANDOM_TILES * 64; ++i)
+      add(channel(rng), channel(rng), channel(rng));
+  }
+
+  if(ok)
+    std::printf("luminance: checked (%zu-bit channels)\n",
+                size_t(CHANNEL_BITS));
+
+  return ok ? 0 : 1;
+}